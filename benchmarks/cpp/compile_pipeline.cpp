@@ -0,0 +1,744 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+
+// Host latency of each phase of compiling a fusion, without a GPU.
+//
+// Every fusion goes through the phases FusionKernelRuntime and KernelExecutor
+// run before handing the generated code to NVRTC: the pre-segmenter passes,
+// segmentation, heuristics, scheduling, lowering and code generation. Each
+// benchmark, named CompilePipeline_<phase>/<fusion>, times one phase and
+// prepares the ones before it outside of the measurement. Inputs are meta
+// tensors, and device properties come from a TargetDevice, so this runs on
+// hosts without GPUs. Each benchmark reports the heap allocations the phase
+// makes per iteration and the size of the IR it produces as counters.
+//
+// The fusions are those of the GPU benchmarks in this directory. Fusions
+// serialized by the Python frontend, e.g., by nvfuser.serialize(), can be
+// added by setting NVFUSER_COMPILE_BENCH_DEFINITIONS to the path of the
+// serialized FusionCache.
+//
+// The output is google benchmark's, so two commits can be compared with
+//   tools/compare_benchmark.py --benchmark_binary=bin/nvfuser_compile_bench
+//     <baseline> <contender> <out_dir>
+
+#include <codegen.h>
+#include <csrc/exceptions.h>
+#include <device_lower/lower2device.h>
+#include <device_lower/utils.h>
+#include <dynamic_transform.h>
+#include <evaluator_common.h>
+#include <fusion.h>
+#include <fusion_segmenter.h>
+#include <id_model/indexing.h>
+#include <ir/all_nodes.h>
+#include <ops/all_ops.h>
+#include <preseg_passes/pre_segmenter.h>
+#include <python_frontend/fusion_cache.h>
+#include <runtime/allocations.h>
+#include <runtime/executor_kernel_arg.h>
+#include <runtime/fusion_cache_utils.h>
+#include <scheduler/registry.h>
+#include <scheduler/runtime_info.h>
+#include <target_device.h>
+#include <utils.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <new>
+#include <optional>
+
+#include <benchmarks/cpp/fusions.h>
+#ifdef NVFUSER_DISTRIBUTED
+#include <tests/cpp/multidevice_transformer.h>
+#endif
+#include <tests/cpp/utils.h>
+
+using namespace nvfuser;
+
+namespace {
+
+// Counts operator new calls in the whole process. Benchmarks attribute the
+// difference across the measured region to the phase.
+std::atomic<int64_t> num_allocations{0};
+std::atomic<int64_t> num_allocated_bytes{0};
+
+} // namespace
+
+void* operator new(std::size_t size) {
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+  num_allocated_bytes.fetch_add((int64_t)size, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace {
+
+enum class Phase {
+  PreSegmenter,
+  Segmentation,
+  Heuristics,
+  Scheduling,
+  Lowering,
+  Codegen
+};
+
+const char* toString(Phase phase) {
+  switch (phase) {
+    case Phase::PreSegmenter:
+      return "PreSegmenter";
+    case Phase::Segmentation:
+      return "Segmentation";
+    case Phase::Heuristics:
+      return "Heuristics";
+    case Phase::Scheduling:
+      return "Scheduling";
+    case Phase::Lowering:
+      return "Lowering";
+    case Phase::Codegen:
+      return "Codegen";
+  }
+  NVF_THROW("Unknown phase");
+}
+
+// Extent given to symbolic dimensions of serialized definitions.
+constexpr int64_t kDefaultExtent = 1024;
+
+at::Tensor metaTensor(const std::vector<int64_t>& sizes, DataType dtype) {
+  return at::empty(
+      sizes,
+      at::TensorOptions().dtype(data_type_to_aten(dtype)).device(at::kMeta));
+}
+
+// Meta tensors and scalars for the inputs of a fusion whose definition
+// doesn't come with representative shapes.
+KernelArgumentHolder makeDefaultArgs(Fusion* fusion) {
+  KernelArgumentHolder args;
+  for (Val* in : fusion->inputs()) {
+    if (auto* tv = dynamic_cast<TensorView*>(in)) {
+      std::vector<int64_t> sizes;
+      for (IterDomain* id :
+           TensorDomain::noReductions(tv->getLogicalDomain())) {
+        if (id->isBroadcast()) {
+          sizes.push_back(1);
+        } else if (id->extent()->isConstInt()) {
+          sizes.push_back(id->extent()->evaluate().as<int64_t>());
+        } else {
+          sizes.push_back(kDefaultExtent);
+        }
+      }
+      if (tv->isCpuScalar()) {
+        args.push(at::zeros({}, at::dtype(data_type_to_aten(tv->dtype()))));
+      } else {
+        args.push(metaTensor(sizes, tv->dtype()));
+      }
+    } else if (isIntegralType(in->dtype())) {
+      args.push(PolymorphicValue(1L));
+    } else if (isFloatingPointType(in->dtype())) {
+      args.push(PolymorphicValue(1.0));
+    } else if (isBooleanType(in->dtype())) {
+      args.push(PolymorphicValue(false));
+    } else {
+      NVF_THROW("Unsupported input ", in->toString());
+    }
+  }
+  return args;
+}
+
+// A fusion to compile and the inputs to compile it for.
+struct Definition {
+  std::string name;
+  std::function<void(Fusion*)> define;
+  // Defaults to makeDefaultArgs.
+  std::function<KernelArgumentHolder()> make_args;
+};
+
+// Runs the phases of compiling one fusion one at a time. Each phase consumes
+// the products of the previous one. Phases that modify their input have a
+// prepare step that recreates it, so they can be repeated.
+class CompilePipeline {
+ public:
+  explicit CompilePipeline(const Definition& definition) {
+    definition_ = std::make_unique<Fusion>();
+    definition.define(definition_.get());
+    args_ = definition.make_args ? definition.make_args()
+                                 : makeDefaultArgs(definition_.get());
+    // Concretization happens in FusionExecutorCache, before any of the
+    // phases measured here.
+    if (definition_->hasDynamicTransform()) {
+      DynamicTransform::concretizeFusion(definition_.get(), args_);
+    }
+  }
+
+  void prepare(Phase phase) {
+    switch (phase) {
+      case Phase::PreSegmenter:
+        fusion_ = std::make_unique<Fusion>(*definition_);
+        break;
+      case Phase::Segmentation:
+        if (presegmented_ == nullptr) {
+          presegmented_ = std::make_unique<Fusion>(*definition_);
+          preseg_passes::OptimizationPass<
+              preseg_passes::PreSegmenter>::runPass(presegmented_.get());
+        }
+        fusion_ = std::make_unique<Fusion>(*presegmented_);
+        break;
+      case Phase::Scheduling:
+        for (Segment& segment : segments_) {
+          segment.fusion =
+              segmented_fusion_->makeFusion(segment.group).second;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  void run(Phase phase) {
+    switch (phase) {
+      case Phase::PreSegmenter:
+        preseg_passes::OptimizationPass<preseg_passes::PreSegmenter>::runPass(
+            fusion_.get());
+        break;
+      case Phase::Segmentation:
+        segment();
+        break;
+      case Phase::Heuristics:
+        computeHeuristics();
+        break;
+      case Phase::Scheduling:
+        schedule();
+        break;
+      case Phase::Lowering:
+        lower();
+        break;
+      case Phase::Codegen:
+        generateCode();
+        break;
+    }
+  }
+
+  // Prepares and runs every phase before `phase`.
+  void runUntil(Phase phase) {
+    for (Phase prior :
+         {Phase::PreSegmenter,
+          Phase::Segmentation,
+          Phase::Heuristics,
+          Phase::Scheduling,
+          Phase::Lowering}) {
+      if (prior >= phase) {
+        break;
+      }
+      prepare(prior);
+      run(prior);
+    }
+  }
+
+  // The size of the IR the last run of `phase` produced.
+  void reportIrSize(Phase phase, benchmark::State& benchmark_state) const {
+    auto& counters = benchmark_state.counters;
+    switch (phase) {
+      case Phase::PreSegmenter:
+        counters["exprs"] = (double)fusion_->exprs().size();
+        counters["vals"] = (double)fusion_->vals().size();
+        break;
+      case Phase::Segmentation:
+      case Phase::Heuristics:
+        counters["segments"] = (double)segmented_fusion_->groups().size();
+        break;
+      case Phase::Scheduling: {
+        int64_t num_exprs = 0;
+        int64_t num_tvs = 0;
+        for (const Segment& segment : segments_) {
+          num_exprs += std::ssize(segment.fusion->exprs());
+          num_tvs += std::ssize(segment.fusion->allTvs());
+        }
+        counters["exprs"] = (double)num_exprs;
+        counters["tvs"] = (double)num_tvs;
+        break;
+      }
+      case Phase::Lowering: {
+        int64_t num_exprs = 0;
+        for (const Segment& segment : segments_) {
+          if (segment.lower != nullptr) {
+            num_exprs += std::ssize(ir_utils::flattenScopedExprs(
+                segment.lower->kernel()->topLevelExprs()));
+          }
+        }
+        counters["kernels"] = (double)numKernels();
+        counters["kernel_exprs"] = (double)num_exprs;
+        reportIndexingCacheStats(benchmark_state);
+        break;
+      }
+      case Phase::Codegen: {
+        int64_t num_bytes = 0;
+        for (const Segment& segment : segments_) {
+          num_bytes += std::ssize(segment.code);
+        }
+        counters["kernels"] = (double)numKernels();
+        counters["code_bytes"] = (double)num_bytes;
+        break;
+      }
+    }
+  }
+
+ private:
+  // Hit rates of the indexing caches of segments lowered with TensorIndexer.
+  void reportIndexingCacheStats(benchmark::State& benchmark_state) const {
+    IndexingCacheStats total;
+    for (const Segment& segment : segments_) {
+      if (segment.lower == nullptr ||
+          !segment.lower->isTensorIndexerEnabled()) {
+        continue;
+      }
+      const IndexingCacheStats& stats =
+          segment.lower->tensorIndexer().cacheStats();
+      total.path_hits += stats.path_hits;
+      total.path_misses += stats.path_misses;
+      total.index_hits += stats.index_hits;
+      total.index_misses += stats.index_misses;
+    }
+    auto hit_rate = [](int64_t hits, int64_t misses) {
+      return hits + misses == 0 ? 0.0 : (double)hits / (double)(hits + misses);
+    };
+    auto& counters = benchmark_state.counters;
+    counters["path_hit_rate"] = hit_rate(total.path_hits, total.path_misses);
+    counters["index_hit_rate"] = hit_rate(total.index_hits, total.index_misses);
+  }
+
+  struct Segment {
+    SegmentedGroup* group = nullptr;
+    KernelArgumentHolder args;
+    std::unique_ptr<HeuristicParams> params;
+    std::unique_ptr<Fusion> fusion;
+    std::unique_ptr<GpuLower> lower;
+    std::string code;
+  };
+
+  // Like the FusionKernelRuntime constructor.
+  void segment() {
+    std::vector<TensorView*> all_tvs = fusion_->allTvs();
+    SchedulerRuntimeInfo runtime_info(fusion_.get(), args_, nullptr, all_tvs);
+    segmented_fusion_ = SegmentCandidateFinder::segment(
+        std::move(fusion_), args_, runtime_info);
+
+    RuntimeWorkSpace workspace;
+    prepareRuntimeOrder(segmented_fusion_.get(), workspace);
+    plan_ = SegmentDataflowPlan(
+        workspace, segmented_fusion_->inputs(), segmented_fusion_->outputs());
+    segments_.clear();
+    for (SegmentedGroup* group : workspace.group_run_order) {
+      segments_.push_back(Segment{.group = group});
+    }
+  }
+
+  // Like FusionKernelRuntime::getMaybeHeuristicsFor the first time.
+  void computeHeuristics() {
+    std::vector<PolymorphicValue> slots = plan_.bindInputs(args_);
+    for (auto run_order_id : arange(std::ssize(segments_))) {
+      Segment& segment = segments_.at(run_order_id);
+      Fusion* fusion = segment.group->getFusion();
+      FusionGuard fg(fusion);
+      segment.args = plan_.segmentInputs(slots, run_order_id);
+      segment.args.setDeviceIndex(args_.getDeviceIndex());
+
+      PrecomputedValues precomputed_values(fusion);
+      precomputed_values.bindInputs(segment.args);
+      precomputed_values.bindValues(
+          segment.group->getCompleteFusionInputs(), args_);
+      precomputed_values.evaluate();
+
+      SchedulerRuntimeInfo runtime_info(
+          fusion, segment.args, &precomputed_values, fusion->allTvs());
+      segment.params = segmented_fusion_->makeInitialHeuristicParams(
+          segment.group, runtime_info);
+
+      plan_.storeSegmentOutputs(
+          slots,
+          inferOutputSizes(fusion, segment.args, &precomputed_values),
+          run_order_id);
+    }
+  }
+
+  // Like FusionKernelRuntime::compileKernel. Fusions were made by prepare().
+  void schedule() {
+    for (Segment& segment : segments_) {
+      FusionGuard fg(segment.fusion.get());
+      SchedulerEntry::makeSchedulerInstance(segment.params->scheduler_type)
+          ->schedule(segment.fusion.get(), segment.params.get());
+    }
+  }
+
+  // Like the CompiledKernel constructor. Segments evaluated on the host
+  // aren't lowered.
+  void lower() {
+    for (Segment& segment : segments_) {
+      if (!isKernel(segment)) {
+        continue;
+      }
+      CompileParams cparams = segment.params->cparams;
+      if (!cparams.index_type.has_value()) {
+        cparams.index_type = segment.args.getSmallestIndexTypeOfArguments();
+      }
+      segment.lower = std::make_unique<GpuLower>(segment.fusion.get(), cparams);
+      segment.lower->run();
+    }
+  }
+
+  // Like CompiledKernel::compile up to NVRTC.
+  void generateCode() {
+    for (Segment& segment : segments_) {
+      if (segment.lower != nullptr) {
+        segment.code = codegen::generateCudaKernel(
+            segment.lower->kernel(),
+            "CUDAGeneratedKernel",
+            segment.params->lparams);
+      }
+    }
+  }
+
+  static bool isKernel(const Segment& segment) {
+    return segment.params->scheduler_type != SchedulerType::ExprEval &&
+        segment.params->scheduler_type != SchedulerType::Communication;
+  }
+
+  int64_t numKernels() const {
+    return std::count_if(segments_.begin(), segments_.end(), isKernel);
+  }
+
+  std::unique_ptr<Fusion> definition_;
+  KernelArgumentHolder args_;
+  std::unique_ptr<Fusion> presegmented_;
+  std::unique_ptr<Fusion> fusion_;
+  std::unique_ptr<SegmentedFusion> segmented_fusion_;
+  SegmentDataflowPlan plan_;
+  std::vector<Segment> segments_;
+};
+
+void CompilePipeline_Phase(
+    benchmark::State& benchmark_state,
+    const Definition& definition,
+    Phase phase) {
+  // Phases that modify their input rebuild it every iteration. The others
+  // are repeated on the same pipeline.
+  const bool needs_prepare = phase == Phase::PreSegmenter ||
+      phase == Phase::Segmentation || phase == Phase::Scheduling;
+
+  std::optional<CompilePipeline> pipeline;
+  try {
+    pipeline.emplace(definition);
+    pipeline->runUntil(phase);
+    pipeline->prepare(phase);
+  } catch (const std::exception& e) {
+    benchmark_state.SkipWithError(e.what());
+    return;
+  }
+
+  int64_t allocations = 0;
+  int64_t allocated_bytes = 0;
+  bool first_iteration = true;
+  for (auto _ : benchmark_state) {
+    if (needs_prepare && !first_iteration) {
+      benchmark_state.PauseTiming();
+      pipeline->prepare(phase);
+      benchmark_state.ResumeTiming();
+    }
+    first_iteration = false;
+
+    const int64_t allocations_before = num_allocations;
+    const int64_t allocated_bytes_before = num_allocated_bytes;
+    pipeline->run(phase);
+    allocations += num_allocations - allocations_before;
+    allocated_bytes += num_allocated_bytes - allocated_bytes_before;
+  }
+
+  pipeline->reportIrSize(phase, benchmark_state);
+  benchmark_state.counters["allocs"] = benchmark::Counter(
+      (double)allocations, benchmark::Counter::kAvgIterations);
+  benchmark_state.counters["alloc_bytes"] = benchmark::Counter(
+      (double)allocated_bytes, benchmark::Counter::kAvgIterations);
+}
+
+//------------------------------------------------------------------------------
+// Fusions of the GPU benchmarks, with their representative shapes. Those
+// defined in fusions.h are shared with the GPU benchmarks.
+
+KernelArgumentHolder layerNormArgs() {
+  return KernelArgumentHolder(
+      metaTensor({8192, 1024}, DataType::Half),
+      metaTensor({1024}, DataType::Half),
+      metaTensor({1024}, DataType::Half));
+}
+
+KernelArgumentHolder layerNormBackwardArgs() {
+  return KernelArgumentHolder(
+      metaTensor({8192, 1024}, DataType::Half),
+      metaTensor({8192, 1024}, DataType::Half),
+      metaTensor({1024}, DataType::Half),
+      metaTensor({1024}, DataType::Half),
+      metaTensor({8192, 1}, DataType::Float),
+      metaTensor({8192, 1}, DataType::Float));
+}
+
+KernelArgumentHolder softmaxArgs() {
+  return KernelArgumentHolder(metaTensor({8192, 4096}, DataType::Half));
+}
+
+KernelArgumentHolder rmsNormBackwardArgs() {
+  return KernelArgumentHolder(
+      metaTensor({8192, 4096}, DataType::Half),
+      metaTensor({8192, 4096}, DataType::Half),
+      metaTensor({4096}, DataType::Half),
+      metaTensor({8192, 1}, DataType::Half));
+}
+
+// The shapes of the vit_base_patch16_224 benchmarks in timm.cpp.
+constexpr int64_t kVitBatch = 64;
+constexpr int64_t kVitTokens = 197;
+constexpr int64_t kVitHidden = 768;
+constexpr int64_t kVitHeads = 12;
+
+KernelArgumentHolder vitBcast7Args() {
+  return KernelArgumentHolder(
+      metaTensor({kVitBatch, kVitTokens, kVitHidden}, DataType::Float),
+      metaTensor({kVitBatch, kVitTokens, 1}, DataType::Float),
+      metaTensor({kVitBatch, kVitTokens, 1}, DataType::Float),
+      metaTensor({kVitBatch, kVitTokens, kVitHidden}, DataType::Half));
+}
+
+KernelArgumentHolder vitBcast5Args() {
+  return KernelArgumentHolder(
+      metaTensor({kVitBatch, kVitTokens, kVitHidden}, DataType::Float),
+      metaTensor({kVitHidden}, DataType::Float),
+      metaTensor({kVitBatch, kVitTokens, kVitHidden}, DataType::Half),
+      metaTensor({kVitHidden}, DataType::Float),
+      metaTensor({kVitHidden}, DataType::Float));
+}
+
+KernelArgumentHolder vitBcastOuter2Args() {
+  return KernelArgumentHolder(
+      metaTensor({kVitBatch, kVitTokens, 3 * kVitHidden}, DataType::Half),
+      metaTensor({3 * kVitHidden}, DataType::Float));
+}
+
+KernelArgumentHolder vitNormInner3Args() {
+  KernelArgumentHolder args(metaTensor(
+      {kVitBatch, kVitHeads, kVitTokens, kVitTokens}, DataType::Half));
+  args.push(PolymorphicValue(0.125));
+  return args;
+}
+
+KernelArgumentHolder vitBcastOuter6Args() {
+  return KernelArgumentHolder(
+      metaTensor({kVitBatch, kVitTokens, 1024}, DataType::Half),
+      metaTensor({1024}, DataType::Float));
+}
+
+KernelArgumentHolder vitBcastInner6Args() {
+  return KernelArgumentHolder(
+      metaTensor({kVitBatch, kVitTokens, 1024}, DataType::Half),
+      metaTensor({kVitBatch, kVitTokens}, DataType::Float));
+}
+
+KernelArgumentHolder vitLayerNormBackwardArgs() {
+  const std::vector<int64_t> shape = {128, kVitTokens, kVitHidden};
+  KernelArgumentHolder args(
+      metaTensor(shape, DataType::Bool),
+      metaTensor(shape, DataType::Half),
+      metaTensor(shape, DataType::Half),
+      metaTensor({128, kVitTokens, 1}, DataType::Float),
+      metaTensor({128, kVitTokens, 1}, DataType::Float),
+      metaTensor({kVitHidden}, DataType::Half),
+      metaTensor({kVitHidden}, DataType::Half));
+  args.push(PolymorphicValue(1.0));
+  return args;
+}
+
+KernelArgumentHolder seresnetTransposeArgs() {
+  const std::vector<int64_t> shape = {128, kVitTokens, kVitTokens, 12};
+  return KernelArgumentHolder(
+      metaTensor(shape, DataType::Half),
+      metaTensor(shape, DataType::Half),
+      metaTensor(shape, DataType::Half),
+      metaTensor(shape, DataType::Half),
+      metaTensor({}, DataType::Half));
+}
+
+#ifdef NVFUSER_DISTRIBUTED
+// The forward pass of the transformer benchmark in transformer.cpp on a
+// single device, with a smaller embedding so symbolic extents can take
+// kDefaultExtent.
+void defineTransformerForward(Fusion* fusion) {
+  DistributedTransformer model(
+      /*num_devices=*/1,
+      /*batch_size=*/1,
+      /*embedding_size=*/kDefaultExtent,
+      /*number_heads=*/16,
+      /*sequence_length=*/2048,
+      /*dropout_prob=*/0.0,
+      /*sdpa_dropout_prob=*/0.0);
+  Fusion::copy(model.forward(DataType::BFloat16)->fusion(), fusion);
+}
+#endif
+
+// A TN matmul written as broadcast, multiply and sum, which the matmul
+// scheduler picks up on the default target device. Its lowering is dominated
+// by indexing, so the Lowering benchmark also reports the hit rates of
+// TensorIndexer's caches.
+void defineMatmul(Fusion* fusion) {
+  FusionGuard fg(fusion);
+  TensorView* a = makeContigTensor(2, DataType::Half);
+  TensorView* b = makeContigTensor(2, DataType::Half);
+  fusion->addInput(a);
+  fusion->addInput(b);
+  TensorView* product =
+      mul(broadcast(a, {false, true, false}),
+          broadcast(b, {true, false, false}));
+  fusion->addOutput(castOp(DataType::Half, sum(product, {-1})));
+}
+
+KernelArgumentHolder matmulArgs() {
+  return KernelArgumentHolder(
+      metaTensor({4096, 4096}, DataType::Half),
+      metaTensor({4096, 4096}, DataType::Half));
+}
+
+std::vector<Definition> builtinDefinitions() {
+  const auto timm = [](void (*setup)(Fusion*, void*)) {
+    return [setup](Fusion* fusion) { setup(fusion, nullptr); };
+  };
+  std::vector<Definition> definitions = {
+      {"LayerNorm",
+       [](Fusion* fusion) { setupLayerNorm(fusion, DataType::Half); },
+       layerNormArgs},
+      {"LayerNormBackward",
+       [](Fusion* fusion) { setupLayerNorm_BWD(fusion, DataType::Half); },
+       layerNormBackwardArgs},
+      {"Matmul", defineMatmul, matmulArgs},
+      {"Softmax",
+       [](Fusion* fusion) {
+         setupSoftmax(fusion, DataType::Half, /*reduction_axis=*/1);
+       },
+       softmaxArgs},
+      {"RMSNormBackward",
+       [](Fusion* fusion) { setupRMSNorm_BWD(fusion, DataType::Half); },
+       rmsNormBackwardArgs},
+      {"TIMM_vit_base_patch16_224_bcast7",
+       timm(setup_vit_base_patch16_224_bcast7),
+       vitBcast7Args},
+      {"TIMM_vit_base_patch16_224_bcast5",
+       timm(setup_vit_base_patch16_224_bcast5),
+       vitBcast5Args},
+      {"TIMM_vit_base_patch16_224_bcast_outer2",
+       timm(setup_vit_base_patch16_224_bcast_outer2),
+       vitBcastOuter2Args},
+      {"TIMM_vit_base_patch16_224_norm_inner3",
+       timm(setup_vit_base_patch16_224_norm_inner3),
+       vitNormInner3Args},
+      {"TIMM_vit_base_patch16_224_bcast_outer6",
+       timm(setup_vit_base_patch16_224_bcast_outer6),
+       vitBcastOuter6Args},
+      {"TIMM_vit_base_patch16_224_bcast_inner6",
+       timm(setup_vit_base_patch16_224_bcast_inner6),
+       vitBcastInner6Args},
+      {"TIMM_vit_base_patch16_224_LN_BWD",
+       timm(setup_vit_base_patch16_224_LN_BWD),
+       vitLayerNormBackwardArgs},
+      {"TIMM_nhwc_seresnet152d_transpose65",
+       timm(nhwc_seresnet152d_transpose65),
+       seresnetTransposeArgs},
+  };
+#ifdef NVFUSER_DISTRIBUTED
+  definitions.push_back({"TransformerForward", defineTransformerForward});
+#endif
+  return definitions;
+}
+
+// Definitions in a FusionCache serialized by the Python frontend, named
+// after the file and their position in it. Their symbolic extents are
+// kDefaultExtent.
+std::vector<Definition> serializedDefinitions(const std::string& path) {
+  std::vector<std::unique_ptr<Fusion>> fusions =
+      python_frontend::deserializeFusionDefinitions(path);
+  const std::string stem = std::filesystem::path(path).stem().string();
+  std::vector<Definition> definitions;
+  for (auto&& [i, fusion] : enumerate(fusions)) {
+    std::shared_ptr<Fusion> shared = std::move(fusion);
+    definitions.push_back(
+        {stem + "_" + std::to_string(i), [shared](Fusion* out) {
+           Fusion::copy(shared.get(), out);
+         }});
+  }
+  return definitions;
+}
+
+void registerBenchmarks(const std::vector<Definition>& definitions) {
+  for (Phase phase :
+       {Phase::PreSegmenter,
+        Phase::Segmentation,
+        Phase::Heuristics,
+        Phase::Scheduling,
+        Phase::Lowering,
+        Phase::Codegen}) {
+    for (const Definition& definition : definitions) {
+      benchmark::RegisterBenchmark(
+          (std::string("CompilePipeline_") + toString(phase) + "/" +
+           definition.name)
+              .c_str(),
+          [definition, phase](benchmark::State& benchmark_state) {
+            CompilePipeline_Phase(benchmark_state, definition, phase);
+          })
+          ->Unit(benchmark::kMillisecond);
+    }
+  }
+}
+
+} // namespace
+
+// Unlike main.cpp, doesn't query the GPU.
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  // Without a descriptor, schedule for the default TargetDevice rather than
+  // the current device, so results don't depend on the host.
+  std::optional<TargetDeviceGuard> target_guard;
+  if (getNvFuserEnv("TARGET_DEVICE") == nullptr) {
+    target_guard.emplace(TargetDevice());
+  }
+  const TargetDevice target = currentTargetDevice();
+  ::benchmark::AddCustomContext("target_device", target.name);
+  ::benchmark::AddCustomContext(
+      "target_compute_capability",
+      std::to_string(target.major) + "." + std::to_string(target.minor));
+
+  registerBenchmarks(builtinDefinitions());
+  if (const char* path = getNvFuserEnv("COMPILE_BENCH_DEFINITIONS")) {
+    registerBenchmarks(serializedDefinitions(path));
+  }
+
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+  return 0;
+}
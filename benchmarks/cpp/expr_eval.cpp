@@ -0,0 +1,252 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <csrc/exceptions.h>
+#include <device_lower/lower2device.h>
+#include <expr_evaluator.h>
+#include <fusion.h>
+#include <ir/all_nodes.h>
+#include <ir/utils.h>
+#include <kernel.h>
+#include <ops/all_ops.h>
+#include <runtime/expr_eval_plan.h>
+#include <scheduler/registry.h>
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/cpp/fusions.h>
+#include <benchmarks/cpp/utils.h>
+#include <tests/cpp/utils.h>
+
+using namespace nvfuser;
+
+// Compares evaluating an ATen-executed segment with ExprEvalPlan against the
+// recursive evaluation of ExpressionEvaluator. The segment is a chain of
+// pointwise ops followed by a reduction, evaluated on CPU tensors so no GPU
+// is needed.
+
+namespace {
+
+std::unique_ptr<Fusion> makeChainFusion(int64_t num_ops) {
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+  TensorView* in = makeContigTensor(2);
+  fusion->addInput(in);
+  TensorView* out = in;
+  for (int64_t i = 0; i < num_ops; i++) {
+    out = i % 2 == 0 ? neg(out) : mul(out, IrBuilder::create<Val>(0.5));
+  }
+  fusion->addOutput(out);
+  fusion->addOutput(sum(out, {1}));
+  return fusion;
+}
+
+KernelArgumentHolder makeArgs(const benchmark::State& benchmark_state) {
+  return KernelArgumentHolder(
+      at::randn({benchmark_state.range(1), benchmark_state.range(1)}));
+}
+
+} // namespace
+
+// Fusion inputs are not bound to an ExpressionEvaluator, which only accepts
+// CUDA tensors for them. Neither evaluation needs anything else bound.
+static void ExprEval_Recursive(benchmark::State& benchmark_state) {
+  std::unique_ptr<Fusion> fusion = makeChainFusion(benchmark_state.range(0));
+  KernelArgumentHolder args = makeArgs(benchmark_state);
+
+  const ExpressionEvaluator expr_eval;
+  for (auto _ : benchmark_state) {
+    // Memoizes every intermediate like ExpressionEvaluator::known_values_.
+    std::unordered_map<const Val*, PolymorphicValue> known_values = {
+        {fusion->inputs().at(0), args[0]}};
+    for (Val* out : fusion->outputs()) {
+      benchmark::DoNotOptimize(expr_eval.evaluate(out, known_values));
+    }
+  }
+}
+
+static void ExprEval_Plan(benchmark::State& benchmark_state) {
+  std::unique_ptr<Fusion> fusion = makeChainFusion(benchmark_state.range(0));
+  KernelArgumentHolder args = makeArgs(benchmark_state);
+
+  const ExprEvalPlan plan(fusion.get());
+  benchmark_state.counters["peak_live_values"] =
+      (double)plan.peakLiveValues();
+
+  ExpressionEvaluator expr_eval;
+  for (auto _ : benchmark_state) {
+    benchmark::DoNotOptimize(plan.run(args, expr_eval));
+  }
+}
+
+// {number of ops, extent of each dimension}. Small tensors measure the
+// per-node overhead; large ones also measure allocator pressure.
+BENCHMARK(ExprEval_Recursive)
+    ->ArgsProduct({{8, 64}, {32, 1024}})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(ExprEval_Plan)
+    ->ArgsProduct({{8, 64}, {32, 1024}})
+    ->Unit(benchmark::kMicrosecond);
+
+// The bind/evaluate pattern of each launch: bind the fusion inputs, which
+// also binds their extents, and evaluate the output extents. range(0) is 0
+// for a hash-map-backed evaluator, 1 for a dense one, and 2 for a dense one
+// that is reset instead of recreated, like HostIrEvaluator's. Meta tensors
+// are enough to bind.
+static void ExprEval_BindAndEvaluate(benchmark::State& benchmark_state) {
+  std::unique_ptr<Fusion> fusion = makeChainFusion(8);
+  KernelArgumentHolder args(at::empty({8, 8}, at::device(at::kMeta)));
+  std::vector<Val*> extents;
+  for (auto* out : ir_utils::filterByType<TensorView>(fusion->outputs())) {
+    for (IterDomain* id : out->getLogicalDomain()) {
+      extents.push_back(id->extent());
+    }
+  }
+
+  const int64_t mode = benchmark_state.range(0);
+  ExpressionEvaluator reused(fusion.get());
+  for (auto _ : benchmark_state) {
+    ExpressionEvaluator created =
+        mode == 1 ? ExpressionEvaluator(fusion.get()) : ExpressionEvaluator();
+    if (mode == 2) {
+      reused.reset();
+    }
+    ExpressionEvaluator& expr_eval = mode == 2 ? reused : created;
+    for (auto&& [in, arg] : zip(fusion->inputs(), args)) {
+      expr_eval.bind(in, arg);
+    }
+    expr_eval.bind("cacheId", 0L);
+    for (Val* extent : extents) {
+      benchmark::DoNotOptimize(expr_eval.evaluate(extent));
+    }
+  }
+}
+
+BENCHMARK(ExprEval_BindAndEvaluate)
+    ->DenseRange(0, 2)
+    ->Unit(benchmark::kMicrosecond);
+
+namespace {
+
+// Index-like integer arithmetic on two scalar inputs, with one floating point
+// op mixed in, as in the extents and strides the evaluator computes at launch.
+std::unique_ptr<Fusion> makeScalarFusion(int64_t num_ops) {
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+  Val* a = IrBuilder::create<Val>(DataType::Int);
+  Val* b = IrBuilder::create<Val>(DataType::Int);
+  fusion->addInput(a);
+  fusion->addInput(b);
+  Val* out = a;
+  for (int64_t i = 0; i < num_ops; i++) {
+    switch (i % 4) {
+      case 0:
+        out = add(mul(out, b), a);
+        break;
+      case 1:
+        out = mod(out, IrBuilder::create<Val>(1024L));
+        break;
+      case 2:
+        out = ceilDiv(out, b);
+        break;
+      default:
+        out = add(out, IrBuilder::create<Val>(1L));
+        break;
+    }
+  }
+  fusion->addOutput(out);
+  fusion->addOutput(mul(out, IrBuilder::create<Val>(0.5)));
+  return fusion;
+}
+
+} // namespace
+
+// Cost of scalar ops in the evaluator, where each op is a binary operator on
+// PolymorphicValue. range(0) is the number of ops.
+static void ExprEval_ScalarArithmetic(benchmark::State& benchmark_state) {
+  std::unique_ptr<Fusion> fusion = makeScalarFusion(benchmark_state.range(0));
+  ExpressionEvaluator expr_eval(fusion.get());
+  for (auto _ : benchmark_state) {
+    expr_eval.reset();
+    expr_eval.bind(fusion->inputs().at(0), 7L);
+    expr_eval.bind(fusion->inputs().at(1), 3L);
+    for (Val* out : fusion->outputs()) {
+      benchmark::DoNotOptimize(expr_eval.evaluate(out));
+    }
+  }
+  benchmark_state.SetItemsProcessed(
+      benchmark_state.iterations() * benchmark_state.range(0));
+}
+
+// The binary operators alone, without the evaluator around them.
+static void ExprEval_PolymorphicValueArithmetic(
+    benchmark::State& benchmark_state) {
+  const PolymorphicValue a = 7L;
+  const PolymorphicValue b = 3L;
+  const PolymorphicValue half = 0.5;
+  for (auto _ : benchmark_state) {
+    PolymorphicValue x = a;
+    for (int64_t i = 0; i < 64; i++) {
+      x = (x * b + a) % 1024L;
+    }
+    benchmark::DoNotOptimize(x * half);
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() * 64 * 3);
+}
+
+BENCHMARK(ExprEval_ScalarArithmetic)
+    ->Arg(16)
+    ->Arg(256)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(ExprEval_PolymorphicValueArithmetic)->Unit(benchmark::kNanosecond);
+
+// Like ExprEval_BindAndEvaluate, but on the kernel of a scheduled and
+// lowered layer norm, whose Vals span many more slots than the values bound
+// and evaluated at launch. This is what executor_utils::bindInputs does with
+// a kernel. range(0) selects the evaluator as in ExprEval_BindAndEvaluate.
+static void ExprEval_BindAndEvaluateKernel(benchmark::State& benchmark_state) {
+  Fusion fusion;
+  setupLayerNorm(&fusion, DataType::Half);
+  auto options = at::TensorOptions().dtype(at::kHalf).device(at::kCUDA, 0);
+  KernelArgumentHolder args(
+      at::randn({8192, 1024}, options),
+      at::randn({1024}, options),
+      at::randn({1024}, options));
+  SchedulerEntry::scheduleWith(&fusion, SchedulerType::InnerPersistent, args);
+  GpuLower gpu_lower(&fusion);
+  gpu_lower.run();
+  kir::Kernel* kernel = gpu_lower.kernel();
+
+  std::vector<Val*> extents;
+  for (auto* out : ir_utils::filterByType<TensorView>(kernel->outputs())) {
+    for (IterDomain* id : out->getLogicalDomain()) {
+      extents.push_back(id->extent());
+    }
+  }
+
+  const int64_t mode = benchmark_state.range(0);
+  ExpressionEvaluator reused(kernel);
+  for (auto _ : benchmark_state) {
+    ExpressionEvaluator created =
+        mode == 1 ? ExpressionEvaluator(kernel) : ExpressionEvaluator();
+    if (mode == 2) {
+      reused.reset();
+    }
+    ExpressionEvaluator& expr_eval = mode == 2 ? reused : created;
+    for (auto&& [in, arg] : zip(kernel->inputs(), args)) {
+      expr_eval.bind(in, arg);
+    }
+    for (Val* extent : extents) {
+      benchmark::DoNotOptimize(expr_eval.evaluate(extent));
+    }
+  }
+  benchmark_state.counters["vals"] = (double)kernel->vals().size();
+}
+
+BENCHMARK(ExprEval_BindAndEvaluateKernel)
+    ->DenseRange(0, 2)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,45 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <fusion.h>
+#include <type.h>
+
+namespace nvfuser {
+
+// Fusions shared by the GPU benchmarks and nvfuser_compile_bench, which has
+// to build without their CUDA-only parts.
+
+void setupLayerNorm(Fusion* fusion, DataType dtype);
+
+void setupLayerNorm_BWD(Fusion* fusion, DataType dtype);
+
+void setupRMSNorm_BWD(Fusion* fusion, DataType dtype);
+
+void setupSoftmax(Fusion* fusion, DataType dtype, int reduction_axis);
+
+// Fusions of timm models. `null` is unused; it lets these be passed to
+// NVFUSER_BENCHMARK_DEFINE.
+
+void setup_vit_base_patch16_224_bcast7(Fusion* fusion, void* null);
+
+void setup_vit_base_patch16_224_bcast5(Fusion* fusion, void* null);
+
+void setup_vit_base_patch16_224_bcast_outer2(Fusion* fusion, void* null);
+
+void setup_vit_base_patch16_224_norm_inner3(Fusion* fusion, void* null);
+
+void setup_vit_base_patch16_224_bcast_outer6(Fusion* fusion, void* null);
+
+void setup_vit_base_patch16_224_bcast_inner6(Fusion* fusion, void* null);
+
+void setup_vit_base_patch16_224_LN_BWD(Fusion* fusion, void* null);
+
+void nhwc_seresnet152d_transpose65(Fusion* fusion, void* null);
+
+} // namespace nvfuser
@@ -19,6 +19,7 @@
 
 #include <cuda_runtime.h>
 
+#include <benchmarks/cpp/fusions.h>
 #include <benchmarks/cpp/utils.h>
 #include <tests/cpp/utils.h>
 
@@ -26,45 +27,6 @@ using namespace nvfuser;
 
 //------------------------------------------------------------------------------
 
-static void setupLayerNorm(Fusion* fusion, DataType dtype) {
-  NVF_ERROR(dtype == DataType::Float || dtype == DataType::Half);
-
-  FusionGuard fg(fusion);
-
-  const float kEps = 1e-5;
-
-  Val* eps_ptr = IrBuilder::create<Val>(kEps);
-
-  // setup fusion
-  auto input = makeContigTensor(2, dtype);
-  auto weight = makeContigTensor(1, dtype);
-  auto bias = makeContigTensor(1, dtype);
-
-  fusion->addInput(input);
-  fusion->addInput(weight);
-  fusion->addInput(bias);
-
-  if (dtype == DataType::Half) {
-    input = castOp(DataType::Float, input);
-    weight = castOp(DataType::Float, weight);
-    bias = castOp(DataType::Float, bias);
-  }
-
-  auto layer_norm_results = layer_norm(input, 1, weight, bias, eps_ptr);
-
-  auto output = layer_norm_results.output;
-  auto mean = layer_norm_results.mean;
-  auto invstd = layer_norm_results.invstd;
-
-  if (dtype != DataType::Float) {
-    output = castOp(dtype, output);
-  }
-
-  fusion->addOutput(output);
-  fusion->addOutput(mean);
-  fusion->addOutput(invstd);
-}
-
 static void NvFuserScheduler_LayerNorm(
     benchmark::State& benchmark_state,
     FusionExecutorCache* executor_cache,
@@ -19,6 +19,7 @@
 
 #include <cuda_runtime.h>
 
+#include <benchmarks/cpp/fusions.h>
 #include <benchmarks/cpp/utils.h>
 #include <tests/cpp/utils.h>
 
@@ -26,58 +27,6 @@ using namespace nvfuser;
 
 //------------------------------------------------------------------------------
 
-static void setupLayerNorm_BWD(Fusion* fusion, DataType dtype) {
-  FusionGuard fg(fusion);
-
-  NVF_ERROR(dtype == DataType::Float || dtype == DataType::Half);
-
-  // setup fusion
-  auto grad_out = makeContigTensor(2, dtype);
-  auto input = makeContigTensor(2, dtype);
-  auto weight = makeContigTensor(1, dtype);
-  auto bias = makeContigTensor(1, dtype);
-
-  auto mean = TensorViewBuilder()
-                  .contiguity({false, std::nullopt})
-                  .shape({-1, 1})
-                  .dtype(DataType::Float)
-                  .build();
-  auto rstd = TensorViewBuilder()
-                  .contiguity({false, std::nullopt})
-                  .shape({-1, 1})
-                  .dtype(DataType::Float)
-                  .build();
-
-  fusion->addInput(grad_out);
-  fusion->addInput(input);
-  fusion->addInput(weight);
-  fusion->addInput(bias);
-  fusion->addInput(mean);
-  fusion->addInput(rstd);
-
-  if (dtype == DataType::Half) {
-    grad_out = castOp(DataType::Float, grad_out);
-    input = castOp(DataType::Float, input);
-    weight = castOp(DataType::Float, weight);
-    bias = castOp(DataType::Float, bias);
-  }
-
-  auto layer_norm_results = layer_norm_backward(
-      grad_out, input, {1}, mean, rstd, weight, bias, {true, true, true});
-
-  if (dtype != DataType::Float) {
-    layer_norm_results.grad_input =
-        castOp(dtype, layer_norm_results.grad_input);
-    layer_norm_results.grad_bias = castOp(dtype, layer_norm_results.grad_bias);
-    layer_norm_results.grad_weight =
-        castOp(dtype, layer_norm_results.grad_weight);
-  }
-
-  fusion->addOutput(layer_norm_results.grad_input);
-  fusion->addOutput(layer_norm_results.grad_bias);
-  fusion->addOutput(layer_norm_results.grad_weight);
-}
-
 static void NvFuserScheduler_LayerNorm_BWD(
     benchmark::State& benchmark_state,
     FusionExecutorCache* executor_cache,
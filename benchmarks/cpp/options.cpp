@@ -0,0 +1,118 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <csrc/exceptions.h>
+#include <device_lower/lower2device.h>
+#include <fusion.h>
+#include <ir/all_nodes.h>
+#include <ops/all_ops.h>
+#include <options.h>
+#include <scheduler/registry.h>
+
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <unordered_map>
+
+#include <tests/cpp/utils.h>
+
+using namespace nvfuser;
+
+namespace {
+
+// How options were stored before they were published as snapshots: a map
+// guarded by one mutex that every query takes.
+class MutexGuardedOptions {
+ public:
+  bool has(DisableOption option) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return options_.count(option);
+  }
+
+ private:
+  std::unordered_map<DisableOption, std::vector<std::string>> options_ =
+      Options<DisableOption>::getOptionsFromEnv();
+  mutable std::mutex mutex_;
+};
+
+MutexGuardedOptions& mutexGuardedOptions() {
+  static MutexGuardedOptions options;
+  return options;
+}
+
+constexpr DisableOption kQueriedOptions[] = {
+    DisableOption::ExprSimplify,
+    DisableOption::IndexHoist,
+    DisableOption::MagicZero,
+    DisableOption::PredicateElimination};
+
+} // namespace
+
+// Cost of querying options from many threads at once, as the threads
+// compiling segments in parallel do.
+static void NvFuserScheduler_OptionsQuery(benchmark::State& benchmark_state) {
+  int64_t num_enabled = 0;
+  for (auto _ : benchmark_state) {
+    for (DisableOption option : kQueriedOptions) {
+      num_enabled += isOptionDisabled(option);
+    }
+  }
+  benchmark::DoNotOptimize(num_enabled);
+  benchmark_state.SetItemsProcessed(
+      benchmark_state.iterations() * std::ssize(kQueriedOptions));
+}
+
+static void NvFuserScheduler_OptionsQuery_MutexBaseline(
+    benchmark::State& benchmark_state) {
+  const MutexGuardedOptions& options = mutexGuardedOptions();
+  int64_t num_enabled = 0;
+  for (auto _ : benchmark_state) {
+    for (DisableOption option : kQueriedOptions) {
+      num_enabled += options.has(option);
+    }
+  }
+  benchmark::DoNotOptimize(num_enabled);
+  benchmark_state.SetItemsProcessed(
+      benchmark_state.iterations() * std::ssize(kQueriedOptions));
+}
+
+// Lowers the same scheduled fusion on every benchmark thread, like parallel
+// compilation of segments does. Lowering queries options at hundreds of
+// places, so this shows how much contention on them costs in practice.
+static void NvFuserScheduler_OptionsQuery_ParallelLowering(
+    benchmark::State& benchmark_state) {
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+  TensorView* tv0 = makeContigTensor(2);
+  fusion->addInput(tv0);
+  TensorView* tv1 = sum(exp(tv0), {1});
+  TensorView* tv2 = div(exp(tv0), broadcast(tv1, {false, true}));
+  fusion->addOutput(tv2);
+
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  KernelArgumentHolder args(at::randn({1024, 1024}, options));
+  SchedulerEntry::scheduleWith(
+      fusion.get(), SchedulerType::InnerPersistent, args);
+
+  for (auto _ : benchmark_state) {
+    GpuLower lower(fusion.get());
+    lower.run();
+  }
+}
+
+BENCHMARK(NvFuserScheduler_OptionsQuery)
+    ->ThreadRange(1, 32)
+    ->Unit(benchmark::kNanosecond);
+
+BENCHMARK(NvFuserScheduler_OptionsQuery_MutexBaseline)
+    ->ThreadRange(1, 32)
+    ->Unit(benchmark::kNanosecond);
+
+BENCHMARK(NvFuserScheduler_OptionsQuery_ParallelLowering)
+    ->ThreadRange(1, 16)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
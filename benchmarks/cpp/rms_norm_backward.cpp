@@ -19,6 +19,7 @@
 
 #include <cuda_runtime.h>
 
+#include <benchmarks/cpp/fusions.h>
 #include <benchmarks/cpp/utils.h>
 #include <tests/cpp/utils.h>
 
@@ -26,47 +27,6 @@ using namespace nvfuser;
 
 //------------------------------------------------------------------------------
 
-static void setupRMSNorm_BWD(Fusion* fusion, DataType dtype) {
-  FusionGuard fg(fusion);
-
-  NVF_ERROR(
-      dtype == DataType::Float || dtype == DataType::Half ||
-      dtype == DataType::BFloat16);
-
-  // setup fusion
-  auto grad_out = makeContigTensor(2, dtype);
-  auto input = makeContigTensor(2, dtype);
-  auto weight = makeContigTensor(1, dtype);
-  auto rstd = TensorViewBuilder()
-                  .contiguity({false, std::nullopt})
-                  .shape({-1, 1})
-                  .dtype(dtype)
-                  .build();
-
-  fusion->addInput(grad_out);
-  fusion->addInput(input);
-  fusion->addInput(weight);
-  fusion->addInput(rstd);
-
-  if (dtype == DataType::Half) {
-    grad_out = castOp(DataType::Float, grad_out);
-    input = castOp(DataType::Float, input);
-    weight = castOp(DataType::Float, weight);
-    rstd = castOp(DataType::Float, rstd);
-  }
-
-  auto rms_norm_results =
-      rms_norm_backward(grad_out, input, {1}, rstd, weight, {true, true, true});
-
-  if (dtype != DataType::Float) {
-    rms_norm_results.grad_input = castOp(dtype, rms_norm_results.grad_input);
-    rms_norm_results.grad_weight = castOp(dtype, rms_norm_results.grad_weight);
-  }
-
-  fusion->addOutput(rms_norm_results.grad_input);
-  fusion->addOutput(rms_norm_results.grad_weight);
-}
-
 static void NvFuserScheduler_RMSNorm_BWD(
     benchmark::State& benchmark_state,
     FusionExecutorCache* executor_cache,
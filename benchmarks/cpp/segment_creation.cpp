@@ -0,0 +1,112 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <csrc/exceptions.h>
+#include <fusion.h>
+#include <fusion_segmenter.h>
+#include <ir/all_nodes.h>
+#include <ops/all_ops.h>
+#include <runtime/executor_kernel_arg.h>
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/cpp/utils.h>
+#include <tests/cpp/utils.h>
+
+using namespace nvfuser;
+
+namespace {
+
+constexpr int64_t kBatch = 8;
+constexpr int64_t kHidden = 1024;
+
+// Builds `num_layers` transformer-style MLP blocks, i.e.,
+//   x = x + gelu(layer_norm(x) * w1) * w2
+// separated by segment_set so the fusion has roughly one segment per layer,
+// and segments it.
+std::unique_ptr<SegmentedFusion> segmentTransformerBlocks(int64_t num_layers) {
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+
+  TensorView* x = makeContigTensor(2, DataType::BFloat16);
+  TensorView* w1 = makeContigTensor(1, DataType::BFloat16);
+  TensorView* w2 = makeContigTensor(1, DataType::BFloat16);
+  fusion->addInput(x);
+  fusion->addInput(w1);
+  fusion->addInput(w2);
+
+  TensorView* hidden = castOp(DataType::Float, x);
+  for ([[maybe_unused]] auto i : arange(num_layers)) {
+    auto norm = layer_norm(
+        hidden,
+        /*norm_shape=*/std::vector<int64_t>{kHidden},
+        /*weight=*/nullptr,
+        /*bias=*/nullptr,
+        IrBuilder::create<Val>(1e-5));
+    TensorView* up = mul(norm.output, broadcast(w1, {true, false}));
+    TensorView* down = mul(gelu(up), broadcast(w2, {true, false}));
+    hidden = segment_set(add(hidden, down));
+  }
+  fusion->addOutput(castOp(DataType::BFloat16, hidden));
+
+  auto options = at::TensorOptions().dtype(at::kBFloat16).device(at::kCUDA, 0);
+  KernelArgumentHolder args(
+      at::randn({kBatch, kHidden}, options),
+      at::randn({kHidden}, options),
+      at::randn({kHidden}, options));
+  return SegmentCandidateFinder::segment(std::move(fusion), args);
+}
+
+} // namespace
+
+// Time to create the Fusion of every segment, which FusionKernelRuntime does
+// for every segment on every compilation.
+static void NvFuserScheduler_SegmentCreation(
+    benchmark::State& benchmark_state) {
+  std::unique_ptr<SegmentedFusion> segmented_fusion =
+      segmentTransformerBlocks(benchmark_state.range(0));
+
+  for (auto _ : benchmark_state) {
+    for (SegmentedGroup* group : segmented_fusion->groups()) {
+      benchmark::DoNotOptimize(segmented_fusion->makeFusion(group));
+    }
+  }
+
+  benchmark_state.counters["segments"] =
+      static_cast<double>(segmented_fusion->groups().size());
+  benchmark_state.counters["complete_fusion_exprs"] = static_cast<double>(
+      segmented_fusion->completeFusion()->unordered_exprs().size());
+}
+
+// Baseline: cloning the complete fusion once per segment, which is what
+// creating a segment used to cost.
+static void NvFuserScheduler_SegmentCreation_CompleteCopyBaseline(
+    benchmark::State& benchmark_state) {
+  std::unique_ptr<SegmentedFusion> segmented_fusion =
+      segmentTransformerBlocks(benchmark_state.range(0));
+
+  for (auto _ : benchmark_state) {
+    for ([[maybe_unused]] SegmentedGroup* group : segmented_fusion->groups()) {
+      Fusion copy;
+      benchmark::DoNotOptimize(
+          Fusion::copy(segmented_fusion->completeFusion(), &copy));
+    }
+  }
+
+  benchmark_state.counters["segments"] =
+      static_cast<double>(segmented_fusion->groups().size());
+}
+
+BENCHMARK(NvFuserScheduler_SegmentCreation)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(NvFuserScheduler_SegmentCreation_CompleteCopyBaseline)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Unit(benchmark::kMillisecond);
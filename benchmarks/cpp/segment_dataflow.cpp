@@ -0,0 +1,139 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <csrc/exceptions.h>
+#include <fusion.h>
+#include <fusion_segmenter.h>
+#include <ir/all_nodes.h>
+#include <ops/all_ops.h>
+#include <runtime/executor_kernel_arg.h>
+#include <runtime/fusion_cache_utils.h>
+#include <runtime/fusion_executor_cache.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cuda_runtime.h>
+
+#include <benchmarks/cpp/utils.h>
+#include <tests/cpp/utils.h>
+
+using namespace nvfuser;
+
+namespace {
+
+constexpr int64_t kSize = 16;
+
+// `num_tensors` small inputs mixed with their neighbors `num_layers` times.
+// Every layer ends with segment_set, so the fusion has about one segment
+// per layer and each segment passes all the tensors on to the next.
+std::unique_ptr<Fusion> makeManySmallTensorsFusion(
+    int64_t num_tensors,
+    int64_t num_layers) {
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+
+  std::vector<TensorView*> tvs;
+  for ([[maybe_unused]] auto i : arange(num_tensors)) {
+    TensorView* in = makeContigTensor(1);
+    fusion->addInput(in);
+    tvs.push_back(in);
+  }
+  for ([[maybe_unused]] auto layer : arange(num_layers)) {
+    std::vector<TensorView*> next;
+    for (auto i : arange(num_tensors)) {
+      next.push_back(
+          segment_set(add(tvs.at(i), tvs.at((i + 1) % num_tensors))));
+    }
+    tvs = std::move(next);
+  }
+  for (TensorView* tv : tvs) {
+    fusion->addOutput(neg(tv));
+  }
+  return fusion;
+}
+
+KernelArgumentHolder makeArgs(int64_t num_tensors) {
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  KernelArgumentHolder args;
+  for ([[maybe_unused]] auto i : arange(num_tensors)) {
+    args.push(at::randn({kSize}, options));
+  }
+  return args;
+}
+
+} // namespace
+
+// Host cost of passing arguments between segments: binding the fusion
+// inputs, gathering the inputs of each segment and storing its outputs. The
+// segments aren't run; each one "produces" preallocated tensors.
+static void NvFuserScheduler_SegmentDataflow(
+    benchmark::State& benchmark_state) {
+  const int64_t num_tensors = benchmark_state.range(0);
+  KernelArgumentHolder args = makeArgs(num_tensors);
+  std::unique_ptr<SegmentedFusion> segmented_fusion =
+      SegmentCandidateFinder::segment(
+          makeManySmallTensorsFusion(num_tensors, benchmark_state.range(1)),
+          args);
+
+  RuntimeWorkSpace workspace;
+  prepareRuntimeOrder(segmented_fusion.get(), workspace);
+  const SegmentDataflowPlan plan(
+      workspace, segmented_fusion->inputs(), segmented_fusion->outputs());
+
+  std::vector<KernelArgumentHolder> segment_outputs;
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  for (SegmentedGroup* group : workspace.group_run_order) {
+    KernelArgumentHolder& outputs = segment_outputs.emplace_back();
+    for ([[maybe_unused]] Val* out : group->outputs()) {
+      outputs.push(at::empty({kSize}, options));
+    }
+  }
+
+  for (auto _ : benchmark_state) {
+    std::vector<PolymorphicValue> slots = plan.bindInputs(args);
+    for (auto run_order_id : arange(std::ssize(segment_outputs))) {
+      benchmark::DoNotOptimize(plan.segmentInputs(slots, run_order_id));
+      plan.storeSegmentOutputs(
+          slots, segment_outputs[run_order_id], run_order_id);
+    }
+    benchmark::DoNotOptimize(plan.takeFusionOutputs(slots));
+  }
+
+  benchmark_state.counters["segments"] =
+      static_cast<double>(workspace.group_run_order.size());
+  benchmark_state.counters["slots"] = static_cast<double>(plan.numSlots());
+}
+
+// Host latency of running the same fusion end to end, dominated by launch
+// overhead since the tensors are tiny.
+static void NvFuserScheduler_SegmentDataflow_RunFusion(
+    benchmark::State& benchmark_state) {
+  const int64_t num_tensors = benchmark_state.range(0);
+  KernelArgumentHolder args = makeArgs(num_tensors);
+  FusionExecutorCache executor_cache(
+      makeManySmallTensorsFusion(num_tensors, benchmark_state.range(1)));
+  // Compile outside of the measurement.
+  executor_cache.runFusionWithInputs(args);
+
+  for (auto _ : benchmark_state) {
+    benchmark::DoNotOptimize(executor_cache.runFusionWithInputs(args));
+  }
+  NVFUSER_CUDA_RT_SAFE_CALL(cudaDeviceSynchronize());
+
+  FusionKernelRuntime* runtime = executor_cache.getMostRecentKernelRuntime();
+  benchmark_state.counters["segments"] =
+      static_cast<double>(runtime->fusionSegments()->groups().size());
+}
+
+// {number of tensors, number of layers}
+BENCHMARK(NvFuserScheduler_SegmentDataflow)
+    ->ArgsProduct({{8, 64}, {2, 8}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(NvFuserScheduler_SegmentDataflow_RunFusion)
+    ->ArgsProduct({{8, 64}, {2, 8}})
+    ->Unit(benchmark::kMicrosecond);
@@ -19,6 +19,7 @@
 
 #include <cuda_runtime.h>
 
+#include <benchmarks/cpp/fusions.h>
 #include <benchmarks/cpp/utils.h>
 #include <tests/cpp/utils.h>
 
@@ -26,30 +27,6 @@ using namespace nvfuser;
 
 //------------------------------------------------------------------------------
 
-static void setupSoftmax(
-    Fusion* fusion,
-    DataType dtype,
-    const int reduction_axis) {
-  NVF_ERROR(dtype == DataType::Float || dtype == DataType::Half);
-
-  FusionGuard fg(fusion);
-  // setup fusion
-  auto input = makeContigTensor(2, dtype);
-  fusion->addInput(input);
-
-  if (dtype == DataType::Half) {
-    input = castOp(DataType::Float, input);
-  }
-
-  auto output = softmax(input, reduction_axis);
-
-  if (dtype == DataType::Half) {
-    output = castOp(DataType::Half, output);
-  }
-
-  fusion->addOutput(output);
-}
-
 static void NvFuserScheduler_Softmax(
     benchmark::State& benchmark_state,
     FusionExecutorCache* executor_cache,
@@ -160,21 +160,220 @@ class CudaKernelGenerator : private kir::ConstIrVisitor {
       const kir::Kernel* kernel,
       const std::string& kernel_name,
       const LaunchParams& lparams) {
-    CudaKernelGenerator codegen(kernel);
-    codegen.lparams_ = lparams;
-    codegen.has_warp_specialized_ =
-        kernel->summary().circular_buffer_info.hasWarpSpecialized();
-    codegen.warp_specialized_on_ =
-        kernel->summary().circular_buffer_info.getWarpSpecializedOn();
-    codegen.genDeclaration(kernel_name);
-    codegen.startBlock();
-    codegen.genPrologue();
-    codegen.genBody();
-    codegen.endBlock();
-    NVF_CHECK(codegen.block_nest_level_ == 0);
+    CudaKernelGenerator codegen(kernel, lparams);
+    codegen.genDefinition(kernel_name, /*horizontal_segment=*/false);
     std::stringstream final_code;
     final_code << "// Codegen generated code\n";
-    for (const auto& [ns, code] : codegen.utilities_) {
+    genUtilities(final_code, codegen.utilities_);
+    final_code << codegen.code_.str();
+    return final_code.str();
+  }
+
+  //! Generates each kernel as a device function taking gridDim and blockIdx
+  //! as parameters, and a kernel that runs each of them on its own range of
+  //! blocks:
+  //!
+  //!   __global__ void kernel_name(
+  //!       Tensor<float, 1, 1> s0_p0, ..., const dim3 s0_grid_dim,
+  //!       Tensor<float, 2, 2> s1_p0, ..., const dim3 s1_grid_dim) {
+  //!     nvfuser_index_t block_offset = blockIdx.x;
+  //!     if (block_offset < index_utils::size(s0_grid_dim)) {
+  //!       kernel_name_segment0(s0_p0, ..., s0_grid_dim,
+  //!           index_utils::unlinearize(block_offset, s0_grid_dim));
+  //!       return;
+  //!     }
+  //!     block_offset -= index_utils::size(s0_grid_dim);
+  //!     kernel_name_segment1(s1_p0, ..., s1_grid_dim,
+  //!         index_utils::unlinearize(block_offset, s1_grid_dim));
+  //!   }
+  //!
+  //! The parameters of the segment functions shadow the gridDim and blockIdx
+  //! built-ins, so the code generated for each kernel is unchanged. All
+  //! segments must be launched with the same block size.
+  static std::string generateHorizontalKernelDefinition(
+      const std::vector<const kir::Kernel*>& kernels,
+      const std::string& kernel_name) {
+    NVF_ERROR(!kernels.empty());
+    // Utilities are shared by all segments so that each is defined once.
+    std::map<std::string, std::stringstream> utilities;
+    std::unordered_set<std::string> generated_utilities;
+    std::stringstream segments_code;
+    std::vector<std::vector<std::string>> param_types;
+    for (auto i : arange(std::ssize(kernels))) {
+      const kir::Kernel* kernel = kernels.at(i);
+      // Segments are generated without launch parameters, which only
+      // kernels using static block sizes need.
+      NVF_ERROR(
+          !kernel->summary().has_iter_grouped_reductions &&
+              !kernel->summary().circular_buffer_info.hasWarpSpecialized() &&
+              !kernel->hasManaged("enable_register_sharing"),
+          "Kernels using static block sizes can't be horizontally fused.");
+      CudaKernelGenerator codegen(kernel, LaunchParams());
+      codegen.utilities_ = std::move(utilities);
+      codegen.generated_utilities_ = std::move(generated_utilities);
+      codegen.genDefinition(
+          horizontalSegmentName(kernel_name, i), /*horizontal_segment=*/true);
+      segments_code << codegen.code_.str() << "\n";
+      std::vector<std::string>& types = param_types.emplace_back();
+      for (Val* param : kernel->parameters()) {
+        types.push_back(codegen.genParamType(param));
+      }
+      utilities = std::move(codegen.utilities_);
+      generated_utilities = std::move(codegen.generated_utilities_);
+    }
+
+    auto param_name = [](int64_t segment, int64_t param) {
+      return "s" + std::to_string(segment) + "_p" + std::to_string(param);
+    };
+    auto grid_dim_name = [](int64_t segment) {
+      return "s" + std::to_string(segment) + "_grid_dim";
+    };
+
+    std::stringstream final_code;
+    final_code << "// Codegen generated code\n";
+    genUtilities(final_code, utilities);
+    final_code << segments_code.str();
+
+    const int64_t num_segments = std::ssize(kernels);
+    ArgumentBuilder declaration(2, kTab);
+    for (auto i : arange(num_segments)) {
+      for (auto j : arange(std::ssize(param_types.at(i)))) {
+        declaration.arg(param_types.at(i).at(j))
+            .append(" ")
+            .append(param_name(i, j));
+      }
+      declaration.arg("const dim3 ").append(grid_dim_name(i));
+    }
+    final_code << "__global__ void " << kernel_name << "(\n"
+               << kTab << kTab << declaration << ") {\n";
+    final_code << kTab << "nvfuser_index_t block_offset = blockIdx.x;\n";
+    for (auto i : arange(num_segments)) {
+      const std::string grid_size =
+          genCall("index_utils::size", grid_dim_name(i));
+      ArgumentBuilder call_args;
+      for (auto j : arange(std::ssize(param_types.at(i)))) {
+        call_args.arg(param_name(i, j));
+      }
+      call_args.arg(grid_dim_name(i));
+      call_args.arg(genCall(
+          "index_utils::unlinearize",
+          ArgumentBuilder().arg("block_offset").arg(grid_dim_name(i))));
+      const std::string call =
+          genCall(horizontalSegmentName(kernel_name, i), call_args);
+      // The grid has as many blocks as all segments together, so the last
+      // segment runs on the rest of the blocks.
+      if (i + 1 == num_segments) {
+        final_code << kTab << call << ";\n";
+        break;
+      }
+      final_code << kTab << "if (block_offset < " << grid_size << ") {\n"
+                 << kTab << kTab << call << ";\n"
+                 << kTab << kTab << "return;\n"
+                 << kTab << "}\n"
+                 << kTab << "block_offset -= " << grid_size << ";\n";
+    }
+    final_code << "}\n";
+    return final_code.str();
+  }
+
+  static std::string generateForEachKernelDefinition(
+      const kir::Kernel* kernel,
+      const std::string& kernel_name) {
+    // Like a segment of a horizontal kernel, the chunk kernel is a device
+    // function taking gridDim and blockIdx, so it can be given a grid of one
+    // block.
+    NVF_ERROR(
+        !kernel->summary().has_iter_grouped_reductions &&
+            !kernel->summary().circular_buffer_info.hasWarpSpecialized() &&
+            !kernel->hasManaged("enable_register_sharing"),
+        "Kernels using static block sizes can't run on chunks.");
+    const std::string chunk_name = kernel_name + "_chunk";
+    CudaKernelGenerator codegen(kernel, LaunchParams());
+    codegen.genDefinition(chunk_name, /*horizontal_segment=*/true);
+
+    std::stringstream final_code;
+    final_code << "// Codegen generated code\n";
+    genUtilities(final_code, codegen.utilities_);
+    final_code << codegen.code_.str() << "\n";
+
+    // Scalars are passed through. Tensors are views of the chunk from the
+    // table, see foreach_utils::getChunkTableLayout.
+    ArgumentBuilder declaration(2, kTab);
+    declaration.arg("const char* __restrict__ table");
+    ArgumentBuilder call_args;
+    std::stringstream tensors;
+    int64_t num_tensors = 0;
+    for (auto&& [i, param] : enumerate(kernel->parameters())) {
+      const std::string name = "p" + std::to_string(i);
+      call_args.arg(name);
+      if (!param->isA<TensorView>()) {
+        declaration.arg(codegen.genParamType(param)).append(" ").append(name);
+        continue;
+      }
+      auto* tv = param->as<TensorView>();
+      NVF_ERROR(
+          !tv->isCpuScalar() &&
+              TensorDomain::noReductions(tv->getLogicalDomain()).size() == 1 &&
+              TensorDomain::noReductions(tv->getMaybeAllocationDomain())
+                      .size() == 1,
+          "Tensors of a chunk kernel must be 1D: ",
+          tv->toString());
+      tensors << kTab << codegen.genParamType(param) << " " << name << ";\n"
+              << kTab << name << ".data = static_cast<" << tv->dtype()
+              << "*>(group_data[" << num_tensors++ << "]) + chunk_offset;\n"
+              << kTab << name << ".logical_size[0] = chunk_numel;\n"
+              << kTab << name << ".alloc_stride[0] = 1;\n";
+    }
+    call_args.arg("dim3(1, 1, 1)").arg("uint3{0, 0, 0}");
+
+    final_code << "__global__ void " << kernel_name << "(\n"
+               << kTab << kTab << declaration << ") {\n";
+    final_code
+        << kTab << "const nvfuser_index_t num_chunks = gridDim.x;\n"
+        << kTab << "const nvfuser_index_t chunk = blockIdx.x;\n"
+        << kTab << "const nvfuser_index_t* chunk_groups =\n"
+        << kTab << kTab
+        << "reinterpret_cast<const nvfuser_index_t*>(table);\n"
+        << kTab
+        << "const nvfuser_index_t chunk_offset = chunk_groups[num_chunks + "
+           "chunk];\n"
+        << kTab
+        << "const nvfuser_index_t chunk_numel = chunk_groups[2 * num_chunks + "
+           "chunk];\n"
+        << kTab << "constexpr nvfuser_index_t ptr_size = sizeof(void*);\n"
+        << kTab
+        << "void* const* group_data = reinterpret_cast<void* const*>(table +\n"
+        << kTab << kTab
+        << "(3 * num_chunks * (nvfuser_index_t)sizeof(nvfuser_index_t) + "
+           "ptr_size - 1) / ptr_size * ptr_size) +\n"
+        << kTab << kTab << "chunk_groups[chunk] * " << num_tensors << ";\n";
+    final_code << tensors.str();
+    final_code << kTab << genCall(chunk_name, call_args) << ";\n";
+    final_code << "}\n";
+    return final_code.str();
+  }
+
+  static std::string horizontalSegmentName(
+      const std::string& kernel_name,
+      int64_t segment) {
+    return kernel_name + "_segment" + std::to_string(segment);
+  }
+
+ private:
+  CudaKernelGenerator(const kir::Kernel* kernel, const LaunchParams& lparams)
+      : kernel_(kernel),
+        lparams_(lparams),
+        has_warp_specialized_(
+            kernel->summary().circular_buffer_info.hasWarpSpecialized()),
+        warp_specialized_on_(
+            kernel->summary().circular_buffer_info.getWarpSpecializedOn()) {
+    initStringStreamFormat(code_);
+  }
+
+  static void genUtilities(
+      std::stringstream& final_code,
+      const std::map<std::string, std::stringstream>& utilities) {
+    for (const auto& [ns, code] : utilities) {
       if (!ns.empty()) {
         final_code << "namespace " << ns << " {\n"
                    << code.str() << "} // namespace " << ns << "\n";
@@ -182,13 +381,16 @@ class CudaKernelGenerator : private kir::ConstIrVisitor {
         final_code << code.str() << "\n";
       }
     }
-    final_code << codegen.code_.str();
-    return final_code.str();
   }
 
- private:
-  explicit CudaKernelGenerator(const kir::Kernel* kernel) : kernel_(kernel) {
-    initStringStreamFormat(code_);
+  // Generates the declaration and the body of the kernel
+  void genDefinition(const std::string& kernel_name, bool horizontal_segment) {
+    genDeclaration(kernel_name, horizontal_segment);
+    startBlock();
+    genPrologue();
+    genBody();
+    endBlock();
+    NVF_CHECK(block_nest_level_ == 0);
   }
 
   // aligned array of registers used in the kernel
@@ -290,9 +492,36 @@ class CudaKernelGenerator : private kir::ConstIrVisitor {
     }
   }
 
-  // Generates the kernel function declaration
-  void genDeclaration(const std::string& kernel_name) {
-    code_ << "__global__ void ";
+  // Type of a kernel parameter in the kernel function declaration
+  std::string genParamType(Val* param) {
+    std::stringstream type;
+    if (const auto tv = dynamic_cast<TensorView*>(param)) {
+      if (tv->isCpuScalar()) {
+        type << " CpuScalarTensor<" << param->dtype() << ">";
+      } else {
+        type << "Tensor<" << param->dtype() << ", "
+             << TensorDomain::noReductions(tv->getLogicalDomain()).size()
+             << ", "
+             << TensorDomain::noReductions(tv->getMaybeAllocationDomain())
+                    .size()
+             << ">";
+      }
+    } else {
+      NVF_ERROR(param->isScalar()); // NOLINT (LLVM bug 48525)
+      if (isTmaType(param->dtype())) {
+        type << "const __grid_constant__ " << param->dtype();
+      } else {
+        type << param->dtype();
+      }
+    }
+    return type.str();
+  }
+
+  // Generates the kernel function declaration. A segment of a horizontal
+  // kernel is a device function that takes gridDim and blockIdx as
+  // parameters. See generateHorizontalKernelDefinition.
+  void genDeclaration(const std::string& kernel_name, bool horizontal_segment) {
+    code_ << (horizontal_segment ? "__device__ void " : "__global__ void ");
     if (kernel_->hasManaged("enable_register_sharing") &&
         kernel_->getManaged<bool>("enable_register_sharing")) {
       int64_t num_threads_per_cta = lparams_.nThreads();
@@ -357,32 +586,15 @@ class CudaKernelGenerator : private kir::ConstIrVisitor {
         var_name_ss << "_duplicate_" << duplicate_counter++;
       }
 
-      if (const auto tv = dynamic_cast<TensorView*>(param)) {
-        if (tv->isCpuScalar()) {
-          code_ << " CpuScalarTensor<" << param->dtype() << "> "
-                << var_name_ss.str();
-        } else {
-          code_ << "Tensor<" << param->dtype() << ", "
-                << TensorDomain::noReductions(tv->getLogicalDomain()).size()
-                << ", "
-                << TensorDomain::noReductions(tv->getMaybeAllocationDomain())
-                       .size()
-                << "> " << var_name_ss.str();
-        }
-      } else {
-        NVF_ERROR(param->isScalar()); // NOLINT (LLVM bug 48525)
-        if (isTmaType(param->dtype())) {
-          code_ << "const __grid_constant__ " << param->dtype() << " "
-                << var_name_ss.str();
-        } else {
-          code_ << param->dtype() << " " << var_name_ss.str();
-        }
-      }
+      code_ << genParamType(param) << " " << var_name_ss.str();
 
       if (i + 1 != kernel_->parameters().size()) {
         code_ << ", ";
       }
     }
+    if (horizontal_segment) {
+      code_ << ", const dim3 gridDim, const uint3 blockIdx";
+    }
 
     code_ << ") ";
   }
@@ -3871,11 +4083,11 @@ class CudaKernelGenerator : private kir::ConstIrVisitor {
   //! Utility names already generated
   std::unordered_set<std::string> generated_utilities_;
   //! iterGroupedStaticWarpAllReduce requires static threads per CTA
-  LaunchParams lparams_;
+  const LaunchParams lparams_;
   //! Whether the kernel has warp specialization
-  bool has_warp_specialized_ = false;
+  const bool has_warp_specialized_ = false;
   //! Warp specialized on parallel type
-  ParallelType warp_specialized_on_ = ParallelType::Serial;
+  const ParallelType warp_specialized_on_ = ParallelType::Serial;
 };
 
 } // namespace
@@ -3889,5 +4101,21 @@ std::string generateCudaKernel(
       kernel, kernel_name, lparams);
 }
 
+std::string generateHorizontalCudaKernel(
+    const std::vector<const kir::Kernel*>& kernels,
+    const std::string& kernel_name) {
+  FUSER_PERF_SCOPE("generateHorizontalCudaKernel");
+  return CudaKernelGenerator::generateHorizontalKernelDefinition(
+      kernels, kernel_name);
+}
+
+std::string generateForEachCudaKernel(
+    const kir::Kernel* kernel,
+    const std::string& kernel_name) {
+  FUSER_PERF_SCOPE("generateForEachCudaKernel");
+  return CudaKernelGenerator::generateForEachKernelDefinition(
+      kernel, kernel_name);
+}
+
 } // namespace codegen
 } // namespace nvfuser
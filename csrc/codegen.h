@@ -12,6 +12,7 @@
 #include <visibility.h>
 
 #include <string>
+#include <vector>
 
 namespace nvfuser {
 namespace codegen {
@@ -22,5 +23,26 @@ NVF_API std::string generateCudaKernel(
     const std::string& kernel_name = "CUDAGeneratedKernel",
     const LaunchParams& lparams = LaunchParams());
 
+//! Generates a CUDA kernel that runs each of the given kernels on its own
+//! range of blocks, so that independent kernels can be launched at once. The
+//! kernel takes the parameters of each kernel in order, each followed by the
+//! grid dimensions to run it with, and is launched with a 1D grid of their
+//! total number of blocks. All kernels must use the same block dimensions and
+//! index type, and none may depend on static launch parameters.
+NVF_API std::string generateHorizontalCudaKernel(
+    const std::vector<const kir::Kernel*>& kernels,
+    const std::string& kernel_name);
+
+//! Generates a CUDA kernel that runs the given kernel on a chunk of 1D
+//! tensors per block, reading the tensors from a chunk table in global
+//! memory (see foreach_utils::getChunkTableLayout). The kernel takes the
+//! address of the table followed by the scalar parameters of the given
+//! kernel, and is launched with a block per chunk. Every tensor parameter of
+//! the given kernel must be 1D, and the table holds their data pointers in
+//! the order of the kernel parameters.
+NVF_API std::string generateForEachCudaKernel(
+    const kir::Kernel* kernel,
+    const std::string& kernel_name);
+
 } // namespace codegen
 } // namespace nvfuser
@@ -31,6 +31,7 @@
 #include <device_lower/pass/unroll.h>
 #include <device_lower/pass/vectorize_welford.h>
 #include <device_lower/pass/warp_reduce.h>
+#include <device_lower/task_graph.h>
 #include <device_lower/utils.h>
 #include <device_lower/validation.h>
 #include <expr_simplifier.h>
@@ -299,17 +300,14 @@ GpuLower::GpuLower(Fusion* fusion, const CompileParams& cparams)
   analysis(fusion);
 }
 
-namespace {
-struct LowerGuard {
-  LowerGuard(GpuLower* gpu_lower) {
-    active_gpu_lower = gpu_lower;
-  }
-  ~LowerGuard() {
-    active_gpu_lower = nullptr;
-  }
-};
+LowerGuard::LowerGuard(GpuLower* gpu_lower)
+    : prev_gpu_lower_(active_gpu_lower) {
+  active_gpu_lower = gpu_lower;
+}
 
-} // namespace
+LowerGuard::~LowerGuard() {
+  active_gpu_lower = prev_gpu_lower_;
+}
 
 kir::Kernel* GpuLower::run() {
   FusionGuard fg(fusion_);
@@ -333,6 +331,11 @@ kir::Kernel* GpuLower::run() {
     dumpExprsIfEnabled(exprs_lowered, name);
   }
 
+  if (isTensorIndexerEnabled() &&
+      isDebugDumpEnabled(DebugDumpOption::IndexingVerbose)) {
+    debug() << tensorIndexer().cacheStats().toString();
+  }
+
   // We now have the lowered expressions, finalize the kernel IR. This function
   // will also copy over some relevant information for code generation from
   // GpuLower.
@@ -533,87 +536,199 @@ void GpuLower::analysis(Fusion* fusion) {
   compute_at_map_->validateAndPropagatePType();
   dumpExprsIfEnabled(fusion_->exprs(), "validateAndPropagatePType");
 
+  // The analyses below declare what they read and write, and independent
+  // ones run concurrently. Those creating or modifying IR nodes write
+  // FusionIr, so they run alone and in this order.
+  using R = LowerResource;
+  LowerTaskGraph analyses;
+
   // Uses compute_at_map, find all splits that are enforced to be divisible
-  divisible_splits_ = getAllDivisibleSplits(fusion_, compute_at_map_.get());
-  dumpExprsIfEnabled(fusion_->exprs(), "getAllDivisibleSplits");
+  analyses.add(
+      "getAllDivisibleSplits",
+      {R::FusionIr, R::ComputeAtMap, R::IdModel},
+      {R::DivisibleSplits},
+      [this]() {
+        divisible_splits_ =
+            getAllDivisibleSplits(fusion_, compute_at_map_.get());
+        dumpExprsIfEnabled(fusion_->exprs(), "getAllDivisibleSplits");
+      });
 
   // Used in parallel dimension map
-  concretized_broadcast_domains_ =
-      std::make_shared<const ConcretizedBroadcastDomains>(fusion_);
-  dumpExprsIfEnabled(fusion_->exprs(), "build ConcretizedBroadcastDomains");
-
-  parallelDimensionMap().build(fusion_);
-  if (isDebugDumpEnabled(DebugDumpOption::ParallelDimensions)) {
-    debug() << "Parallel dimension map:" << std::endl;
-    debug() << parallel_dimension_map_.toString() << std::endl;
-  }
-  dumpExprsIfEnabled(fusion_->exprs(), "build parallelDimensionMap");
+  analyses.add(
+      "build ConcretizedBroadcastDomains",
+      {R::FusionIr},
+      {R::ConcretizedBroadcastDomains},
+      [this]() {
+        concretized_broadcast_domains_ =
+            std::make_shared<const ConcretizedBroadcastDomains>(fusion_);
+        dumpExprsIfEnabled(
+            fusion_->exprs(), "build ConcretizedBroadcastDomains");
+      });
+
+  analyses.add(
+      "build parallelDimensionMap",
+      {R::ComputeAtMap, R::ConcretizedBroadcastDomains},
+      {R::FusionIr, R::ParallelDimensionMap},
+      [this]() {
+        parallelDimensionMap().build(fusion_);
+        if (isDebugDumpEnabled(DebugDumpOption::ParallelDimensions)) {
+          debug() << "Parallel dimension map:" << std::endl;
+          debug() << parallel_dimension_map_.toString() << std::endl;
+        }
+        dumpExprsIfEnabled(fusion_->exprs(), "build parallelDimensionMap");
+      });
 
-  validate1dTmaLoad(fusion_);
-  dumpExprsIfEnabled(fusion_->exprs(), "validate1dTmaLoad");
+  // Adds runtime validations of split divisibility.
+  analyses.add(
+      "validate1dTmaLoad", {}, {R::FusionIr, R::Validations}, [this]() {
+        validate1dTmaLoad(fusion_);
+        dumpExprsIfEnabled(fusion_->exprs(), "validate1dTmaLoad");
+      });
 
   // Validate mma data format and compatibility if any on the fusion.
-  validateMma(fusion_);
-  dumpExprsIfEnabled(fusion_->exprs(), "validateMma");
+  analyses.add("validateMma", {R::FusionIr}, {}, [this]() {
+    validateMma(fusion_);
+    dumpExprsIfEnabled(fusion_->exprs(), "validateMma");
+  });
 
   // Validate swizzle usage on the fusion schedule.
-  validateSwizzle(fusion_);
-  dumpExprsIfEnabled(fusion_->exprs(), "validateSwizzle");
+  analyses.add(
+      "validateSwizzle", {R::FusionIr, R::ComputeAtMap}, {}, [this]() {
+        validateSwizzle(fusion_);
+        dumpExprsIfEnabled(fusion_->exprs(), "validateSwizzle");
+      });
 
-  validateReductions(fusion_);
-  dumpExprsIfEnabled(fusion_->exprs(), "validateReductions");
+  analyses.add("validateReductions", {R::FusionIr}, {}, [this]() {
+    validateReductions(fusion_);
+    dumpExprsIfEnabled(fusion_->exprs(), "validateReductions");
+  });
 
   // Compute thread predicates. Depends on parallel_dimension_map_
-  thread_pred_map_.build(fusion_);
-  dumpExprsIfEnabled(fusion_->exprs(), "build thread_pred_map_");
+  analyses.add(
+      "build thread_pred_map_",
+      {R::ComputeAtMap,
+       R::ConcretizedBroadcastDomains,
+       R::ParallelDimensionMap},
+      {R::FusionIr, R::ThreadPredicateMap},
+      [this]() {
+        thread_pred_map_.build(fusion_);
+        dumpExprsIfEnabled(fusion_->exprs(), "build thread_pred_map_");
+      });
 
   // Fuse cetain patterns of reductions, such as a grid reduction
   // followed by a grid broadcast. Only depends on parallelization and
   // thread predicate map.
-  fuseReductionsAndBroadcasts(fusion_);
-  dumpExprsIfEnabled(fusion_->exprs(), "fuseReductionsAndBroadcasts");
+  analyses.add(
+      "fuseReductionsAndBroadcasts",
+      {R::ParallelDimensionMap},
+      {R::FusionIr, R::ThreadPredicateMap},
+      [this]() {
+        fuseReductionsAndBroadcasts(fusion_);
+        dumpExprsIfEnabled(fusion_->exprs(), "fuseReductionsAndBroadcasts");
+      });
 
   // Depends on ComputeAtMap
-  validateAndConvertIterDomainGrouping(fusion_);
-  dumpExprsIfEnabled(fusion_->exprs(), "validateAndConvertIterDomainGrouping");
+  analyses.add(
+      "validateAndConvertIterDomainGrouping",
+      {R::ComputeAtMap, R::ParallelDimensionMap},
+      {R::FusionIr},
+      [this]() {
+        validateAndConvertIterDomainGrouping(fusion_);
+        dumpExprsIfEnabled(
+            fusion_->exprs(), "validateAndConvertIterDomainGrouping");
+      });
 
   // Assumes all grouped reductions are convered to
   // GroupedReductionOp, which is done by
   // validateAndConvertIterDomainGrouping
-  validateGroupedReductions(fusion_);
-  dumpExprsIfEnabled(fusion_->exprs(), "validateGroupedReductions");
+  analyses.add("validateGroupedReductions", {R::FusionIr}, {}, [this]() {
+    validateGroupedReductions(fusion_);
+    dumpExprsIfEnabled(fusion_->exprs(), "validateGroupedReductions");
+  });
 
   // Want to run this after parallel map is created.
   // Needs info about grouped reductions.
   // vectorized_accesses_ and vectorized_set_info_ are filled.
-  validateAndCollectVectorizeInfo(fusion_);
-  dumpExprsIfEnabled(fusion_->exprs(), "validateAndCollectVectorizeInfo");
+  analyses.add(
+      "validateAndCollectVectorizeInfo",
+      {R::FusionIr, R::ComputeAtMap, R::IdModel, R::ParallelDimensionMap},
+      {R::VectorizeInfo},
+      [this]() {
+        validateAndCollectVectorizeInfo(fusion_);
+        dumpExprsIfEnabled(
+            fusion_->exprs(), "validateAndCollectVectorizeInfo");
+      });
 
   // all of the lookup TVs are fusion inputs
-  validateLookupTV(fusion_);
-  dumpExprsIfEnabled(fusion_->exprs(), "validateLookupTV");
+  analyses.add("validateLookupTV", {R::FusionIr}, {}, [this]() {
+    validateLookupTV(fusion_);
+    dumpExprsIfEnabled(fusion_->exprs(), "validateLookupTV");
+  });
 
   // Find trivial global to global broadcast, squeeze, and set operations and
   // mark their outputs as aliases of their inputs.
-  findTensorProducerAliases(fusion_);
-  dumpExprsIfEnabled(fusion_->exprs(), "findTensorProducerAliases");
+  analyses.add(
+      "findTensorProducerAliases",
+      {R::FusionIr, R::IdModel},
+      {R::TensorProducerAliases},
+      [this]() {
+        findTensorProducerAliases(fusion_);
+        dumpExprsIfEnabled(fusion_->exprs(), "findTensorProducerAliases");
+      });
 
   // Depends on thread_pred_map_, validates parallelization collects which
   // tensor views need WAR or RAW syncs
-  sync_map_ = std::make_shared<const SyncMap>(fusion_);
-  if (isDebugDumpEnabled(DebugDumpOption::SyncMap)) {
-    debug() << sync_map_->toString() << std::endl;
-  }
-  dumpExprsIfEnabled(fusion_->exprs(), "SyncMap");
-
-  non_divisible_split_info_ = std::make_unique<NonDivisibleSplitInfo>(fusion_);
-  dumpExprsIfEnabled(fusion_->exprs(), "build nonDivisibleSplitInfo");
-
-  circularBufferInfo().build(fusion_);
-  dumpExprsIfEnabled(fusion_->exprs(), "build circularBufferInfo");
-
-  compute_at_map_->allocateIndexVariables();
-  dumpExprsIfEnabled(fusion_->exprs(), "allocateIndexVariables");
+  analyses.add(
+      "SyncMap",
+      {R::FusionIr,
+       R::IdModel,
+       R::ComputeAtMap,
+       R::ConcretizedBroadcastDomains,
+       R::ParallelDimensionMap,
+       R::ThreadPredicateMap},
+      {R::SyncMap},
+      [this]() {
+        sync_map_ = std::make_shared<const SyncMap>(fusion_);
+        if (isDebugDumpEnabled(DebugDumpOption::SyncMap)) {
+          debug() << sync_map_->toString() << std::endl;
+        }
+        dumpExprsIfEnabled(fusion_->exprs(), "SyncMap");
+      });
+
+  // Adds runtime validations of split divisibility.
+  analyses.add(
+      "build nonDivisibleSplitInfo",
+      {R::ComputeAtMap, R::IdModel},
+      {R::FusionIr, R::NonDivisibleSplitInfo, R::Validations},
+      [this]() {
+        non_divisible_split_info_ =
+            std::make_unique<NonDivisibleSplitInfo>(fusion_);
+        dumpExprsIfEnabled(fusion_->exprs(), "build nonDivisibleSplitInfo");
+      });
+
+  analyses.add(
+      "build circularBufferInfo",
+      {R::FusionIr, R::ComputeAtMap, R::IdModel},
+      {R::CircularBufferInfo},
+      [this]() {
+        circularBufferInfo().build(fusion_);
+        dumpExprsIfEnabled(fusion_->exprs(), "build circularBufferInfo");
+      });
+
+  analyses.add(
+      "allocateIndexVariables",
+      {R::CircularBufferInfo},
+      {R::FusionIr, R::ComputeAtMap},
+      [this]() {
+        compute_at_map_->allocateIndexVariables();
+        dumpExprsIfEnabled(fusion_->exprs(), "allocateIndexVariables");
+      });
+
+  // lower_verbose dumps the fusion after each analysis, which is only
+  // readable if they run in order.
+  analyses.run(
+      !isOptionDisabled(DisableOption::ParallelLowering) &&
+      !isDebugDumpEnabled(DebugDumpOption::LowerVerbose));
 
   if (idModelOptions().loop()) {
     // Depends on CircularBufferInfo and compute_at_map_->allocateIndexVariables
@@ -461,4 +461,18 @@ class GpuLower : public NonCopyable {
   IdModelOptions id_model_options_;
 };
 
+//! Makes `gpu_lower` the current GpuLower of the calling thread while in
+//! scope. LowerTaskGraph uses this to run analyses on its worker threads.
+class LowerGuard {
+ public:
+  explicit LowerGuard(GpuLower* gpu_lower);
+  ~LowerGuard();
+
+  LowerGuard(const LowerGuard&) = delete;
+  LowerGuard& operator=(const LowerGuard&) = delete;
+
+ private:
+  GpuLower* prev_gpu_lower_;
+};
+
 } // namespace nvfuser
@@ -10,6 +10,7 @@
 #include <id_model/utils.h>
 #include <ir/utils.h>
 #include <kernel_ir.h>
+#include <target_device.h>
 
 #include <device_lower/pass/circular_buffer.h>
 
@@ -455,7 +456,7 @@ class CloneTmaCircularBufferLoopAndInsertSync
       return nullptr;
     }
     const int64_t num_sms =
-        at::cuda::getCurrentDeviceProperties()->multiProcessorCount;
+        getTargetDeviceProperties()->multiProcessorCount;
     if (!id_def_split->factor()->isConstScalar() ||
         id_def_split->factor()->evaluate().as<int64_t>() != num_sms) {
       return nullptr;
@@ -0,0 +1,290 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <device_lower/task_graph.h>
+
+#include <debug.h>
+#include <device_lower/lower2device.h>
+#include <fusion.h>
+#include <fusion_guard.h>
+#include <instrumentation.h>
+#include <ir/container.h>
+#include <options.h>
+#include <utils.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace nvfuser {
+
+namespace {
+
+// Separate from getThreadPool() because lowerings run on that pool when
+// segments compile in parallel, and waiting on a pool from its own workers
+// can deadlock. Tasks are short, so a few threads are enough.
+c10::ThreadPool* getLowerThreadPool() {
+  static c10::ThreadPool pool(
+      (int)std::clamp(std::thread::hardware_concurrency(), 1u, 4u));
+  return &pool;
+}
+
+bool contains(const std::vector<LowerResource>& resources, LowerResource r) {
+  return std::find(resources.begin(), resources.end(), r) != resources.end();
+}
+
+bool intersects(
+    const std::vector<LowerResource>& a,
+    const std::vector<LowerResource>& b) {
+  return std::any_of(
+      a.begin(), a.end(), [&](LowerResource r) { return contains(b, r); });
+}
+
+// Fusion computes exprs(), allTvs() and Val::uses() lazily. Fills those
+// caches so that tasks reading the IR concurrently don't race to do it.
+void prepareForConcurrentReads(Fusion* fusion) {
+  if (fusion == nullptr) {
+    return;
+  }
+  fusion->exprs();
+  fusion->allTvs();
+  if (!fusion->isTVUseInfoValid() && !fusion->isUpdatingTVUseInfo()) {
+    fusion->resetTvUses();
+  }
+}
+
+// The shortcut Vals are created on first use, which would register them
+// from whichever task asks first. Creating them upfront, whether or not the
+// tasks run concurrently, also keeps Val names independent of scheduling.
+void createShortcutVals(Fusion* fusion) {
+  if (fusion == nullptr) {
+    return;
+  }
+  FusionGuard fg(fusion);
+  fusion->zeroVal();
+  fusion->oneVal();
+  fusion->falseVal();
+  fusion->trueVal();
+  fusion->magicZeroVal();
+}
+
+// Runs `fn`, making the IR read-only for it unless it declares writing it.
+// See IrReadOnlyGuard.
+void runTask(
+    const std::vector<LowerResource>& writes,
+    const std::function<void()>& fn) {
+  if (contains(writes, LowerResource::FusionIr)) {
+    fn();
+    return;
+  }
+  IrReadOnlyGuard read_only_guard;
+  fn();
+}
+
+// What the thread calling run() has set up for lowering. Installed on the
+// workers while they run a task.
+struct LowerContext {
+  GpuLower* gpu_lower = nullptr;
+  Fusion* fusion = nullptr;
+  InheritedOptions options;
+  std::ostream* debug_stream = nullptr;
+
+  static LowerContext capture() {
+    return {
+        GpuLower::hasCurrent() ? GpuLower::current() : nullptr,
+        FusionGuard::getCurFusion(),
+        InheritedOptions::capture(),
+        &debug()};
+  }
+};
+
+} // namespace
+
+void LowerTaskGraph::add(
+    std::string name,
+    std::vector<LowerResource> reads,
+    std::vector<LowerResource> writes,
+    std::function<void()> fn) {
+  Task task{
+      std::move(name), std::move(reads), std::move(writes), std::move(fn), {}};
+  for (auto&& [i, earlier] : enumerate(tasks_)) {
+    if (intersects(earlier.writes, task.reads) ||
+        intersects(earlier.writes, task.writes) ||
+        intersects(earlier.reads, task.writes)) {
+      task.predecessors.push_back(i);
+    }
+  }
+  tasks_.push_back(std::move(task));
+}
+
+std::vector<std::string> LowerTaskGraph::dependencies(int64_t task) const {
+  std::vector<std::string> names;
+  for (int64_t i : tasks_.at(task).predecessors) {
+    names.push_back(tasks_.at(i).name);
+  }
+  return names;
+}
+
+namespace {
+
+// Progress of a run. Shared with the pool jobs, which hold it until they
+// have returned.
+struct RunState {
+  std::mutex mutex;
+  std::condition_variable finished;
+  std::deque<int64_t> ready;
+  std::vector<int64_t> num_waiting_for;
+  std::vector<std::vector<int64_t>> successors;
+  int64_t num_unfinished = 0;
+  // Pool jobs scheduled that haven't returned yet
+  int64_t num_jobs = 0;
+  // The earliest added task that threw so far. Later tasks are skipped, but
+  // earlier ones still run in case they throw too.
+  int64_t first_failed = std::numeric_limits<int64_t>::max();
+  std::vector<std::exception_ptr> errors;
+};
+
+} // namespace
+
+void LowerTaskGraph::run(bool concurrent) {
+  FUSER_PERF_SCOPE("LowerTaskGraph::run");
+  createShortcutVals(FusionGuard::getCurFusion());
+  if (!concurrent || tasks_.size() <= 1) {
+    for (Task& task : tasks_) {
+      runTask(task.writes, task.fn);
+    }
+    return;
+  }
+
+  const LowerContext context = LowerContext::capture();
+  prepareForConcurrentReads(context.fusion);
+
+  auto state = std::make_shared<RunState>();
+  state->num_waiting_for.resize(tasks_.size());
+  state->successors.resize(tasks_.size());
+  state->errors.resize(tasks_.size());
+  state->num_unfinished = std::ssize(tasks_);
+  for (auto&& [i, task] : enumerate(tasks_)) {
+    state->num_waiting_for.at(i) = std::ssize(task.predecessors);
+    for (int64_t predecessor : task.predecessors) {
+      state->successors.at(predecessor).push_back(i);
+    }
+    if (task.predecessors.empty()) {
+      state->ready.push_back(i);
+    }
+  }
+
+  // Runs task `i` unless an earlier added one threw, and makes the tasks
+  // waiting for it ready. Returns how many tasks became ready.
+  auto execute = [this, &context](RunState& state, int64_t i) -> int64_t {
+    Task& task = tasks_.at(i);
+    bool skip = false;
+    {
+      std::lock_guard<std::mutex> lock(state.mutex);
+      skip = i > state.first_failed;
+    }
+    std::exception_ptr error;
+    if (!skip) {
+      try {
+        runTask(task.writes, task.fn);
+        if (contains(task.writes, LowerResource::FusionIr)) {
+          prepareForConcurrentReads(context.fusion);
+        }
+      } catch (...) {
+        error = std::current_exception();
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (error != nullptr) {
+      state.errors.at(i) = error;
+      state.first_failed = std::min(state.first_failed, i);
+    }
+    int64_t num_ready = 0;
+    for (int64_t successor : state.successors.at(i)) {
+      if (--state.num_waiting_for.at(successor) == 0) {
+        state.ready.push_back(successor);
+        num_ready++;
+      }
+    }
+    state.num_unfinished--;
+    state.finished.notify_all();
+    return num_ready;
+  };
+
+  // Each pool job runs one ready task, if the calling thread hasn't taken it
+  // already, and schedules a job for each task that becomes ready. Jobs refer
+  // to `job`, `execute` and `context`, so run() returns only after every job
+  // has, not just after every task has finished.
+  std::function<void()> job;
+  auto schedule = [&state, &job](int64_t num_jobs) {
+    if (num_jobs <= 0) {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->num_jobs += num_jobs;
+    }
+    for ([[maybe_unused]] auto _ : arange(num_jobs)) {
+      getLowerThreadPool()->run(job);
+    }
+  };
+  job = [state, &context, &execute, &schedule]() {
+    int64_t i = -1;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (!state->ready.empty()) {
+        i = state->ready.front();
+        state->ready.pop_front();
+      }
+    }
+    if (i >= 0) {
+      int64_t num_ready = 0;
+      {
+        LowerGuard lower_guard(context.gpu_lower);
+        FusionGuard fg(context.fusion);
+        InheritedOptionsGuard options_guard(context.options);
+        DebugStreamGuard debug_guard(*context.debug_stream);
+        num_ready = execute(*state, i);
+      }
+      schedule(num_ready);
+    }
+    // Nothing of run() may be used after this, as it may have returned.
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->num_jobs--;
+    state->finished.notify_all();
+  };
+
+  // The calling thread takes one of the ready tasks itself.
+  schedule(std::ssize(state->ready) - 1);
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  while (state->num_unfinished > 0 || state->num_jobs > 0) {
+    if (state->ready.empty()) {
+      state->finished.wait(lock);
+      continue;
+    }
+    const int64_t i = state->ready.front();
+    state->ready.pop_front();
+    lock.unlock();
+    schedule(execute(*state, i) - 1);
+    lock.lock();
+  }
+
+  for (const std::exception_ptr& error : state->errors) {
+    if (error != nullptr) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+} // namespace nvfuser
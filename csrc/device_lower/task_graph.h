@@ -0,0 +1,86 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <exceptions.h>
+#include <visibility.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace nvfuser {
+
+//! State of lowering that analyses read or write. LowerTaskGraph derives
+//! which analyses may run concurrently from these.
+enum class LowerResource {
+  //! The kernel IR itself. Every analysis reads it. Analyses that create or
+  //! modify IR nodes, including scalar Vals, write it, so they run alone.
+  //! This also keeps the names of new Vals independent of scheduling.
+  FusionIr,
+  IdModel,
+  ComputeAtMap,
+  DivisibleSplits,
+  ConcretizedBroadcastDomains,
+  ParallelDimensionMap,
+  ThreadPredicateMap,
+  VectorizeInfo,
+  TensorProducerAliases,
+  SyncMap,
+  NonDivisibleSplitInfo,
+  CircularBufferInfo,
+  //! Runtime validations added with GpuLower::validate
+  Validations,
+};
+
+//! A list of lowering tasks, each declaring the LowerResources it reads and
+//! writes. run() has the same effect as running the tasks one after another
+//! in the order they were added: a task starts only after every earlier
+//! task that writes what it reads, or reads or writes what it writes, has
+//! finished. Independent tasks run concurrently on a small thread pool
+//! shared by all lowerings, which helps the latency of lowering a single
+//! kernel.
+//!
+//! Worker threads run tasks with the GpuLower, Fusion, options and debug
+//! stream of the thread calling run(). The calling thread runs tasks too, so
+//! a busy pool delays but never blocks a lowering.
+class LowerTaskGraph {
+ public:
+  NVF_API void add(
+      std::string name,
+      std::vector<LowerResource> reads,
+      std::vector<LowerResource> writes,
+      std::function<void()> fn);
+
+  //! Runs all tasks, concurrently if `concurrent`, and otherwise in order on
+  //! the calling thread. If a task throws, tasks added after it that haven't
+  //! started are skipped, and the exception of the earliest added task that
+  //! threw is rethrown, as it would be by running them in order.
+  NVF_API void run(bool concurrent);
+
+  int64_t size() const {
+    return std::ssize(tasks_);
+  }
+
+  //! Names of the tasks `task` waits for. For debugging.
+  NVF_API std::vector<std::string> dependencies(int64_t task) const;
+
+ private:
+  struct Task {
+    std::string name;
+    std::vector<LowerResource> reads;
+    std::vector<LowerResource> writes;
+    std::function<void()> fn;
+    // Earlier tasks this task conflicts with
+    std::vector<int64_t> predecessors;
+  };
+
+  std::vector<Task> tasks_;
+};
+
+} // namespace nvfuser
@@ -1518,4 +1518,139 @@ size_t DynamicTransformConcretizationInfo::hash() const {
   return hash;
 }
 
+DynamicTransformConcretizationCache::DynamicTransformConcretizationCache(
+    const DynamicTransformInitialInfo* initial_info,
+    ExactLogicalDomainMap* exact_map,
+    int64_t max_memo_size)
+    : initial_info_(initial_info),
+      exact_map_(exact_map),
+      max_memo_size_(max_memo_size) {
+  NVF_ERROR(initial_info_ != nullptr);
+  NVF_ERROR(max_memo_size_ > 0, "Invalid memo size: ", max_memo_size_);
+
+  const std::unordered_set<Val*>& roots = initial_info_->getRootDynamicVals();
+  const std::vector<Val*>& inputs = initial_info_->fusion()->inputs();
+  std::unordered_set<Val*> covered;
+  can_memoize_ = true;
+  for (auto pos : arange(std::ssize(inputs))) {
+    Val* input = inputs.at(pos);
+    auto* tv = dynamic_cast<TensorView*>(input);
+    if (tv == nullptr) {
+      if (roots.count(input)) {
+        sources_.emplace_back(pos, -1);
+        covered.insert(input);
+      }
+      continue;
+    }
+    // The extents of a sharded tensor are bound to its unsharded sizes. Leave
+    // that to ExpressionEvaluator::bindTensorDomain.
+    if (tv->hasDeviceMesh()) {
+      can_memoize_ = false;
+      break;
+    }
+    const std::vector<IterDomain*> logical_domain =
+        TensorDomain::noReductions(tv->getLogicalDomain());
+    for (auto axis : arange(std::ssize(logical_domain))) {
+      IterDomain* id = logical_domain.at(axis);
+      // A broadcast extent is always bound to 1, so it doesn't need to be
+      // part of the signature.
+      if (id->isBroadcast()) {
+        covered.insert(id->extent());
+        if (!id->hasExpandedExtent()) {
+          continue;
+        }
+      }
+      Val* extent = id->getMaybeExpandedExtent();
+      if (roots.count(extent)) {
+        // An extent shared by several inputs gets one source each, so
+        // inconsistent arguments miss the memo and fail validation.
+        sources_.emplace_back(pos, axis);
+        covered.insert(extent);
+      }
+    }
+  }
+  if (can_memoize_) {
+    can_memoize_ = std::all_of(roots.begin(), roots.end(), [&](Val* root) {
+      return root->isConst() || covered.count(root);
+    });
+  }
+  if (!can_memoize_) {
+    sources_.clear();
+  }
+  signature_.reserve(sources_.size());
+}
+
+DynamicTransformConcretizationInfo* DynamicTransformConcretizationCache::get(
+    const KernelArgumentHolder& args) {
+  const bool memoize = can_memoize_ && computeSignature(args);
+  if (memoize) {
+    if (auto it = memo_.find(signature_); it != memo_.end()) {
+      memo_hits_++;
+      return it->second;
+    }
+  }
+
+  ExpressionEvaluator expr_eval =
+      executor_utils::bindInputs(args, initial_info_->fusion());
+  DynamicTransformConcretizationInfo* info =
+      intern(std::make_unique<DynamicTransformConcretizationInfo>(
+          initial_info_, &expr_eval, exact_map_));
+
+  if (memoize) {
+    if (memoSize() >= max_memo_size_) {
+      memo_.clear();
+    }
+    memo_.emplace(signature_, info);
+  }
+  return info;
+}
+
+DynamicTransformConcretizationInfo* DynamicTransformConcretizationCache::intern(
+    std::unique_ptr<DynamicTransformConcretizationInfo> info) {
+  NVF_ERROR(info != nullptr);
+  if (auto it = interned_.find(info.get()); it != interned_.end()) {
+    return it->second.get();
+  }
+  DynamicTransformConcretizationInfo* key = info.get();
+  interned_.emplace(key, std::move(info));
+  return key;
+}
+
+bool DynamicTransformConcretizationCache::computeSignature(
+    const KernelArgumentHolder& args) {
+  if (args.size() != std::ssize(initial_info_->fusion()->inputs())) {
+    return false;
+  }
+  signature_.clear();
+  for (auto&& [pos, axis] : sources_) {
+    const PolymorphicValue& arg = args[pos];
+    if (axis == -1) {
+      if (!arg.is<int64_t>()) {
+        return false;
+      }
+      signature_.push_back(arg.as<int64_t>());
+      continue;
+    }
+    if (!arg.is<at::Tensor>()) {
+      return false;
+    }
+    const at::Tensor& tensor = arg.as<at::Tensor>();
+    if (axis >= tensor.dim()) {
+      // Let bindInputs report the rank mismatch.
+      return false;
+    }
+    signature_.push_back(tensor.size(axis));
+  }
+  return true;
+}
+
+size_t DynamicTransformConcretizationCache::SignatureHash::operator()(
+    const std::vector<int64_t>& signature) const {
+  size_t hash = signature.size();
+  for (int64_t value : signature) {
+    hashCombine(hash, (size_t)value);
+  }
+  return hash;
+}
+
 } // namespace nvfuser
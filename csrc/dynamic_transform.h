@@ -21,6 +21,8 @@
 
 #include <functional>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace nvfuser {
@@ -277,6 +279,113 @@ class DynamicTransformConcretizationInfo {
   friend class DynamicTransformInfoBuilder;
 };
 
+//! Computes and owns the DynamicTransformConcretizationInfo of a dynamic
+//! fusion for each set of inputs.
+//!
+//! Infos are interned: an info equal to one computed before is dropped and
+//! the existing one is returned, so callers can compare and key on pointers
+//! and the number of infos owned is the number of distinct concretizations.
+//!
+//! Concretization only depends on the root dynamic values of the initial
+//! info. When each of them is either a scalar fusion input or an extent of
+//! an input tensor, their values are read directly from the arguments and
+//! used as a signature memoizing the info, which skips binding the inputs
+//! to an ExpressionEvaluator and analyzing the dynamic ops. The memo is
+//! cleared when it reaches `max_memo_size` signatures, which bounds its
+//! memory under shape churn. Interned infos are kept since callers hold
+//! pointers to them.
+class DynamicTransformConcretizationCache {
+ public:
+  NVF_API DynamicTransformConcretizationCache(
+      const DynamicTransformInitialInfo* initial_info,
+      ExactLogicalDomainMap* exact_map = nullptr,
+      int64_t max_memo_size = 1024);
+
+  //! Returns the interned concretization info for `args`, the inputs of the
+  //! fusion of the initial info. Valid for the lifetime of this cache.
+  NVF_API DynamicTransformConcretizationInfo* get(
+      const KernelArgumentHolder& args);
+
+  //! Returns the interned info equal to `info`, taking ownership of `info`
+  //! if none was interned before.
+  NVF_API DynamicTransformConcretizationInfo* intern(
+      std::unique_ptr<DynamicTransformConcretizationInfo> info);
+
+  //! Number of distinct infos owned.
+  int64_t numInterned() const {
+    return std::ssize(interned_);
+  }
+
+  //! Number of signatures currently memoized.
+  int64_t memoSize() const {
+    return std::ssize(memo_);
+  }
+
+  //! Number of calls to get() answered from the memo.
+  int64_t memoHits() const {
+    return memo_hits_;
+  }
+
+  //! Whether the root dynamic values can all be read from the arguments.
+  bool canMemoize() const {
+    return can_memoize_;
+  }
+
+ private:
+  //! Reads the signature of `args` into `signature_`. Returns false if an
+  //! argument can't be part of a signature, e.g. a non-integer scalar.
+  bool computeSignature(const KernelArgumentHolder& args);
+
+ private:
+  struct InfoHash {
+    size_t operator()(const DynamicTransformConcretizationInfo* info) const {
+      return info->hash();
+    }
+  };
+
+  struct InfoEquals {
+    bool operator()(
+        const DynamicTransformConcretizationInfo* a,
+        const DynamicTransformConcretizationInfo* b) const {
+      return *a == *b;
+    }
+  };
+
+  struct SignatureHash {
+    size_t operator()(const std::vector<int64_t>& signature) const;
+  };
+
+  const DynamicTransformInitialInfo* initial_info_ = nullptr;
+
+  ExactLogicalDomainMap* exact_map_ = nullptr;
+
+  const int64_t max_memo_size_;
+
+  //! Each source is the position of a fusion input and, for a tensor, the
+  //! logical axis whose extent is read, or -1 for a scalar.
+  std::vector<std::pair<int64_t, int64_t>> sources_;
+
+  bool can_memoize_ = false;
+
+  //! Scratch space for computeSignature(), reused to avoid allocating.
+  std::vector<int64_t> signature_;
+
+  std::unordered_map<
+      const DynamicTransformConcretizationInfo*,
+      std::unique_ptr<DynamicTransformConcretizationInfo>,
+      InfoHash,
+      InfoEquals>
+      interned_;
+
+  std::unordered_map<
+      std::vector<int64_t>,
+      DynamicTransformConcretizationInfo*,
+      SignatureHash>
+      memo_;
+
+  int64_t memo_hits_ = 0;
+};
+
 class DynamicTransform {
  public:
   //! Get initial information before we have inputs. This analyzes the Fusion to
@@ -173,7 +173,7 @@ void PrecomputedValues::bindConcreteParallelTypeValue(
   }
 }
 
-void PrecomputedValues::bindInputs(const KernelArgumentHolder& args) {
+void PrecomputedValues::bindInputs(KernelArgumentSpan args) {
   FUSER_PERF_SCOPE("PrecomputedValues::bindInputs");
   if (hasValidValues()) {
     invalidate();
@@ -183,7 +183,7 @@ void PrecomputedValues::bindInputs(const KernelArgumentHolder& args) {
 
 void PrecomputedValues::bindValues(
     const std::vector<Val*>& inputs,
-    const KernelArgumentHolder& args) {
+    KernelArgumentSpan args) {
   NVF_ERROR_EQ(
       args.size(),
       std::ssize(inputs),
@@ -19,7 +19,7 @@
 namespace nvfuser {
 
 class PrecomputedValues;
-class KernelArgumentHolder;
+class KernelArgumentSpan;
 struct TensorArgAbstract;
 
 //! NaiveValueMachine:
@@ -148,13 +148,11 @@ class PrecomputedValues {
   NVF_API ~PrecomputedValues();
 
   //! Bind a list of concrete values to the fusion's runtime inputs.
-  void bindInputs(const KernelArgumentHolder& args);
+  void bindInputs(KernelArgumentSpan args);
 
   //! Bind a list of concrete values to a list of fusion values. The two lists
   //! must have the same size.
-  void bindValues(
-      const std::vector<Val*>& values,
-      const KernelArgumentHolder& args);
+  void bindValues(const std::vector<Val*>& values, KernelArgumentSpan args);
 
   using ParallelExtentMap =
       std::unordered_map<ParallelType, std::vector<const Val*>>;
@@ -14,6 +14,7 @@
 #include <expr_evaluator.h>
 #include <instrumentation.h>
 #include <ir/all_nodes.h>
+#include <ir/container.h>
 #include <ir/iostream.h>
 #include <ir/utils.h>
 #include <logical_domain_map.h>
@@ -128,8 +129,94 @@ void validateValWithConcreteValue(
   }
 }
 
+// Adapts an ExpressionEvaluator to ir_utils::dependenciesSatisfied.
+struct KnownVals {
+  const ExpressionEvaluator& expr_eval;
+  int64_t count(const Val* value) const {
+    return expr_eval.isKnown(value) ? 1 : 0;
+  }
+};
+
 } // namespace
 
+ExpressionEvaluator::ExpressionEvaluator(const IrContainer* container)
+    : dense_container_(container) {
+  NVF_ERROR(container != nullptr);
+}
+
+void ExpressionEvaluator::reset() {
+  known_values_.clear();
+  known_named_scalars_.clear();
+  // Tensors are released right away so that they don't outlive the run that
+  // produced them. Other values are just invalidated.
+  for (int64_t slot : dense_tensor_slots_) {
+    dense_values_[slot] = std::monostate{};
+  }
+  dense_tensor_slots_.clear();
+  generation_++;
+}
+
+int64_t ExpressionEvaluator::internedNameIndex(const std::string& name) {
+  static const std::array<std::string, kNumInternedNames> names = {
+      "numberOfStreams",
+      "rank",
+      "cacheId",
+      stringifyThreadSize(ParallelType::BIDx),
+      stringifyThreadSize(ParallelType::BIDy),
+      stringifyThreadSize(ParallelType::BIDz),
+      stringifyThreadSize(ParallelType::TIDx),
+      stringifyThreadSize(ParallelType::TIDy),
+      stringifyThreadSize(ParallelType::TIDz)};
+  for (auto&& [i, interned_name] : enumerate(names)) {
+    if (interned_name == name) {
+      return (int64_t)i;
+    }
+  }
+  return -1;
+}
+
+const PolymorphicValue* ExpressionEvaluator::namedValue(
+    const std::string& name) const {
+  if (const int64_t i = internedNameIndex(name); i >= 0) {
+    return interned_generations_[i] == generation_
+        ? &interned_named_scalars_[i]
+        : nullptr;
+  }
+  auto it = known_named_scalars_.find(name);
+  return it != known_named_scalars_.end() ? &it->second : nullptr;
+}
+
+void ExpressionEvaluator::store(
+    const Val* value,
+    PolymorphicValue concrete_value) {
+  if (!isDense(value)) {
+    known_values_[value] = std::move(concrete_value);
+    return;
+  }
+  const int64_t slot = value->slot();
+  num_dense_stores_++;
+  if (slot >= std::ssize(dense_generations_)) {
+    // Growing the arrays to `slot` costs O(slot), which for a Val of a large
+    // kernel can be far more than the few values a fresh evaluator stores,
+    // e.g., in bindInputs. So they only grow as far as the values stored so
+    // far pay for, and the others go to known_values_, where getValue looks
+    // too. An evaluator that is reset and reused ends up fully dense.
+    if (slot >= kMinDenseSlots + 2 * num_dense_stores_) {
+      known_values_[value] = std::move(concrete_value);
+      return;
+    }
+    // Growing a deque doesn't invalidate references to the values already
+    // in it.
+    dense_values_.resize(slot + 1);
+    dense_generations_.resize(slot + 1, 0);
+  }
+  if (concrete_value.is<at::Tensor>()) {
+    dense_tensor_slots_.push_back(slot);
+  }
+  dense_values_[slot] = std::move(concrete_value);
+  dense_generations_[slot] = generation_;
+}
+
 void ExpressionEvaluator::bindTensorDomain(
     const TensorView* tv,
     const at::Tensor& t,
@@ -191,7 +278,7 @@ void ExpressionEvaluator::bind_(
   }
   validateValWithConcreteValue(value, concrete_value);
   if (evaluate_validate &&
-      ir_utils::dependenciesSatisfied(value, known_values_)) {
+      ir_utils::dependenciesSatisfied(value, KnownVals{*this})) {
     auto evaluated_value = evaluate(value);
     using namespace PolymorphicValue_functions;
     auto same = isSame(evaluated_value, concrete_value);
@@ -210,16 +297,20 @@ void ExpressionEvaluator::bind_(
     bindTensorDomain(tv, t, evaluate_validate);
   }
   if (value->isA<NamedScalar>()) {
-    known_named_scalars_[value->as<NamedScalar>()->name()] =
-        std::move(concrete_value);
+    bind_(value->as<NamedScalar>()->name(), std::move(concrete_value));
   } else {
-    known_values_[value] = std::move(concrete_value);
+    store(value, std::move(concrete_value));
   }
 }
 
 void ExpressionEvaluator::bind_(
     const std::string& name,
     PolymorphicValue concrete_value) {
+  if (const int64_t i = internedNameIndex(name); i >= 0) {
+    interned_named_scalars_[i] = std::move(concrete_value);
+    interned_generations_[i] = generation_;
+    return;
+  }
   known_named_scalars_[name] = std::move(concrete_value);
 }
 
@@ -238,17 +329,57 @@ void ExpressionEvaluator::bind(
 }
 
 const PolymorphicValue& ExpressionEvaluator::evaluate(ParallelType pt) {
-  auto it = known_named_scalars_.find(stringifyThreadSize(pt));
-  if (it != known_named_scalars_.end()) {
-    return it->second;
-  }
-  return null_;
+  const PolymorphicValue* value = namedValue(stringifyThreadSize(pt));
+  return value != nullptr ? *value : null_;
 }
 
 const PolymorphicValue& ExpressionEvaluator::evaluate(const Val* value) {
+  if (isDense(value)) {
+    return evaluateDense(value);
+  }
   return evaluate(value, known_values_);
 }
 
+const PolymorphicValue& ExpressionEvaluator::evaluateDense(const Val* value) {
+  if (precomputed_values_ && precomputed_values_->hasValidValues()) {
+    if (precomputed_values_->getMaybeValueFor(value).hasValue()) {
+      return precomputed_values_->getMaybeValueFor(value);
+    }
+  }
+
+  const PolymorphicValue& known_value = getValue(value, known_values_);
+  if (known_value.hasValue()) {
+    return known_value;
+  }
+  Expr* def = value->definition();
+  if (def == nullptr) {
+    return null_;
+  }
+
+  std::vector<PolymorphicValue> outputs;
+  if (def->isA<CatOp>()) {
+    // CatOp skips the PadOps preceding it, so it has to look up its inputs
+    // itself. What it evaluates on the way is not memoized.
+    std::unordered_map<const Val*, PolymorphicValue> known_values;
+    outputs = def->evaluate(*this, known_values);
+  } else {
+    std::vector<PolymorphicValue> inputs;
+    inputs.reserve(def->inputs().size());
+    for (Val* in : def->inputs()) {
+      const PolymorphicValue& in_value = evaluate(in);
+      if (!in_value.hasValue()) {
+        return null_;
+      }
+      inputs.push_back(in_value);
+    }
+    outputs = def->evaluate(*this, inputs);
+  }
+  for (auto i : arange(def->outputs().size())) {
+    store(def->output(i), std::move(outputs[i]));
+  }
+  return getValue(value, known_values_);
+}
+
 PolymorphicValue ExpressionEvaluator::evaluate(const Val* value) const {
   std::unordered_map<const Val*, PolymorphicValue> known_values;
   return evaluate(value, known_values);
@@ -287,9 +418,15 @@ const PolymorphicValue& ExpressionEvaluator::getValue(
   }
 
   if (value->isA<NamedScalar>()) {
-    const auto it = known_named_scalars_.find(value->as<NamedScalar>()->name());
-    if (it != known_named_scalars_.end()) {
-      return it->second;
+    if (const PolymorphicValue* named_value =
+            namedValue(value->as<NamedScalar>()->name())) {
+      return *named_value;
+    }
+  }
+
+  if (isDense(value)) {
+    if (const PolymorphicValue* dense_value = denseValue(value)) {
+      return *dense_value;
     }
   }
 
@@ -318,9 +455,25 @@ void ExpressionEvaluator::print() const {
             << *kv.first->getValType() << "\n";
   }
 
+  if (dense_container_ != nullptr) {
+    for (Val* val : dense_container_->deterministic_vals()) {
+      if (const PolymorphicValue* value =
+              isDense(val) ? denseValue(val) : nullptr) {
+        debug() << val << " = " << toString(*value) << " ; "
+                << *val->getValType() << "\n";
+      }
+    }
+  }
+
   for (const auto& kv : known_named_scalars_) {
     debug() << kv.first << " = " << toString(kv.second) << " ;\n";
   }
+  for (auto i : arange(kNumInternedNames)) {
+    if (interned_generations_[i] == generation_) {
+      debug() << "interned named scalar " << i << " = "
+              << toString(interned_named_scalars_[i]) << " ;\n";
+    }
+  }
 
   debug() << "\nPre-computed Values\n";
   if (precomputed_values_ != nullptr) {
@@ -509,8 +662,22 @@ ExpressionEvaluator ExpressionEvaluator::clone(IrCloner& ir_cloner) const {
   for (const auto& kv : known_values_) {
     expr_eval.known_values_[ir_cloner.clone(kv.first)] = kv.second;
   }
+  // The clone is for another container, so dense values go to its hash map.
+  if (dense_container_ != nullptr) {
+    for (Val* val : dense_container_->deterministic_vals()) {
+      if (const PolymorphicValue* value =
+              isDense(val) ? denseValue(val) : nullptr) {
+        expr_eval.known_values_[ir_cloner.clone(val)] = *value;
+      }
+    }
+  }
   expr_eval.known_named_scalars_.insert(
       known_named_scalars_.begin(), known_named_scalars_.end());
+  expr_eval.interned_named_scalars_ = interned_named_scalars_;
+  for (auto i : arange(kNumInternedNames)) {
+    expr_eval.interned_generations_[i] =
+        interned_generations_[i] == generation_ ? expr_eval.generation_ : 0;
+  }
   return expr_eval;
 }
 
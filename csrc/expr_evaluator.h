@@ -16,16 +16,40 @@
 #include <polymorphic_value.h>
 #include <visibility.h>
 
+#include <array>
+#include <deque>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace nvfuser {
 
+class IrContainer;
 class PrecomputedValues;
 
 //! Calculate Fusion IR expressions
+//!
+//! By default, values are kept in a hash map keyed by Val. An evaluator
+//! constructed with a container instead keeps the values of the Vals
+//! registered with that container in an array indexed by Val::slot(), which
+//! makes the bind/evaluate pattern of each launch cheaper. The array grows
+//! with the number of values stored, so Vals with slots far beyond it, and
+//! Vals of other containers, still go to the hash map. Named scalars bound
+//! on each launch, e.g., cacheId and thread sizes, are kept in fixed slots
+//! in both modes.
 class ExpressionEvaluator {
  public:
+  ExpressionEvaluator() = default;
+
+  //! Dense mode for the Vals of `container`.
+  NVF_API explicit ExpressionEvaluator(const IrContainer* container);
+
+  //! Forgets all bound and evaluated values. In dense mode this releases
+  //! tensors and starts a new generation, which invalidates everything else
+  //! without touching it, so the storage is reused. Bound PrecomputedValues
+  //! are kept.
+  NVF_API void reset();
+
   //! Bind a concrete value to an IR variable
   //! If evaluate_validate is true, and value is evaluatable with the
   //! information already known, then evaluate and validate the value with the
@@ -62,10 +86,16 @@ class ExpressionEvaluator {
       std::unordered_map<const Val*, PolymorphicValue>& known_values) const;
 
   bool isKnown(const Val* value) const {
+    if (isDense(value) && denseValue(value) != nullptr) {
+      return true;
+    }
     return known_values_.count(value) > 0;
   }
 
   void invalidate(const Val* value) {
+    if (isDense(value) && value->slot() < std::ssize(dense_generations_)) {
+      dense_generations_[value->slot()] = 0;
+    }
     known_values_.erase(value);
   }
 
@@ -109,6 +139,35 @@ class ExpressionEvaluator {
       const std::unordered_map<const Val*, PolymorphicValue>&
           additional_known_values) const;
 
+  //! Whether the value of `value` may be kept in dense_values_. See store()
+  //! for when it is kept in known_values_ instead.
+  bool isDense(const Val* value) const {
+    return dense_container_ != nullptr &&
+        value->container() == dense_container_ && value->slot() >= 0;
+  }
+
+  //! Returns nullptr if `value` is not known in the current generation.
+  const PolymorphicValue* denseValue(const Val* value) const {
+    const int64_t slot = value->slot();
+    if (slot < std::ssize(dense_generations_) &&
+        dense_generations_[slot] == generation_) {
+      return &dense_values_[slot];
+    }
+    return nullptr;
+  }
+
+  //! Stores the value of a Val that isn't a NamedScalar.
+  void store(const Val* value, PolymorphicValue concrete_value);
+
+  //! Like evaluate(value, known_values_), but memoizes in dense_values_.
+  const PolymorphicValue& evaluateDense(const Val* value);
+
+  //! Returns nullptr if `name` is not known in the current generation.
+  const PolymorphicValue* namedValue(const std::string& name) const;
+
+  //! Index of `name` in interned_named_scalars_, or -1.
+  static int64_t internedNameIndex(const std::string& name);
+
  private:
   // TODO: Consider make this const. It can't be const as bind() of
   // this class calls
@@ -120,6 +179,26 @@ class ExpressionEvaluator {
   std::unordered_map<const Val*, PolymorphicValue> known_values_;
   std::unordered_map<std::string, PolymorphicValue> known_named_scalars_;
   PolymorphicValue null_ = std::monostate{};
+
+  // Set in dense mode
+  const IrContainer* dense_container_ = nullptr;
+  // A deque so that growing it keeps references returned by evaluate valid.
+  std::deque<PolymorphicValue> dense_values_;
+  // A value in dense_values_ or interned_named_scalars_ is known if its
+  // generation is the current one. Generation 0 is never current.
+  std::vector<uint64_t> dense_generations_;
+  uint64_t generation_ = 1;
+  // Slots holding tensors, which reset() releases
+  std::vector<int64_t> dense_tensor_slots_;
+  // Values of dense Vals stored since construction, across reset(). Bounds
+  // how far store() grows the arrays.
+  int64_t num_dense_stores_ = 0;
+  static constexpr int64_t kMinDenseSlots = 64;
+
+  // Named scalars with a fixed slot. See internedNameIndex in the .cpp.
+  static constexpr int64_t kNumInternedNames = 9;
+  std::array<PolymorphicValue, kNumInternedNames> interned_named_scalars_;
+  std::array<uint64_t, kNumInternedNames> interned_generations_ = {};
 };
 
 } // namespace nvfuser
@@ -40,6 +40,9 @@ void swap(Fusion& a, Fusion& b) noexcept {
   swap(a.outputs_, b.outputs_);
 
   swap(a.io_alias_, b.io_alias_);
+
+  a.invalidateExprs();
+  b.invalidateExprs();
 }
 
 std::unique_ptr<SegmentedFusion> Fusion::segment(
@@ -106,6 +109,166 @@ IrCloner Fusion::copy(const Fusion* from, Fusion* to) {
     }
   }
 
+  if (from->exprs_ptr_ != nullptr) {
+    to->exprs_ptr_ = std::make_unique<std::vector<Expr*>>(
+        ir_cloner.clone(*from->exprs_ptr_));
+  }
+
+  return ir_cloner;
+}
+
+namespace {
+
+// An IrCloner that remembers which statements it has cloned, so
+// Fusion::copy(from, to, exprs, boundary) can grow the cloned subgraph until
+// it's closed under the definitions it needs.
+class SubgraphCloner : public IrCloner {
+ public:
+  using IrCloner::IrCloner;
+
+  bool isCloned(const Statement* s) const {
+    return clones_map_.count(s) > 0;
+  }
+
+  // Returns the clone of `s` if it has been cloned and nullptr otherwise.
+  template <typename T>
+  T* maybeClone(const T* s) const {
+    auto it = clones_map_.find(s);
+    return it == clones_map_.end() ? nullptr : it->second->template as<T>();
+  }
+
+  // Pops the next original Val whose clone hasn't been processed yet.
+  const Val* popPending() {
+    if (pending_vals_.empty()) {
+      return nullptr;
+    }
+    const Val* v = pending_vals_.back();
+    pending_vals_.pop_back();
+    return v;
+  }
+
+  const std::vector<const Val*>& clonedVals() const {
+    return cloned_vals_;
+  }
+
+ protected:
+  Statement* handle(const Statement* s) override {
+    Statement* clone = IrCloner::handle(s);
+    if (s->isVal()) {
+      pending_vals_.push_back(s->as<Val>());
+      cloned_vals_.push_back(s->as<Val>());
+    }
+    return clone;
+  }
+
+ private:
+  std::vector<const Val*> pending_vals_;
+  std::vector<const Val*> cloned_vals_;
+};
+
+} // namespace
+
+IrCloner Fusion::copy(
+    const Fusion* from,
+    Fusion* to,
+    const std::vector<Expr*>& exprs,
+    const std::vector<Val*>& boundary) {
+  FUSER_PERF_SCOPE("Fusion::copy subgraph");
+  to->clear();
+  SubgraphCloner ir_cloner(to);
+
+  // Clones the definitions of everything cloned so far. Tensor-producing
+  // expressions are only cloned when they are part of `exprs`, which are
+  // cloned upfront, so this stops at the subgraph's boundary while still
+  // bringing in IterDomain transforms and extent computations.
+  auto close_over_definitions = [&]() {
+    while (const Val* v = ir_cloner.popPending()) {
+      Expr* def = v->definition();
+      if (def == nullptr || ir_cloner.isCloned(def)) {
+        continue;
+      }
+      if (std::any_of(
+              def->outputs().begin(), def->outputs().end(), [](Val* out) {
+                return out->isA<TensorView>();
+              })) {
+        continue;
+      }
+      ir_cloner.clone(def);
+    }
+  };
+
+  for (Expr* e : exprs) {
+    ir_cloner.clone(e);
+  }
+  ir_cloner.clone(boundary);
+  close_over_definitions();
+
+  for (const auto& [output, alias_info] : from->io_alias_) {
+    if (!ir_cloner.isCloned(output)) {
+      continue;
+    }
+    to->io_alias_[ir_cloner.clone(output)] = {
+        .type = alias_info.type,
+        .aliased_io = ir_cloner.clone(alias_info.aliased_io),
+        .hide_output = alias_info.hide_output};
+  }
+
+  for (const auto& [tv, metadata] : from->metadata_) {
+    if (ir_cloner.isCloned(tv)) {
+      to->metadata_[ir_cloner.clone(tv)] = ir_cloner.clone(metadata);
+    }
+  }
+
+  if (from->axioms_ != nullptr) {
+    // Keep the axioms about cloned values, e.g., the positivity of cloned
+    // extents, as well as those about parallel dimensions.
+    auto is_known = [&](Val* v) {
+      return ir_cloner.isCloned(v) || v->isConst() || v->isA<NamedScalar>();
+    };
+    to->axioms_ = std::make_unique<std::vector<Val*>>();
+    for (Val* pred : *from->axioms_) {
+      Expr* def = pred->definition();
+      if (def != nullptr &&
+          std::all_of(def->inputs().begin(), def->inputs().end(), is_known)) {
+        to->axioms_->push_back(ir_cloner.clone(pred));
+      }
+    }
+  }
+
+  for (const auto& i : from->managed_data_) {
+    if (i.first.has_value()) {
+      to->managed_data_.emplace_back(i.second(ir_cloner, i.first), i.second);
+    } else {
+      to->managed_data_.emplace_back(i.first, i.second);
+    }
+  }
+  for (auto [k, v] : from->managed_named_data_) {
+    if (v.first.has_value()) {
+      to->managed_named_data_.insert(std::make_pair(
+          k, std::make_pair(v.second(ir_cloner, v.first), v.second)));
+    }
+  }
+  close_over_definitions();
+
+  // Keep names consistent with the complete fusion, as Fusion::copy does.
+  to->val_type_name_map_ = from->val_type_name_map_;
+  to->expr_name_counter_ = from->expr_name_counter_;
+
+  for (const Val* val : ir_cloner.clonedVals()) {
+    Val* clone = ir_cloner.clone(val);
+    clone->setDefinition(ir_cloner.maybeClone(val->definition_));
+    std::vector<Expr*> uses;
+    uses.reserve(val->uses_.size());
+    for (Expr* use : val->uses_) {
+      if (Expr* cloned_use = ir_cloner.maybeClone(use)) {
+        uses.push_back(cloned_use);
+      }
+    }
+    clone->setUses(uses);
+  }
+
+  to->expected_dynamic_smem_bytes_ = from->expected_dynamic_smem_bytes_;
+
   return ir_cloner;
 }
 
@@ -186,6 +349,7 @@ void Fusion::removeExpr(Expr* expr) {
   }
 
   IrContainer::removeExpr(expr);
+  invalidateExprs();
 }
 
 void Fusion::removeVal(Val* val) {
@@ -339,7 +503,23 @@ void Fusion::replaceOutput(Val* output, Val* replacement) {
 }
 
 std::vector<Expr*> Fusion::exprs() const {
-  return StmtSort::getExprs(this);
+  if (exprs_ptr_ == nullptr) {
+    exprs_cache_traversals_.fetch_add(1, std::memory_order_relaxed);
+    exprs_ptr_ =
+        std::make_unique<std::vector<Expr*>>(StmtSort::getExprs(this));
+  } else {
+    exprs_cache_hits_.fetch_add(1, std::memory_order_relaxed);
+  }
+  // Return a copy as in allTvs. Many callers mutate the fusion while
+  // iterating over the result, which would invalidate a reference.
+  return *exprs_ptr_;
+}
+
+void Fusion::removeStatementsCreatedAfter(
+    int64_t prev_num_exprs,
+    int64_t prev_num_vals) {
+  IrContainer::removeStatementsCreatedAfter(prev_num_exprs, prev_num_vals);
+  invalidateExprs();
 }
 
 bool Fusion::isNoOp() {
@@ -593,6 +773,7 @@ void Fusion::registerExpr(Expr* expr) {
   }
 
   IrContainer::registerExpr(expr);
+  invalidateExprs();
 
   for (Val* input : expr->inputs()) {
     assertInContainer(input, "Input to expr is invalid, ");
@@ -636,7 +817,7 @@ void Fusion::resetTvUses() {
   // remove dead exprs, this could reinsert them. getExprs is also boundeds by
   // inputs as registered inputs will return nullptr as their definition.
   const auto all_tvs = ir_utils::filterByType<TensorView>(vals_);
-  const auto used_exprs = StmtSort::getExprs(this);
+  const auto used_exprs = exprs();
 
   for (auto tv : all_tvs) {
     tv->setUses({});
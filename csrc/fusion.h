@@ -20,6 +20,7 @@
 #include <visibility.h>
 
 #include <any>
+#include <atomic>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -212,9 +213,31 @@ class NVF_API Fusion : public IrContainer {
   bankConflictInfo(const CompileParams& compile_params = CompileParams());
 
   //! Return a list of topologically sorted expressions. This only includes
-  //! exprs required to generate registered outputs.
+  //! exprs required to generate registered outputs. The order is computed
+  //! once and cached until the fusion changes, e.g., an Expr is registered or
+  //! removed or the inputs or outputs change.
   std::vector<Expr*> exprs() const;
 
+  //! Incremented every time the fusion changes in a way that may change
+  //! exprs(). Analyses derived from exprs() can use this to check whether
+  //! they are stale.
+  int64_t exprsVersion() const {
+    return exprs_version_;
+  }
+
+  //! How many times exprs() was answered from its cache and how many times
+  //! it had to traverse the fusion. For profiling.
+  struct ExprsCacheStats {
+    int64_t hits = 0;
+    int64_t traversals = 0;
+  };
+
+  ExprsCacheStats exprsCacheStats() const {
+    return {
+        exprs_cache_hits_.load(std::memory_order_relaxed),
+        exprs_cache_traversals_.load(std::memory_order_relaxed)};
+  }
+
   //! Return a vector of fusion inputs that feed this Val
   std::vector<Val*> inputsOf(Val* val);
 
@@ -430,6 +453,23 @@ class NVF_API Fusion : public IrContainer {
 
   static IrCloner copy(const Fusion* from, Fusion* to);
 
+  //! Like copy, but only clones `exprs`, `boundary` and what they transitively
+  //! reference, i.e., the Vals they consume and produce, the IterDomain
+  //! transforms and scalar expressions defining those Vals, and the aliases,
+  //! axioms and tensor metadata involving them. Tensor-producing expressions
+  //! outside `exprs` are not cloned, so their outputs have no definition in
+  //! `to`. Inputs and outputs of `to` are left empty. This is what
+  //! SegmentedFusion::makeFusion uses so the cost of creating a segment is
+  //! proportional to the segment instead of the complete fusion.
+  //!
+  //! The returned IrCloner still clones on demand, so statements that weren't
+  //! part of the subgraph can be mapped into `to` later.
+  static IrCloner copy(
+      const Fusion* from,
+      Fusion* to,
+      const std::vector<Expr*>& exprs,
+      const std::vector<Val*>& boundary);
+
   //! During scheduling, this can be set to a non-negative value. If done, then
   //! during execution by KernelExecutor, we will check that this value matches
   //! the corresponding value in LaunchParams.
@@ -465,6 +505,7 @@ class NVF_API Fusion : public IrContainer {
  protected:
   friend SegmentCandidateFinder;
   friend SegmentedFusion;
+  friend class StatementGuard;
   friend class TranslateApplicableWelford;
   friend Val;
 
@@ -492,8 +533,20 @@ class NVF_API Fusion : public IrContainer {
   void invalidateTvsAndUses() {
     all_tv_uses_valid_ = false;
     all_tvs_ptr_.reset();
+    invalidateExprs();
+  }
+
+  //! Declare that exprs() needs to be recomputed.
+  void invalidateExprs() {
+    exprs_ptr_.reset();
+    exprs_version_++;
   }
 
+  //! Statements removed by StatementGuard may be in the cached exprs().
+  void removeStatementsCreatedAfter(
+      int64_t prev_num_exprs,
+      int64_t prev_num_vals) override;
+
  private:
   // Fusion inputs and outputs
   std::vector<Val*> inputs_;
@@ -523,6 +576,14 @@ class NVF_API Fusion : public IrContainer {
 
   std::unique_ptr<std::vector<TensorView*>> all_tvs_ptr_ = nullptr;
 
+  // Cached result of exprs(), valid for exprs_version_.
+  mutable std::unique_ptr<std::vector<Expr*>> exprs_ptr_ = nullptr;
+  int64_t exprs_version_ = 0;
+  // Atomic as lowering analyses running concurrently read exprs() once it is
+  // cached. See LowerTaskGraph.
+  mutable std::atomic<int64_t> exprs_cache_hits_{0};
+  mutable std::atomic<int64_t> exprs_cache_traversals_{0};
+
   inline static const std::string exact_mappings_key = "exact_mappings";
 };
 
@@ -13,6 +13,7 @@
 #include <disjoint_set.h>
 #include <fusion.h>
 #include <fusion_segmenter.h>
+#include <fusion_view.h>
 #include <instrumentation.h>
 #include <ir/all_nodes.h>
 #include <ir/cloner.h>
@@ -25,6 +26,7 @@
 #include <options.h>
 #include <scheduler/debug_utils.h>
 #include <scheduler/normalization_utils.h>
+#include <scheduler/registry.h>
 #include <transform_iter.h>
 
 namespace nvfuser {
@@ -1876,27 +1878,20 @@ void eraseInputDistinctRootDomains(Fusion* fusion) {
 
 std::pair<IrCloner, std::unique_ptr<Fusion>> SegmentedFusion::makeFusion(
     SegmentedGroup* sg) const {
-  // TODO Optimize cloning step by only copying values and expressions between
-  // the fusion segment's inputs and outputs.
+  FUSER_PERF_SCOPE("SegmentedFusion::makeFusion");
   auto fusion_segment = std::make_unique<Fusion>();
 
-  IrCloner complete_to_segment_map =
-      Fusion::copy(completeFusion(), fusion_segment.get());
-
-  std::vector<Val*> input_list(
-      fusion_segment->inputs().begin(), fusion_segment->inputs().end());
-  for (auto inp : input_list) {
-    fusion_segment->removeInput(inp);
-  }
-
-  std::vector<Val*> output_list(
-      fusion_segment->outputs().begin(), fusion_segment->outputs().end());
-  for (auto out : output_list) {
-    fusion_segment->removeOutput(out);
-  }
+  // Only clone the segment's subgraph. Cloning the complete fusion for every
+  // segment makes creating all segments quadratic in the fusion size.
+  std::vector<Val*> inputs = getAllInputs(sg);
+  std::vector<Val*> boundary = inputs;
+  boundary.insert(
+      boundary.end(), sg->output_vals_.begin(), sg->output_vals_.end());
+  IrCloner complete_to_segment_map = Fusion::copy(
+      completeFusion(), fusion_segment.get(), sg->exprs(), boundary);
 
   std::vector<TensorView*> view_tvs;
-  for (auto inp : getAllInputs(sg)) {
+  for (auto inp : inputs) {
     auto clone_tv = complete_to_segment_map.clone(inp);
     fusion_segment->addInput(clone_tv);
     if (inp->isDefinitionType<ViewOp>()) {
@@ -2256,6 +2251,61 @@ bool tryingToMergeSegmenterSet(Fusion* fusion) {
   return false;
 }
 
+// Same as above but on a view of the candidate segment
+bool tryingToMergeSegmenterSet(const FusionView& view) {
+  for (auto expr : view.exprs()) {
+    if (expr->isA<LoadStoreOp>() &&
+        expr->as<LoadStoreOp>()->opType() == LoadStoreOpType::SegmenterSet) {
+      auto out = expr->output(0);
+      if (!view.isOutput(out) || !view.uses(out).empty()) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// Checks the candidate made of `groups` on a view, so a rejected merge
+// doesn't narrow the complete fusion with a FusionSegmentGuard. Returns true
+// if the candidate merges across a SegmenterSet or fails
+// Schedule::canScheduleCompileTime on the view. The view is only built when
+// the candidate contains a SegmenterSet or an op only ExprEval takes, so
+// merges of other candidates cost no more than before.
+//
+// The guard also inserts casts when IoToLowerPrecision is enabled, which a
+// view doesn't model, so this must not be used in that case.
+bool rejectMergeOnView(
+    SegmentedFusion* segmented_fusion,
+    const std::vector<SegmentedGroup*>& groups,
+    std::vector<Val*> inputs,
+    std::vector<Val*> outputs) {
+  const bool needs_view =
+      std::any_of(groups.begin(), groups.end(), [](SegmentedGroup* group) {
+        return std::any_of(
+            group->exprs().begin(), group->exprs().end(), [](Expr* expr) {
+              return (expr->isA<LoadStoreOp>() &&
+                      expr->as<LoadStoreOp>()->opType() ==
+                          LoadStoreOpType::SegmenterSet) ||
+                  expr->isOneOf<
+                      ScatterOp,
+                      SdpaFwdOp,
+                      SdpaBwdOp,
+                      EmbeddingFwdOp,
+                      IndexPutAccumulateOp,
+                      ArgsortOp>();
+            });
+      });
+  if (!needs_view) {
+    return false;
+  }
+  FusionView view(
+      segmented_fusion->completeFusion(),
+      std::move(inputs),
+      std::move(outputs));
+  return tryingToMergeSegmenterSet(view) ||
+      !Schedule::canScheduleCompileTime(view);
+}
+
 // Guard to temporarily change the inputs and outputs of a
 // fusion. Cast expressions to fp32 and fp16 are also inserted. On
 // destruction will return fusion to original state.
@@ -2451,6 +2501,17 @@ SchedulerType tryMerge(
     SchedulerRuntimeInfo& runtime_info,
     SegmentedGroup* a,
     SegmentedGroup* b = nullptr) {
+  const bool check_on_view = !isOptionEnabled(EnableOption::IoToLowerPrecision);
+  if (check_on_view &&
+      rejectMergeOnView(
+          segmented_fusion,
+          b == nullptr ? std::vector<SegmentedGroup*>{a}
+                       : std::vector<SegmentedGroup*>{a, b},
+          getAllInputs(a, b),
+          getAllOutputs(a, b))) {
+    return SchedulerType::None;
+  }
+
   FusionSegmentGuard fsg(segmented_fusion, a, b);
 
   NVF_ERROR(
@@ -2462,7 +2523,8 @@ SchedulerType tryMerge(
   scheduler_debug_utils::canScheduleMessage(
       "\n**Segmenter** Considering fusion:\n",
       segmented_fusion->completeFusion());
-  if (tryingToMergeSegmenterSet(segmented_fusion->completeFusion())) {
+  if (!check_on_view &&
+      tryingToMergeSegmenterSet(segmented_fusion->completeFusion())) {
     return SchedulerType::None;
   }
   return Schedule::proposeHeuristics(
@@ -2473,6 +2535,16 @@ SchedulerType tryMerge(
     SegmentedFusion* segmented_fusion,
     SchedulerRuntimeInfo& runtime_info,
     const std::vector<SegmentedGroup*>& segmented_groups) {
+  const bool check_on_view = !isOptionEnabled(EnableOption::IoToLowerPrecision);
+  if (check_on_view &&
+      rejectMergeOnView(
+          segmented_fusion,
+          segmented_groups,
+          allInputsIfTrueElseOutputs(segmented_groups, true),
+          allInputsIfTrueElseOutputs(segmented_groups, false))) {
+    return SchedulerType::None;
+  }
+
   FusionSegmentGuard fsg(segmented_fusion, segmented_groups);
 
   NVF_ERROR(
@@ -2484,7 +2556,8 @@ SchedulerType tryMerge(
   scheduler_debug_utils::canScheduleMessage(
       "\n**Segmenter** Considering fusion:\n",
       segmented_fusion->completeFusion());
-  if (tryingToMergeSegmenterSet(segmented_fusion->completeFusion())) {
+  if (!check_on_view &&
+      tryingToMergeSegmenterSet(segmented_fusion->completeFusion())) {
     return SchedulerType::None;
   }
   return Schedule::proposeHeuristics(
@@ -0,0 +1,64 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <fusion_view.h>
+
+#include <disjoint_set.h>
+#include <instrumentation.h>
+#include <iter_visitor.h>
+
+namespace nvfuser {
+
+FusionView::FusionView(
+    Fusion* fusion,
+    std::vector<Val*> inputs,
+    std::vector<Val*> outputs)
+    : fusion_(fusion),
+      inputs_(std::move(inputs)),
+      outputs_(std::move(outputs)),
+      input_set_(inputs_.begin(), inputs_.end()),
+      output_set_(outputs_.begin(), outputs_.end()) {
+  FUSER_PERF_SCOPE("FusionView::FusionView");
+  NVF_ERROR(fusion_ != nullptr);
+
+  exprs_ = StmtSort::getExprsBetween(inputs_, outputs_);
+  expr_set_.insert(exprs_.begin(), exprs_.end());
+
+  VectorOfUniqueEntries<TensorView*> all_tvs;
+  for (Val* v : inputs_) {
+    if (auto* tv = dynamic_cast<TensorView*>(v)) {
+      all_tvs.pushBack(tv);
+    }
+  }
+  for (Expr* e : exprs_) {
+    for (Val* in : e->inputs()) {
+      uses_[in].push_back(e);
+      if (auto* tv = dynamic_cast<TensorView*>(in)) {
+        all_tvs.pushBack(tv);
+      }
+    }
+    for (Val* out : e->outputs()) {
+      if (auto* tv = dynamic_cast<TensorView*>(out)) {
+        all_tvs.pushBack(tv);
+      }
+    }
+  }
+  for (Val* v : outputs_) {
+    if (auto* tv = dynamic_cast<TensorView*>(v)) {
+      all_tvs.pushBack(tv);
+    }
+  }
+  all_tvs_ = all_tvs.vector();
+}
+
+const std::vector<Expr*>& FusionView::uses(Val* v) const {
+  static const std::vector<Expr*> no_uses;
+  auto it = uses_.find(v);
+  return it == uses_.end() ? no_uses : it->second;
+}
+
+} // namespace nvfuser
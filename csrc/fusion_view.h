@@ -0,0 +1,95 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <fusion.h>
+#include <ir/base_nodes.h>
+#include <ir/interface_nodes.h>
+#include <visibility.h>
+
+namespace nvfuser {
+
+// A read-only view of the part of a Fusion between `inputs` and `outputs`,
+// i.e., what the Fusion would look like after narrowing its inputs and
+// outputs with FusionSegmentGuard. Unlike the guard, a view never changes the
+// underlying Fusion. Creating it costs time proportional to the viewed
+// subgraph, and a view can be queried from multiple threads as long as the
+// Fusion isn't modified meanwhile.
+//
+// Everything is computed on construction. In particular, uses() is answered
+// from the view's own index instead of Val::uses(), which may lazily
+// recompute uses of the whole Fusion.
+//
+// The segmenter checks merge candidates on a view first, rejecting merges
+// across a SegmenterSet and candidates failing
+// Schedule::canScheduleCompileTime(const FusionView&). That only covers checks
+// that can be answered from the view. Schedulers' canScheduleCompileTime,
+// canScheduleRunTime and proposeHeuristics still take a Fusion, so candidates
+// passing the view checks are narrowed with a FusionSegmentGuard as before.
+class FusionView {
+ public:
+  NVF_API FusionView(
+      Fusion* fusion,
+      std::vector<Val*> inputs,
+      std::vector<Val*> outputs);
+
+  Fusion* fusion() const {
+    return fusion_;
+  }
+
+  const std::vector<Val*>& inputs() const {
+    return inputs_;
+  }
+
+  const std::vector<Val*>& outputs() const {
+    return outputs_;
+  }
+
+  bool isInput(Val* v) const {
+    return input_set_.count(v) > 0;
+  }
+
+  bool isOutput(Val* v) const {
+    return output_set_.count(v) > 0;
+  }
+
+  // Topologically sorted exprs needed to compute outputs from inputs.
+  const std::vector<Expr*>& exprs() const {
+    return exprs_;
+  }
+
+  bool contains(Expr* e) const {
+    return expr_set_.count(e) > 0;
+  }
+
+  // TensorViews that are inputs, outputs or produced by exprs(), in
+  // topological order.
+  const std::vector<TensorView*>& allTvs() const {
+    return all_tvs_;
+  }
+
+  // Uses of `v` among exprs().
+  NVF_API const std::vector<Expr*>& uses(Val* v) const;
+
+ private:
+  Fusion* fusion_ = nullptr;
+  std::vector<Val*> inputs_;
+  std::vector<Val*> outputs_;
+  std::unordered_set<Val*> input_set_;
+  std::unordered_set<Val*> output_set_;
+  std::vector<Expr*> exprs_;
+  std::unordered_set<Expr*> expr_set_;
+  std::vector<TensorView*> all_tvs_;
+  std::unordered_map<Val*, std::vector<Expr*>> uses_;
+};
+
+} // namespace nvfuser
@@ -199,7 +199,7 @@ HostIrEvaluator::HostIrEvaluator(
     : container_(std::move(container)),
       communicator_(communicator),
       params_(params),
-      expr_evaluator_(),
+      expr_evaluator_(container_.get()),
       my_local_device_index_(communicator_ ? communicator_->local_rank() : 0),
       ipc_handle_cache_(expr_evaluator_) {
   const DeviceIdxType device_index =
@@ -218,7 +218,7 @@ HostIrEvaluator::HostIrEvaluator(
 KernelArgumentHolder HostIrEvaluator::runWithInputs(
     const KernelArgumentHolder& args) {
   FUSER_PERF_SCOPE("HostIrEvaluator::runWithInputs");
-  expr_evaluator_ = ExpressionEvaluator();
+  expr_evaluator_.reset();
   expr_evaluator_.bind("numberOfStreams", params_.number_of_streams);
   NVF_ERROR(args.getCacheId().has_value());
   expr_evaluator_.bind("cacheId", static_cast<int64_t>(*args.getCacheId()));
@@ -245,7 +245,7 @@ KernelArgumentHolder HostIrEvaluator::runWithInputs(
 
 KernelArgumentHolder HostIrEvaluator::runWithInput(
     const std::unordered_map<Val*, PolymorphicValue>& val_to_PValue) {
-  expr_evaluator_ = ExpressionEvaluator();
+  expr_evaluator_.reset();
   expr_evaluator_.bind("numberOfStreams", params_.number_of_streams);
   expr_evaluator_.bind("rank", communicator_->deviceId());
   // process input values, converting IValue to PolymorphicValue
@@ -431,13 +431,14 @@ void HostIrEvaluator::handle(PostOnStream* post_ir) {
           "FusionExecutorCache does not support with preallocated outputs, so "
           "we are copying the outputs in expr ",
           post_ir);
-      auto tmp_outputs = fec_.at(hu).runFusionWithInputs(input_args);
+      auto tmp_outputs =
+          fec_.at(hu).runFusionWithInputs(std::move(input_args));
       for (auto output_idx : c10::irange(tmp_outputs.size())) {
         outputs[output_idx].as<at::Tensor>().copy_(
             tmp_outputs[output_idx].as<at::Tensor>());
       }
     } else {
-      outputs = fec_.at(hu).runFusionWithInputs(input_args);
+      outputs = fec_.at(hu).runFusionWithInputs(std::move(input_args));
     }
   } else {
     // This path should generally be avoided as it will likely send the fusion
@@ -463,9 +464,9 @@ void HostIrEvaluator::handle(PostOnStream* post_ir) {
     }
     ExecutorAbstract* ea = executors_[hu].get();
     if (use_preallocated_outputs) {
-      ExecutorDispatch::run(ea, input_args, outputs);
+      ExecutorDispatch::run(ea, std::move(input_args), outputs);
     } else {
-      outputs = ExecutorDispatch::run(ea, input_args);
+      outputs = ExecutorDispatch::run(ea, std::move(input_args));
     }
   }
 
@@ -608,20 +609,38 @@ void HostIrEvaluator::handle(ForLoop* for_loop) {
   }
 }
 
-void HostIrEvaluator::handle(StartCoalescing* start_coalescing) {
-  auto backend = communicator_->getWorld();
+namespace {
+
+// Returns nullptr if this device isn't in `team`, which then doesn't take
+// part in the coalesced communications either.
+c10d::Backend* getCoalescingBackend(
+    Communicator* communicator,
+    const Team& team,
+    std::optional<CommunicatorBackend> backend_type) {
+  c10d::Backend* backend = team.empty()
+      ? communicator->getWorld(backend_type)
+      : communicator->getBackendForTeam(team, backend_type);
   NVF_ERROR(
-      backend->getBackendName() == "nccl",
+      backend == nullptr || backend->getBackendName() == "nccl",
       "ProcessGroupUCC does not implement coalescence");
-  backend->startCoalescing();
+  return backend;
+}
+
+} // namespace
+
+void HostIrEvaluator::handle(StartCoalescing* start_coalescing) {
+  c10d::Backend* backend = getCoalescingBackend(
+      communicator_, start_coalescing->team(), start_coalescing->backend());
+  if (backend != nullptr) {
+    backend->startCoalescing();
+  }
 }
 
 void HostIrEvaluator::handle(EndCoalescing* end_coalescing) {
-  auto backend = communicator_->getWorld();
-  NVF_ERROR(
-      backend->getBackendName() == "nccl",
-      "ProcessGroupUCC does not implement coalescence");
-  works_[end_coalescing] = backend->endCoalescing();
+  c10d::Backend* backend = getCoalescingBackend(
+      communicator_, end_coalescing->team(), end_coalescing->backend());
+  works_[end_coalescing] =
+      backend == nullptr ? nullptr : backend->endCoalescing();
 }
 
 void HostIrEvaluator::handle(kir::IfThenElse* if_then_else) {
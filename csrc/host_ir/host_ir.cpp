@@ -311,12 +311,18 @@ bool Synchronize::sameAs(const Statement* other) const {
   return false;
 }
 
-StartCoalescing::StartCoalescing(IrBuilderPasskey passkey) : Expr(passkey) {
+StartCoalescing::StartCoalescing(
+    IrBuilderPasskey passkey,
+    Team team,
+    std::optional<CommunicatorBackend> backend)
+    : Expr(passkey) {
   NVF_ERROR(passkey.ir_container_ != nullptr);
   NVF_ERROR(
       passkey.ir_container_->isA<HostIrContainer>(),
       this,
       "must be registered in a HostIrContainer");
+  addDataAttribute(std::move(team));
+  addDataAttribute(backend);
 }
 
 NVFUSER_DEFINE_CLONE_AND_CREATE(StartCoalescing)
@@ -331,12 +337,18 @@ std::string StartCoalescing::toInlineString(int indent_size) const {
   NVF_CHECK(false, "Cannot be printed inline");
 }
 
-EndCoalescing::EndCoalescing(IrBuilderPasskey passkey) : Expr(passkey) {
+EndCoalescing::EndCoalescing(
+    IrBuilderPasskey passkey,
+    Team team,
+    std::optional<CommunicatorBackend> backend)
+    : Expr(passkey) {
   NVF_ERROR(passkey.ir_container_ != nullptr);
   NVF_ERROR(
       passkey.ir_container_->isA<HostIrContainer>(),
       this,
       "must be registered in a HostIrContainer");
+  addDataAttribute(std::move(team));
+  addDataAttribute(backend);
 }
 
 NVFUSER_DEFINE_CLONE_AND_CREATE(EndCoalescing)
@@ -13,6 +13,7 @@
 #include <multidevice/communication.h>
 #include <scheduler/heuristic.h>
 #include <atomic>
+#include <optional>
 
 namespace nvfuser {
 
@@ -311,10 +312,17 @@ class Synchronize : public Expr {
 // that we don't have a fine-grain control on synchronicity, in other words, we
 // can only synchronize with the grouped communication at once.
 // Remark: ProcessGroupUCC does not implement coalesced groups for now
+//
+// A coalescing region applies to the process group of `team` and `backend`,
+// which must be those of the communications in the region. An empty team
+// stands for all devices.
 class StartCoalescing : public Expr {
  public:
   using Expr::Expr;
-  StartCoalescing(IrBuilderPasskey passkey);
+  StartCoalescing(
+      IrBuilderPasskey passkey,
+      Team team = {},
+      std::optional<CommunicatorBackend> backend = std::nullopt);
 
   StartCoalescing(const StartCoalescing& other) = delete;
   StartCoalescing& operator=(const StartCoalescing& other) = delete;
@@ -328,12 +336,23 @@ class StartCoalescing : public Expr {
   const char* getOpString() const override {
     return "hir::StartCoalescing";
   }
+
+  const Team& team() const {
+    return attribute<Team>(0);
+  }
+
+  std::optional<CommunicatorBackend> backend() const {
+    return attribute<std::optional<CommunicatorBackend>>(1);
+  }
 };
 
 class EndCoalescing : public Expr {
  public:
   using Expr::Expr;
-  EndCoalescing(IrBuilderPasskey passkey);
+  EndCoalescing(
+      IrBuilderPasskey passkey,
+      Team team = {},
+      std::optional<CommunicatorBackend> backend = std::nullopt);
 
   EndCoalescing(const EndCoalescing& other) = delete;
   EndCoalescing& operator=(const EndCoalescing& other) = delete;
@@ -347,6 +366,14 @@ class EndCoalescing : public Expr {
   const char* getOpString() const override {
     return "hir::EndCoalescing";
   }
+
+  const Team& team() const {
+    return attribute<Team>(0);
+  }
+
+  std::optional<CommunicatorBackend> backend() const {
+    return attribute<std::optional<CommunicatorBackend>>(1);
+  }
 };
 
 class ShareMemHandles : public Expr {
@@ -8,6 +8,7 @@
 #include <device_lower/utils.h>
 #include <host_ir/lower.h>
 #include <host_ir/lower_to_communication.h>
+#include <host_ir/pass/coalesce_communications.h>
 #include <host_ir/pass/convert_op_to_communication.h>
 #include <host_ir/pass/stream_parallel_type.h>
 #include <ir/all_nodes.h>
@@ -195,6 +196,9 @@ std::unique_ptr<hir::HostIrContainer> HostIrLower::lower(
 
   hir_pass::ConvertOpToCommunication(params_).runPass(hic.get());
 
+  hir_pass::CoalesceCommunications(params_.communication_bucket_bytes)
+      .runPass(hic.get());
+
   return hic;
 }
 
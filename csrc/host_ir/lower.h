@@ -17,6 +17,10 @@ namespace nvfuser {
 
 struct HostIrLowerParams {
   CommunicatorBackend communicator_backend = CommunicatorBackend::kNccl;
+  // Independent collectives on the same team are coalesced into buckets of at
+  // most this many bytes. See hir_pass::CoalesceCommunications. 0 disables
+  // coalescing.
+  int64_t communication_bucket_bytes = 0;
 };
 
 class HostIrLower {
@@ -0,0 +1,204 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <host_ir/pass/coalesce_communications.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <host_ir/host_ir.h>
+#include <ir/builder.h>
+#include <ir/utils.h>
+#include <kernel_ir.h>
+#include <multidevice/communication.h>
+#include <multidevice/communication_cost.h>
+
+namespace nvfuser::hir_pass {
+
+namespace {
+
+class Bucket {
+ public:
+  explicit Bucket(std::vector<Expr*>& new_top_level_exprs)
+      : new_top_level_exprs_(new_top_level_exprs) {}
+
+  bool empty() const {
+    return communications_.empty();
+  }
+
+  bool touches(Expr* e) const {
+    auto is_bucketed = [&](Val* v) { return tvs_.count(v) > 0; };
+    return std::any_of(e->inputs().begin(), e->inputs().end(), is_bucketed) ||
+        std::any_of(e->outputs().begin(), e->outputs().end(), is_bucketed) ||
+        (e->isA<hir::Deallocate>() &&
+         is_bucketed(e->as<hir::Deallocate>()->buffer()));
+  }
+
+  // Returns whether `communication` of `bytes` can join the bucket without
+  // being flushed first.
+  bool accepts(
+      Communication* communication,
+      int64_t bytes,
+      int64_t max_bucket_bytes) const {
+    if (empty()) {
+      return true;
+    }
+    const Communication* front = communications_.front();
+    return communication->backend() == front->backend() &&
+        communication->team() == front->team() && !touches(communication) &&
+        bytes_ + bytes <= max_bucket_bytes;
+  }
+
+  void add(
+      kir::Allocate* allocate,
+      Communication* communication,
+      int64_t bytes) {
+    if (allocate != nullptr) {
+      allocates_.push_back(allocate);
+    }
+    communications_.push_back(communication);
+    tvs_.insert(communication->in());
+    tvs_.insert(communication->out());
+    bytes_ += bytes;
+  }
+
+  void flush() {
+    if (empty()) {
+      return;
+    }
+    new_top_level_exprs_.insert(
+        new_top_level_exprs_.end(), allocates_.begin(), allocates_.end());
+    if (communications_.size() == 1) {
+      // Not worth a coalescing region.
+      new_top_level_exprs_.push_back(communications_.front());
+      new_top_level_exprs_.push_back(
+          IrBuilder::create<hir::Wait>(communications_.front()));
+    } else {
+      // The region must apply to the process group the communications use.
+      const Communication* front = communications_.front();
+      new_top_level_exprs_.push_back(IrBuilder::create<hir::StartCoalescing>(
+          front->team(), front->backend()));
+      new_top_level_exprs_.insert(
+          new_top_level_exprs_.end(),
+          communications_.begin(),
+          communications_.end());
+      auto* end_coalescing = IrBuilder::create<hir::EndCoalescing>(
+          front->team(), front->backend());
+      new_top_level_exprs_.push_back(end_coalescing);
+      new_top_level_exprs_.push_back(
+          IrBuilder::create<hir::Wait>(end_coalescing));
+      // Backends may or may not return a work for each coalesced
+      // communication. hir::Wait is a no-op for those that don't.
+      for (Communication* communication : communications_) {
+        new_top_level_exprs_.push_back(
+            IrBuilder::create<hir::Wait>(communication));
+      }
+    }
+    allocates_.clear();
+    communications_.clear();
+    tvs_.clear();
+    bytes_ = 0;
+  }
+
+ private:
+  std::vector<Expr*>& new_top_level_exprs_;
+  std::vector<kir::Allocate*> allocates_;
+  std::vector<Communication*> communications_;
+  std::unordered_set<Val*> tvs_;
+  int64_t bytes_ = 0;
+};
+
+} // namespace
+
+void CoalesceCommunications::passImplementation(Fusion* fusion) {
+  FusionGuard fg(fusion);
+  auto* hic = dynamic_cast<hir::HostIrContainer*>(fusion);
+  NVF_CHECK(hic, "Expected HostIrContainer");
+  NVF_CHECK(
+      max_bucket_bytes_ >= 0,
+      "Expected a non-negative bucket size: ",
+      max_bucket_bytes_);
+  if (max_bucket_bytes_ == 0) {
+    return;
+  }
+
+  const std::vector<Expr*>& top_level_exprs = hic->topLevelExprs();
+
+  // Communications that can be bucketed and the Allocate of their output, if
+  // any.
+  std::unordered_map<Communication*, kir::Allocate*> allocate_of;
+  std::unordered_map<Communication*, int64_t> bytes_of;
+  std::unordered_set<Expr*> bucketable_allocates;
+  for (auto it = top_level_exprs.begin(); it != top_level_exprs.end(); ++it) {
+    auto* communication = dynamic_cast<Communication*>(*it);
+    if (communication == nullptr ||
+        communication->backend() != CommunicatorBackend::kNccl) {
+      continue;
+    }
+    std::optional<int64_t> bytes = unshardedSizeInBytes(communication->out());
+    if (!bytes.has_value() || *bytes > max_bucket_bytes_) {
+      continue;
+    }
+    kir::Allocate* allocate = nullptr;
+    if (it != top_level_exprs.begin()) {
+      auto* prev = dynamic_cast<kir::Allocate*>(*std::prev(it));
+      if (prev != nullptr && prev->buffer() == communication->out()) {
+        allocate = prev;
+        bucketable_allocates.insert(prev);
+      }
+    }
+    allocate_of[communication] = allocate;
+    bytes_of[communication] = *bytes;
+  }
+
+  std::vector<Expr*> new_top_level_exprs;
+  Bucket bucket(new_top_level_exprs);
+  for (Expr* e : top_level_exprs) {
+    if (bucketable_allocates.count(e)) {
+      // Emitted along with its communication.
+      continue;
+    }
+
+    if (auto* communication = dynamic_cast<Communication*>(e);
+        communication != nullptr && allocate_of.count(communication)) {
+      const int64_t bytes = bytes_of.at(communication);
+      if (!bucket.accepts(communication, bytes, max_bucket_bytes_)) {
+        bucket.flush();
+      }
+      bucket.add(allocate_of.at(communication), communication, bytes);
+      continue;
+    }
+
+    if (auto* wait = dynamic_cast<hir::Wait*>(e); wait != nullptr) {
+      auto* communication =
+          dynamic_cast<Communication*>(wait->communication());
+      if (communication != nullptr && allocate_of.count(communication)) {
+        // Emitted when the communication's bucket is flushed.
+        continue;
+      }
+    }
+
+    if (e->isOneOf<
+            ForLoop,
+            kir::IfThenElse,
+            hir::StartCoalescing,
+            hir::EndCoalescing,
+            P2PCommunication,
+            Communication,
+            hir::Wait>() ||
+        bucket.touches(e)) {
+      bucket.flush();
+    }
+    new_top_level_exprs.push_back(e);
+  }
+  bucket.flush();
+
+  hic->resetTopLevelExprs(new_top_level_exprs);
+}
+
+} // namespace nvfuser::hir_pass
@@ -0,0 +1,54 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <host_ir/container.h>
+#include <host_ir/pass/optimization_pass.h>
+
+namespace nvfuser::hir_pass {
+
+// Buckets independent collectives so their launch latency is paid once per
+// bucket instead of once per collective. It expects the
+//   Allocate(out) -> Communication -> Wait
+// sequences emitted by ConvertOpToCommunication and rewrites each bucket of
+// two or more communications into
+//   Allocate(out_0) ... Allocate(out_n)
+//   StartCoalescing(team, backend)
+//   Communication_0 ... Communication_n
+//   EndCoalescing(team, backend)
+//   Wait(EndCoalescing)
+//   Wait(Communication_0) ... Wait(Communication_n)
+//
+// Communications are bucketed together when they use the NCCL backend and the
+// same team, and when none of them reads or writes a tensor another one
+// produces. A bucket is closed before any other expression that touches one of
+// its tensors, before control flow, and before it would exceed
+// `max_bucket_bytes`. Communications whose size is unknown at compile time are
+// never bucketed, because the bucket size could not be bounded. Communications
+// are only ever posted later than in the input program, never earlier, so this
+// does not extend the lifetime of any of their inputs.
+//
+// Only top-level expressions are considered.
+class CoalesceCommunications : public OptimizationPass<CoalesceCommunications> {
+  friend class OptimizationPass<CoalesceCommunications>;
+
+ public:
+  explicit CoalesceCommunications(int64_t max_bucket_bytes)
+      : max_bucket_bytes_(max_bucket_bytes) {}
+
+ protected:
+  void passImplementation(Fusion* fusion);
+  static constexpr std::string_view name() {
+    return "CoalesceCommunications";
+  }
+
+ private:
+  int64_t max_bucket_bytes_;
+};
+
+} // namespace nvfuser::hir_pass
@@ -0,0 +1,116 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <id_graph_cache.h>
+
+#include <instrumentation.h>
+#include <ir/cloner.h>
+
+#include <any>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace nvfuser {
+
+namespace {
+
+// The structure of a fusion the graphs are built from. Names are included
+// along with pointers so that a statement allocated where a removed one used
+// to be doesn't look the same.
+std::vector<uintptr_t> snapshotFusion(Fusion* fusion) {
+  std::vector<uintptr_t> snapshot;
+  auto add_stmt = [&snapshot](const Statement* stmt) {
+    snapshot.push_back(reinterpret_cast<uintptr_t>(stmt));
+    snapshot.push_back((uintptr_t)stmt->name());
+  };
+  auto add_vals = [&](const std::vector<Val*>& vals) {
+    snapshot.push_back(vals.size());
+    for (Val* val : vals) {
+      add_stmt(val);
+    }
+  };
+  auto add_ids = [&](const std::vector<IterDomain*>& ids) {
+    snapshot.push_back(ids.size());
+    for (IterDomain* id : ids) {
+      add_stmt(id);
+      snapshot.push_back((uintptr_t)id->getIterType());
+    }
+  };
+
+  add_vals(fusion->inputs());
+  add_vals(fusion->outputs());
+
+  const std::vector<Expr*> exprs = fusion->exprs();
+  snapshot.push_back(exprs.size());
+  for (Expr* expr : exprs) {
+    add_stmt(expr);
+  }
+
+  const std::vector<TensorView*> tvs = fusion->allTvs();
+  snapshot.push_back(tvs.size());
+  for (TensorView* tv : tvs) {
+    add_stmt(tv);
+    add_stmt(tv->domain());
+    add_ids(tv->getRootDomain());
+    add_ids(tv->getLogicalDomain());
+    add_ids(tv->getAllocationDomain());
+    add_ids(tv->getLoopDomain());
+    snapshot.push_back((uintptr_t)tv->getComputeAtPosition());
+    snapshot.push_back((uintptr_t)tv->getMaxProducerPosition());
+    snapshot.push_back((uintptr_t)tv->getComputeWithPosition());
+  }
+  return snapshot;
+}
+
+template <typename T>
+struct CachedGraph {
+  std::vector<uintptr_t> snapshot;
+  std::shared_ptr<T> graph;
+};
+
+template <typename T, typename BuildFn>
+std::shared_ptr<T> getOrBuild(
+    Fusion* fusion,
+    const std::string& key,
+    BuildFn build) {
+  NVF_ERROR(fusion != nullptr);
+  std::vector<uintptr_t> snapshot = snapshotFusion(fusion);
+  if (fusion->hasManaged(key)) {
+    const auto& cached = fusion->getManaged<CachedGraph<T>>(key);
+    if (cached.snapshot == snapshot) {
+      return cached.graph;
+    }
+  }
+
+  std::shared_ptr<T> graph = build();
+  // The graphs refer to the statements of this fusion, so a copy starts
+  // with an empty entry, which never matches.
+  fusion->manage(
+      key,
+      CachedGraph<T>{std::move(snapshot), graph},
+      [](IrCloner&, std::any) { return std::any(CachedGraph<T>{}); });
+  return graph;
+}
+
+} // namespace
+
+std::shared_ptr<ComputeAtMap> cachedComputeAtMap(Fusion* fusion) {
+  FUSER_PERF_SCOPE("cachedComputeAtMap");
+  return getOrBuild<ComputeAtMap>(fusion, "cached_compute_at_map", [&]() {
+    return std::make_shared<ComputeAtMap>(fusion);
+  });
+}
+
+std::shared_ptr<IdModel> cachedIdModel(Fusion* fusion) {
+  FUSER_PERF_SCOPE("cachedIdModel");
+  return getOrBuild<IdModel>(fusion, "cached_id_model", [&]() {
+    return std::make_shared<IdModel>(fusion, /*build_graphs=*/false);
+  });
+}
+
+} // namespace nvfuser
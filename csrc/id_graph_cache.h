@@ -0,0 +1,42 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <compute_at_map.h>
+#include <fusion.h>
+#include <id_model/id_model.h>
+#include <visibility.h>
+
+#include <memory>
+
+namespace nvfuser {
+
+// Schedulers analyze the same fusion many times: every scheduler checks a
+// segment candidate with its own ComputeAtMap, heuristics build them again,
+// and scheduling tools like parallelizeAllLike build one per call. The
+// functions below return a ComputeAtMap or IdModel that the fusion carries
+// as managed data, so that these analyses share one.
+//
+// A cached map is reused only if the fusion is structurally the same as when
+// the map was built: the same TensorViews, with the same root, logical,
+// allocation and loop IterDomains, inlining positions and exprs. Anything
+// else, e.g., a split, merge, reorder or inlining, makes the next call
+// rebuild it. Changes that don't affect the graphs, like parallelization or
+// memory types, keep the cached map. The cache is dropped when the fusion is
+// copied.
+//
+// The returned maps are shared, so callers must not modify them except for
+// building more IdModel graphs with maybeBuildGraph.
+
+NVF_API std::shared_ptr<ComputeAtMap> cachedComputeAtMap(Fusion* fusion);
+
+//! The IdModel is built without graphs. Use maybeBuildGraph to get one,
+//! which builds it if no earlier user of the cached IdModel has.
+NVF_API std::shared_ptr<IdModel> cachedIdModel(Fusion* fusion);
+
+} // namespace nvfuser
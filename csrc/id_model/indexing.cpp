@@ -253,6 +253,22 @@ IndexingInfo TensorIndexer::computeIndex(
     const std::vector<IterDomain*>& index_ids,
     const std::vector<ForLoop*>& for_loops) const {
   const auto loop_ids = getLoopIds(expr, id_model_);
+
+  std::optional<IndexKey> key;
+  if (canMemoizeIndexing(expr)) {
+    validateCaches();
+    key = IndexKey{loop_ids, index_ids, {}};
+    key->loop_indices.reserve(loop_ids.size());
+    for (IterDomain* loop_id : loop_ids) {
+      key->loop_indices.push_back(getLoopIndex(loop_id, for_loops));
+    }
+    if (auto it = index_cache_.find(*key); it != index_cache_.end()) {
+      ++cache_stats_.index_hits;
+      return it->second;
+    }
+    ++cache_stats_.index_misses;
+  }
+
   const ExprPath<ExprGroup> traversal_path = getIndexingPath(expr, index_ids);
   const std::unordered_map<ValGroup, Val*> initial_index_map =
       getInitialIndexMap(loop_ids, for_loops);
@@ -302,6 +318,9 @@ IndexingInfo TensorIndexer::computeIndex(
 
   IndexingInfo info{
       loop_ids, index_ids, traversal_path, index_map, loop_group_dependencies};
+  if (key.has_value()) {
+    index_cache_.emplace(std::move(*key), info);
+  }
   return info;
 }
 
@@ -795,11 +814,99 @@ ExprPath<ExprGroup> TensorIndexer::getIndexingPath(
     }
   }
 
-  return IndexingTraversal::getExprsBetween(
-      expr,
-      traversalGraph(),
-      getLoopIds(expr, id_model_),
-      non_broadcast_index_ids);
+  const std::vector<IterDomain*> loop_ids = getLoopIds(expr, id_model_);
+  if (!canMemoizeIndexing(expr)) {
+    return IndexingTraversal::getExprsBetween(
+        expr, traversalGraph(), loop_ids, non_broadcast_index_ids);
+  }
+
+  validateCaches();
+  IndexingPathKey key{
+      traversalGraph().toGroups(loop_ids).vector(),
+      traversalGraph().toGroups(non_broadcast_index_ids).vector()};
+  if (auto it = indexing_path_cache_.find(key);
+      it != indexing_path_cache_.end()) {
+    ++cache_stats_.path_hits;
+    return it->second;
+  }
+  ++cache_stats_.path_misses;
+
+  ExprPath<ExprGroup> path = IndexingTraversal::getExprsBetween(
+      expr, traversalGraph(), loop_ids, non_broadcast_index_ids);
+  indexing_path_cache_.emplace(std::move(key), path);
+  return path;
+}
+
+bool TensorIndexer::canMemoizeIndexing(const Expr* expr) const {
+  auto has_resize = [&](TensorView* tv) -> bool {
+    auto [it, inserted] = has_resize_.try_emplace(tv, false);
+    if (inserted) {
+      const auto all_exprs = tv->domain()->allExprs();
+      it->second = std::any_of(all_exprs.begin(), all_exprs.end(), [](Expr* e) {
+        return e->isA<Resize>();
+      });
+    }
+    return it->second;
+  };
+  for (auto vals : {&expr->inputs(), &expr->outputs()}) {
+    for (auto tv : ir_utils::filterByType<TensorView>(*vals)) {
+      if (has_resize(tv)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void TensorIndexer::validateCaches() const {
+  const int64_t num_val_groups = traversalGraph().disjointValSets().size();
+  const int64_t num_expr_groups = traversalGraph().disjointExprSets().size();
+  if (num_val_groups == num_cached_val_groups_ &&
+      num_expr_groups == num_cached_expr_groups_) {
+    return;
+  }
+  indexing_path_cache_.clear();
+  index_cache_.clear();
+  num_cached_val_groups_ = num_val_groups;
+  num_cached_expr_groups_ = num_expr_groups;
+}
+
+size_t TensorIndexer::IndexingPathKey::Hash::operator()(
+    const IndexingPathKey& key) const {
+  size_t hash = key.from_groups.size();
+  for (const auto& groups : {&key.from_groups, &key.to_groups}) {
+    for (const ValGroup& group : *groups) {
+      hashCombine(hash, std::hash<ValGroup>()(group));
+    }
+  }
+  return hash;
+}
+
+size_t TensorIndexer::IndexKey::Hash::operator()(const IndexKey& key) const {
+  size_t hash = key.loop_ids.size();
+  for (const auto& ids : {&key.loop_ids, &key.index_ids}) {
+    for (IterDomain* id : *ids) {
+      hashCombine(hash, std::hash<IterDomain*>()(id));
+    }
+  }
+  for (Val* index : key.loop_indices) {
+    hashCombine(hash, std::hash<Val*>()(index));
+  }
+  return hash;
+}
+
+std::string IndexingCacheStats::toString() const {
+  auto hit_rate = [](int64_t hits, int64_t misses) {
+    return hits + misses == 0 ? 0.0 : (double)hits / (double)(hits + misses);
+  };
+  std::stringstream ss;
+  ss << "Indexing path cache: " << path_hits << " hits, " << path_misses
+     << " misses (" << hit_rate(path_hits, path_misses) * 100 << "%)"
+     << std::endl;
+  ss << "Index map cache: " << index_hits << " hits, " << index_misses
+     << " misses (" << hit_rate(index_hits, index_misses) * 100 << "%)"
+     << std::endl;
+  return ss.str();
 }
 
 ExprPath<ExprGroup> TensorIndexer::getPredicateIndexingPath(
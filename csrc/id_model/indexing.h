@@ -19,6 +19,7 @@
 // Just for PredicateInfo. Should be moved to its own header file
 #include <index_compute.h>
 
+#include <string>
 #include <unordered_map>
 
 namespace nvfuser {
@@ -34,6 +35,17 @@ struct IndexingInfo {
   std::unordered_map<ValGroup, ValGroups> loop_group_dependencies;
 };
 
+// Hit and miss counts of the indexing traversal paths and index maps
+// memoized by TensorIndexer.
+struct IndexingCacheStats {
+  int64_t path_hits = 0;
+  int64_t path_misses = 0;
+  int64_t index_hits = 0;
+  int64_t index_misses = 0;
+
+  std::string toString() const;
+};
+
 // The basic algorithm of indexing is:
 //
 // 1. Find the loop domains
@@ -162,6 +174,10 @@ class TensorIndexer {
   // only been implemented for the old indexer.
   static bool isSupported(Fusion* fusion);
 
+  const IndexingCacheStats& cacheStats() const {
+    return cache_stats_;
+  }
+
  private:
   // Build a map of loop groups to their index Vals. See the comment
   // on loop_index_map_.
@@ -235,6 +251,45 @@ class TensorIndexer {
       const ValGroups& non_divisible_ids,
       IndexingInfo& index_info) const;
 
+  // Whether the indexing path and index map of a given expr only
+  // depend on the loop and index domains, so they can be memoized.
+  // That's not the case when resize is involved as IndexingTraversal
+  // then depends on the tensors of the expr.
+  bool canMemoizeIndexing(const Expr* expr) const;
+
+  // Drops memoized paths and index maps if the traversal graph has
+  // been updated since they were computed.
+  void validateCaches() const;
+
+  // Key of memoized indexing traversal paths. Many tensor accesses,
+  // e.g., of unrolled or circular-buffered loops, share the same loop
+  // and index groups.
+  struct IndexingPathKey {
+    std::vector<ValGroup> from_groups;
+    std::vector<ValGroup> to_groups;
+
+    bool operator==(const IndexingPathKey& other) const = default;
+
+    struct Hash {
+      size_t operator()(const IndexingPathKey& key) const;
+    };
+  };
+
+  // Key of memoized index maps, i.e., the result of computeIndex. The
+  // loop indices identify the loop nest since they are all the index
+  // map depends on in addition to the domains.
+  struct IndexKey {
+    std::vector<IterDomain*> loop_ids;
+    std::vector<IterDomain*> index_ids;
+    std::vector<Val*> loop_indices;
+
+    bool operator==(const IndexKey& other) const = default;
+
+    struct Hash {
+      size_t operator()(const IndexKey& key) const;
+    };
+  };
+
  private:
   // Using non-const references of IdModel because traversalGraph() returns a
   // non-const reference
@@ -249,6 +304,19 @@ class TensorIndexer {
   // Allocation info for each tensor. Must be filled before computing
   // the index of each tensor
   std::unordered_map<TensorView*, AllocationDomainInfo> alloc_info_;
+
+  // Memoized results of getIndexingPath and computeIndex. See
+  // canMemoizeIndexing.
+  mutable std::
+      unordered_map<IndexingPathKey, ExprPath<ExprGroup>, IndexingPathKey::Hash>
+          indexing_path_cache_;
+  mutable std::unordered_map<IndexKey, IndexingInfo, IndexKey::Hash>
+      index_cache_;
+  mutable std::unordered_map<const TensorView*, bool> has_resize_;
+  // Sizes of the traversal graph when the caches were last validated
+  mutable int64_t num_cached_val_groups_ = -1;
+  mutable int64_t num_cached_expr_groups_ = -1;
+  mutable IndexingCacheStats cache_stats_;
 };
 
 } // namespace nvfuser
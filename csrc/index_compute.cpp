@@ -25,6 +25,7 @@
 #include <logical_domain_map.h>
 #include <ops/arith.h>
 #include <swizzle.h>
+#include <target_device.h>
 #include <transform_iter.h>
 #include <transform_replay.h>
 
@@ -2253,7 +2254,7 @@ kir::TensorIndex* Index::getProducerIndex(
 
   index = GpuLower::current()->commonScalarMap().hoistScalar(index, loops);
   if (ir_utils::isLdMatrixOp(consumer->definition()) &&
-      at::cuda::getCurrentDeviceProperties()->major < 8) {
+      getTargetDeviceProperties()->major < 8) {
     auto items_per_thread = ir_utils::getVectorizeSize(consumer);
     if (items_per_thread != 8) {
       // For Turing, unused indices for ldmatrix needs to be aligned, although
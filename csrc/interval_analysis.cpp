@@ -11,6 +11,7 @@
 #include <exceptions.h>
 #include <interval_analysis.h>
 #include <kernel_ir_dispatch.h>
+#include <target_device.h>
 
 #include <algorithm>
 #include <limits>
@@ -475,7 +476,7 @@ void ScalarBoundsCalculator::dispatch(Expr* expr) {
       // metadata for tensors with swizzles.
       // TODO: is there a better workaround?
       int64_t max_smem_addr =
-          (int64_t)at::cuda::getCurrentDeviceProperties()->sharedMemPerBlock -
+          (int64_t)getTargetDeviceProperties()->sharedMemPerBlock -
           1L;
       known_scalars_[uop->out()] = max_smem_addr;
       setBounds(uop->out(), 0L, max_smem_addr);
@@ -391,6 +391,15 @@ class NVF_API Val : public Statement {
     return evaluator_index_;
   }
 
+  //! Dense index of this Val among the Vals registered with its container,
+  //! so that per-container state can be kept in an array instead of a hash
+  //! map. See ExpressionEvaluator. -1 if not registered.
+  int64_t slot() const {
+    return slot_;
+  }
+
+  void setSlot(IrContainerPasskey, int64_t slot);
+
   // Following is managed by Fusion (or kirIrBuilder) and can change.
   // TODO: Protect with a passkey.
   void setDefinition(Expr* expr) {
@@ -445,6 +454,9 @@ class NVF_API Val : public Statement {
   // Expr evaluator idx;
   int evaluator_index_ = -1;
 
+  // Assigned by IrContainer::registerVal
+  int64_t slot_ = -1;
+
   // The concrete value of this Val. This is only used for constant Vals.
   // Depending on the actual type of the Val, the allowed types of the
   // value_ can be different. For example, for a TensorView, the value_ must be
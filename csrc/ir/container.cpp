@@ -14,6 +14,29 @@
 
 namespace nvfuser {
 
+namespace {
+
+void checkIrWritable() {
+#ifndef NDEBUG
+  NVF_ERROR(
+      !IrReadOnlyGuard::isActive(),
+      "The IR is read-only on this thread. A lowering task that creates or "
+      "removes IR nodes must declare writing LowerResource::FusionIr.");
+#endif
+}
+
+} // namespace
+
+thread_local bool IrReadOnlyGuard::active_ = false;
+
+IrReadOnlyGuard::IrReadOnlyGuard() : prev_active_(active_) {
+  active_ = true;
+}
+
+IrReadOnlyGuard::~IrReadOnlyGuard() {
+  active_ = prev_active_;
+}
+
 void swap(IrContainer& a, IrContainer& b) noexcept {
   FUSER_PERF_SCOPE("Fusion swap");
 
@@ -28,6 +51,7 @@ void swap(IrContainer& a, IrContainer& b) noexcept {
 
   swap(a.val_type_name_map_, b.val_type_name_map_);
   swap(a.expr_name_counter_, b.expr_name_counter_);
+  swap(a.val_slot_counter_, b.val_slot_counter_);
 
   swap(a.metadata_, b.metadata_);
 
@@ -134,6 +158,7 @@ void IrContainer::registerExpr(IrBuilderPasskey, Expr* expr) {
 }
 
 void IrContainer::removeExpr(Expr* expr) {
+  checkIrWritable();
   NVF_ERROR(
       exprs_.find(expr) != exprs_.end(),
       "Wanted to remove an expression but it doesn't exist in this container.");
@@ -153,6 +178,7 @@ void IrContainer::removeExpr(Expr* expr) {
 //! Completely remove val from the fusion, break all dependencies associated
 //! with it
 void IrContainer::removeVal(Val* val) {
+  checkIrWritable();
   // Don't remove shortcuts
   if (val == true_val_.get() || val == false_val_.get() ||
       val == one_val_.get() || val == zero_val_.get() ||
@@ -181,10 +207,12 @@ void IrContainer::registerVal(Val* val) {
   if (inContainer(val)) {
     return;
   }
+  checkIrWritable();
 
   vals_up_.emplace_back(val);
   vals_.insert(val);
   val->setName(IrContainerPasskey(), getValName(val->vtype()));
+  val->setSlot(IrContainerPasskey(), val_slot_counter_++);
 }
 
 //! Register expr with this container.
@@ -192,6 +220,7 @@ void IrContainer::registerExpr(Expr* expr) {
   if (inContainer(expr)) {
     return;
   }
+  checkIrWritable();
   exprs_up_.emplace_back(expr);
   exprs_.insert(expr);
   expr->setName(IrContainerPasskey(), getExprName());
@@ -207,6 +236,7 @@ void IrContainer::clear() noexcept {
   val_type_name_map_.clear();
   metadata_.clear();
   expr_name_counter_ = 0;
+  val_slot_counter_ = 0;
 }
 
 bool IrContainer::inContainer(const Statement* const_stmt) const {
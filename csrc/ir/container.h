@@ -32,6 +32,28 @@ class IrContainerPasskey {
   explicit IrContainerPasskey() = default;
 };
 
+//! Makes registering or removing Statements in any container fail on the
+//! calling thread while in scope. Used for code that must only read the IR,
+//! e.g., lowering analyses running concurrently. The check is only done in
+//! debug builds.
+class IrReadOnlyGuard {
+ public:
+  NVF_API IrReadOnlyGuard();
+  NVF_API ~IrReadOnlyGuard();
+
+  IrReadOnlyGuard(const IrReadOnlyGuard&) = delete;
+  IrReadOnlyGuard& operator=(const IrReadOnlyGuard&) = delete;
+
+  static bool isActive() {
+    return active_;
+  }
+
+ private:
+  bool prev_active_;
+
+  static thread_local bool active_;
+};
+
 class IrContainer : public PolymorphicBase {
  public:
   NVF_API IrContainer();
@@ -195,7 +217,7 @@ class IrContainer : public PolymorphicBase {
   // itself.
   //
   // Used by StatementGuard only.
-  void removeStatementsCreatedAfter(
+  virtual void removeStatementsCreatedAfter(
       int64_t prev_num_exprs,
       int64_t prev_num_vals);
 
@@ -219,6 +241,9 @@ class IrContainer : public PolymorphicBase {
   // Expression names counter
   StmtNameType expr_name_counter_ = 0;
 
+  // Next Val::slot() to assign
+  int64_t val_slot_counter_ = 0;
+
   // Manually store some persistent, frequently used nodes. It's very
   // challenging to do this anything but manually as detecting when a container
   // may or may not have one of these vals is tricky. Specifically because if
@@ -0,0 +1,294 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <multidevice/communication_cost.h>
+
+#include <algorithm>
+#include <set>
+
+#include <expr_evaluator.h>
+#include <host_ir/lower_to_communication.h>
+#include <ir/iostream.h>
+#include <ir/utils.h>
+#include <logical_domain_map.h>
+#include <multidevice/utils.h>
+
+namespace nvfuser {
+
+int64_t CommunicationCostModel::bytesPerDevice(
+    CommunicationType type,
+    int64_t team_size,
+    int64_t unsharded_bytes) const {
+  NVF_ERROR(team_size > 0, "Expected a positive team size: ", team_size);
+  NVF_ERROR(
+      unsharded_bytes >= 0,
+      "Expected a non-negative size: ",
+      unsharded_bytes);
+  if (team_size == 1) {
+    return 0;
+  }
+  switch (type) {
+    case CommunicationType::Allgather:
+    case CommunicationType::ReduceScatter:
+    case CommunicationType::Gather:
+    case CommunicationType::Scatter:
+    case CommunicationType::Reduce:
+      // Each device (or the root for rooted collectives) exchanges all but its
+      // own 1/team_size of the buffer.
+      return unsharded_bytes * (team_size - 1) / team_size;
+    case CommunicationType::Allreduce:
+      // A ring allreduce is a reduce-scatter followed by an allgather.
+      return 2 * (unsharded_bytes * (team_size - 1) / team_size);
+    case CommunicationType::Broadcast:
+      // Pipelined along the ring, every non-leaf device forwards the whole
+      // buffer once.
+      return unsharded_bytes;
+    case CommunicationType::SendRecv:
+      // Each sender sends its own shard.
+      return unsharded_bytes / team_size;
+    default:
+      NVF_THROW("unrecognized CommunicationType: ", type);
+  }
+}
+
+int64_t CommunicationCostModel::numSteps(
+    CommunicationType type,
+    int64_t team_size) const {
+  if (team_size <= 1) {
+    return 0;
+  }
+  switch (type) {
+    case CommunicationType::Allreduce:
+      return 2 * (team_size - 1);
+    case CommunicationType::SendRecv:
+      return 1;
+    default:
+      return team_size - 1;
+  }
+}
+
+double CommunicationCostModel::time(
+    CommunicationType type,
+    int64_t team_size,
+    int64_t unsharded_bytes) const {
+  NVF_ERROR(
+      link_bandwidth > 0.0,
+      "Expected a positive link bandwidth: ",
+      link_bandwidth);
+  return static_cast<double>(numSteps(type, team_size)) * link_latency +
+      static_cast<double>(bytesPerDevice(type, team_size, unsharded_bytes)) /
+      link_bandwidth;
+}
+
+std::ostream& operator<<(std::ostream& os, const CommunicationCost& cost) {
+  os << cost.type << " among " << cost.team_size << " devices: ";
+  if (cost.bytes_per_device.has_value()) {
+    os << *cost.bytes_per_device << " bytes per device, " << *cost.time * 1e6
+       << " us";
+  } else {
+    os << "unknown size";
+  }
+  if (cost.expr != nullptr) {
+    os << " for " << cost.expr->toString();
+  }
+  return os;
+}
+
+std::optional<int64_t> unshardedSizeInBytes(
+    TensorView* tv,
+    const ExpressionEvaluator* expr_eval) {
+  int64_t numel = 1;
+  for (IterDomain* id : TensorDomain::noReductions(tv->getLogicalDomain())) {
+    if (id->isBroadcast()) {
+      continue;
+    }
+    Val* extent = id->getMaybeExpandedExtent();
+    if (extent->isConstInt()) {
+      numel *= extent->evaluate().as<int64_t>();
+      continue;
+    }
+    if (expr_eval == nullptr) {
+      return std::nullopt;
+    }
+    PolymorphicValue value = expr_eval->evaluate(extent);
+    if (!value.hasValue()) {
+      return std::nullopt;
+    }
+    numel *= value.as<int64_t>();
+  }
+  return numel * dataTypeSize(tv->dtype());
+}
+
+namespace {
+
+// Unlike isSharded, this looks at the loop domain because allocation domains
+// are not yet set when the preseg passes decide where to reshard.
+bool isShardedOnMesh(TensorView* tv) {
+  return tv->hasDeviceMesh() && numDeviceDims(tv) > 0 &&
+      tv->getDeviceMesh().size() > 1;
+}
+
+int64_t numInvolvedDevices(TensorView* from, TensorView* to) {
+  std::set<DeviceIdxType> devices;
+  for (TensorView* tv : {from, to}) {
+    if (tv->hasDeviceMesh()) {
+      const auto& mesh = tv->getDeviceMesh().vector();
+      devices.insert(mesh.begin(), mesh.end());
+    } else {
+      devices.insert(0);
+    }
+  }
+  return std::ssize(devices);
+}
+
+// Returns whether `data` is computed by reducing a dimension `from` is
+// sharded on. Computed with the sharding of `from`, every device then holds a
+// partial result of all of `data`.
+bool reducesShardedDimension(TensorView* from, TensorView* data) {
+  Expr* def = data->definition();
+  if (def == nullptr || !ir_utils::isReductionOp(def) ||
+      std::find(def->inputs().begin(), def->inputs().end(), from) ==
+          def->inputs().end()) {
+    return false;
+  }
+  const auto p2c = PairwiseLogicalDomainMap(from, data).mapProducerToConsumer();
+  for (IterDomain* loop_id : from->getLoopDomain()) {
+    if (!loop_id->isDeviceDim()) {
+      continue;
+    }
+    for (IterDomain* logical_id :
+         getInputsInTargetDomain(loop_id, from->getLogicalDomain())) {
+      auto it = p2c.find(logical_id);
+      if (it != p2c.end() && it->second->isReduction()) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+CommunicationCost makeCost(
+    Expr* e,
+    CommunicationType type,
+    int64_t team_size,
+    std::optional<int64_t> unsharded_bytes,
+    const CommunicationCostModel& model) {
+  CommunicationCost cost;
+  cost.expr = e;
+  cost.type = type;
+  cost.team_size = team_size;
+  if (unsharded_bytes.has_value()) {
+    cost.bytes_per_device =
+        model.bytesPerDevice(type, team_size, *unsharded_bytes);
+    cost.time = model.time(type, team_size, *unsharded_bytes);
+  }
+  return cost;
+}
+
+} // namespace
+
+std::optional<CommunicationCost> predictReshardingCost(
+    TensorView* data,
+    TensorView* from,
+    TensorView* to,
+    const CommunicationCostModel& model,
+    const ExpressionEvaluator* expr_eval) {
+  if (!haveDifferentShardings(from, to)) {
+    return std::nullopt;
+  }
+
+  const bool same_mesh = from->getDeviceMesh() == to->getDeviceMesh();
+  const bool from_sharded = isShardedOnMesh(from);
+  const bool to_sharded = isShardedOnMesh(to);
+
+  // Mirrors the LoadStoreOp branch of convertSingleOpToCommunication.
+  CommunicationType type = CommunicationType::Broadcast;
+  int64_t team_size = numInvolvedDevices(from, to);
+  if (from_sharded && same_mesh && reducesShardedDimension(from, data)) {
+    // The partial results are reduced, and scattered if `to` is sharded.
+    type = to_sharded ? CommunicationType::ReduceScatter
+                      : CommunicationType::Allreduce;
+    team_size = from->getDeviceMesh().size(ParallelType::DIDx);
+  } else if (!from_sharded && to_sharded) {
+    type = CommunicationType::Scatter;
+  } else if (from_sharded && !to_sharded) {
+    if (same_mesh) {
+      type = CommunicationType::Allgather;
+      team_size = from->getDeviceMesh().size(ParallelType::DIDx);
+    } else {
+      type = CommunicationType::Gather;
+    }
+  } else if (from_sharded) {
+    type = CommunicationType::SendRecv;
+    team_size = from->getDeviceMesh().size();
+  }
+
+  return makeCost(
+      /*e=*/nullptr,
+      type,
+      team_size,
+      unshardedSizeInBytes(data, expr_eval),
+      model);
+}
+
+std::optional<CommunicationCost> predictCommunicationCost(
+    Expr* e,
+    const CommunicationCostModel& model,
+    const ExpressionEvaluator* expr_eval) {
+  std::optional<CommunicationInfo> info = getCommunicationInfo(e);
+  if (!info.has_value()) {
+    return std::nullopt;
+  }
+
+  auto* producer = e->inputs().at(0)->as<TensorView>();
+  auto* consumer = e->outputs().at(0)->as<TensorView>();
+
+  int64_t team_size = 0;
+  switch (info->type) {
+    case CommunicationType::Allgather:
+    case CommunicationType::Allreduce:
+    case CommunicationType::ReduceScatter:
+      // These are lowered to collectives among the DIDx slice of the mesh.
+      team_size = producer->getDeviceMesh().size(ParallelType::DIDx);
+      break;
+    case CommunicationType::SendRecv:
+      team_size = producer->getDeviceMesh().size();
+      break;
+    default:
+      team_size = std::ssize(involvedDevices(e));
+      break;
+  }
+
+  // Logical extents are global, so the consumer's logical size is the size of
+  // the buffer each CommunicationCostModel formula expects: the gathered
+  // output, the (all)reduced buffer, or the unsharded tensor being scattered.
+  return makeCost(
+      e,
+      info->type,
+      team_size,
+      unshardedSizeInBytes(consumer, expr_eval),
+      model);
+}
+
+std::vector<CommunicationCost> predictCommunicationCosts(
+    Fusion* fusion,
+    const CommunicationCostModel& model,
+    const ExpressionEvaluator* expr_eval) {
+  std::vector<CommunicationCost> costs;
+  for (Expr* e : fusion->exprs()) {
+    if (!isResharding(e)) {
+      continue;
+    }
+    if (std::optional<CommunicationCost> cost =
+            predictCommunicationCost(e, model, expr_eval)) {
+      costs.push_back(*cost);
+    }
+  }
+  return costs;
+}
+
+} // namespace nvfuser
@@ -0,0 +1,112 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <iosfwd>
+#include <optional>
+#include <vector>
+
+#include <fusion.h>
+#include <ir/interface_nodes.h>
+#include <multidevice/communication.h>
+#include <visibility.h>
+
+namespace nvfuser {
+
+class ExpressionEvaluator;
+
+// An analytic model of the cost of a collective. It assumes ring algorithms
+// where every device sends to and receives from one neighbor per step, so the
+// time of a collective is
+//
+//   num_steps * link_latency + bytes_per_device / link_bandwidth
+//
+// This is meant to compare alternative shardings of the same fusion, not to
+// predict wall-clock time precisely. Unit tests construct models with
+// arbitrary parameters, so nothing here queries the devices.
+struct CommunicationCostModel {
+  // Bytes per second a device can send over one link.
+  double link_bandwidth = 100e9;
+  // Seconds of fixed overhead per step of a collective.
+  double link_latency = 5e-6;
+
+  // Returns the number of bytes each device sends for a collective of type
+  // `type` among `team_size` devices. `unsharded_bytes` is the size of the
+  // tensor being communicated as seen by the fusion, i.e., its logical size.
+  // For Allgather and Gather, this is the size of the gathered output. For
+  // Scatter and ReduceScatter, this is the size of the unsharded input. For
+  // Allreduce, Reduce and Broadcast, this is the size of the (replicated)
+  // buffer. For SendRecv, this is the size of the tensor before sharding and
+  // each device sends its shard.
+  int64_t bytesPerDevice(
+      CommunicationType type,
+      int64_t team_size,
+      int64_t unsharded_bytes) const;
+
+  // Returns the number of latency-bound steps of a collective.
+  int64_t numSteps(CommunicationType type, int64_t team_size) const;
+
+  // Returns the predicted time in seconds.
+  double time(
+      CommunicationType type,
+      int64_t team_size,
+      int64_t unsharded_bytes) const;
+};
+
+// The predicted cost of one resharding expression.
+struct CommunicationCost {
+  Expr* expr = nullptr;
+  CommunicationType type = CommunicationType::Broadcast;
+  int64_t team_size = 1;
+  // Unset when the size of the communicated tensor is unknown at compile time,
+  // e.g., because its extents are symbolic.
+  std::optional<int64_t> bytes_per_device;
+  std::optional<double> time;
+};
+
+std::ostream& operator<<(std::ostream& os, const CommunicationCost& cost);
+
+// Returns the logical size in bytes of `tv`, ignoring reduction and broadcast
+// dimensions. Sharded dimensions count with their global extents. Returns
+// std::nullopt if any extent can't be evaluated, either as a constant or by
+// `expr_eval` when given.
+std::optional<int64_t> unshardedSizeInBytes(
+    TensorView* tv,
+    const ExpressionEvaluator* expr_eval = nullptr);
+
+// Predicts the cost of resharding `data` from the sharding of `from` to the
+// sharding of `to`. The communication type is inferred the same way
+// `convertSingleOpToCommunication` does for a LoadStoreOp, except when `data`
+// is computed from `from` by reducing a dimension `from` is sharded on. Then,
+// `data` computed with the sharding of `from` holds partial results, so the
+// resharding is an Allreduce, or a ReduceScatter if `to` is sharded. This can
+// be used to compare candidate positions of a resharding `set` before it is
+// inserted. Returns std::nullopt if the two shardings are the same.
+std::optional<CommunicationCost> predictReshardingCost(
+    TensorView* data,
+    TensorView* from,
+    TensorView* to,
+    const CommunicationCostModel& model,
+    const ExpressionEvaluator* expr_eval = nullptr);
+
+// Predicts the cost of a resharding expression that's known to be lowerable to
+// a single communication, i.e., `getCommunicationInfo(e)` has a value.
+std::optional<CommunicationCost> predictCommunicationCost(
+    Expr* e,
+    const CommunicationCostModel& model,
+    const ExpressionEvaluator* expr_eval = nullptr);
+
+// A dry run of communication lowering. Returns the predicted cost of every
+// resharding expression in `fusion` in topological order. This requires the
+// fusion to have gone through InsertReshardingsPass. No devices are needed.
+NVF_API std::vector<CommunicationCost> predictCommunicationCosts(
+    Fusion* fusion,
+    const CommunicationCostModel& model,
+    const ExpressionEvaluator* expr_eval = nullptr);
+
+} // namespace nvfuser
@@ -6,6 +6,7 @@
  */
 // clang-format on
 #include <options.h>
+#include <target_device.h>
 #include <utils.h>
 
 namespace nvfuser {
@@ -102,6 +103,7 @@ std::unordered_map<DebugDumpOption, std::vector<std::string>> Options<
       {"bank_conflict", DebugDumpOption::BankConflictInfo},
       {"buffer_reuse_verbose", DebugDumpOption::BufferReuseInfo},
       {"ca_map", DebugDumpOption::ComputeAtMap},
+      {"communication_cost", DebugDumpOption::CommunicationCost},
       {"cubin", DebugDumpOption::Cubin},
       {"cuda_full", DebugDumpOption::CudaFull},
       {"cuda_kernel", DebugDumpOption::CudaKernel},
@@ -120,6 +122,7 @@ std::unordered_map<DebugDumpOption, std::vector<std::string>> Options<
       {"fusion_ir_presched", DebugDumpOption::FusionIrPresched},
       {"fusion_ir_preseg", DebugDumpOption::FusionIrPreseg},
       {"global_zeroed_memory", DebugDumpOption::GlobalZeroedMemory},
+      {"heuristic_candidates", DebugDumpOption::HeuristicCandidates},
       {"host_ir_lowering_logging", DebugDumpOption::HostIrLoweringLogging},
       {"host_ir", DebugDumpOption::HostIr},
       {"index_type", DebugDumpOption::IndexType},
@@ -143,6 +146,7 @@ std::unordered_map<DebugDumpOption, std::vector<std::string>> Options<
       {"sass_to_file", DebugDumpOption::SassToFile},
       {"segmented_fusion", DebugDumpOption::FusionSegments},
       {"segmenter_logging", DebugDumpOption::FusionSegmenterLog},
+      {"shape_bucketing", DebugDumpOption::ShapeBucketing},
       {"scheduler_params", DebugDumpOption::SchedulerDebug},
       {"dynamic_shared_memory", DebugDumpOption::DynamicSharedMemory},
       {"scheduler_verbose", DebugDumpOption::SchedulerVerbose},
@@ -155,8 +159,11 @@ std::unordered_map<DebugDumpOption, std::vector<std::string>> Options<
 const std::unordered_map<std::string, EnableOption>& getEnableOptions() {
   static const std::unordered_map<std::string, EnableOption> available_options =
       {
+          {"async_compile", EnableOption::AsyncCompile},
+          {"foreach_scheduler", EnableOption::ForEachScheduler},
           {"fuse_matmul", EnableOption::FuseMatmul},
           {"fuse_multiple_matmuls", EnableOption::FuseMultipleMatmuls},
+          {"horizontal_fusion", EnableOption::HorizontalFusion},
           {"id_model", EnableOption::IdModel},
           {"id_model_extra_validation", EnableOption::IdModelExtraValidation},
           {"io_to_lower_precision", EnableOption::IoToLowerPrecision},
@@ -166,6 +173,7 @@ const std::unordered_map<std::string, EnableOption>& getEnableOptions() {
           {"kernel_profile", EnableOption::KernelProfile},
           {"memory_promotion", EnableOption::MemoryPromotion},
           {"reuse_zeroed_memory", EnableOption::ReuseZeroedMemory},
+          {"shape_bucketing", EnableOption::ShapeBucketing},
           {"static_fusion_count", EnableOption::StaticFusionCount},
           {"wait_debugger", EnableOption::WaitDebugger},
           {"warn_register_spill", EnableOption::WarnRegisterSpill},
@@ -208,6 +216,7 @@ const std::unordered_map<std::string, DisableOption>& getDisableOptions() {
           {"matmul_expr_eval", DisableOption::MatmulExprEval},
           {"nvtx", DisableOption::Nvtx},
           {"parallel_compile", DisableOption::ParallelCompile},
+          {"parallel_lowering", DisableOption::ParallelLowering},
           {"parallel_serde", DisableOption::ParallelSerde},
           {"predicate_elimination", DisableOption::PredicateElimination},
           {"python_inline_definitions", DisableOption::PythonInlineDefinitions},
@@ -263,13 +272,81 @@ std::unordered_map<ProfilerOption, std::vector<std::string>> Options<
   return options;
 }
 
+namespace {
+
+// The snapshot of `owner` the current thread inherited, if any. See
+// InheritedOptionsGuard.
+template <typename OptionEnum>
+struct InheritedSnapshot {
+  const Options<OptionEnum>* owner = nullptr;
+  const OptionsSnapshot<OptionEnum>* snapshot = nullptr;
+};
+
+template <typename OptionEnum>
+InheritedSnapshot<OptionEnum>& inheritedSnapshot() {
+  thread_local InheritedSnapshot<OptionEnum> inherited;
+  return inherited;
+}
+
+} // namespace
+
+template <typename OptionEnum>
+const OptionsSnapshot<OptionEnum>* Options<OptionEnum>::snapshot() const {
+  const InheritedSnapshot<OptionEnum>& inherited =
+      inheritedSnapshot<OptionEnum>();
+  if (inherited.owner == this) {
+    return inherited.snapshot;
+  }
+  return current_.load(std::memory_order_acquire);
+}
+
+template <typename OptionEnum>
+void Options<OptionEnum>::restore(const Snapshot* snapshot) {
+  NVF_ERROR(snapshot != nullptr);
+  std::lock_guard<std::mutex> lock(mutex_);
+  InheritedSnapshot<OptionEnum>& inherited = inheritedSnapshot<OptionEnum>();
+  if (inherited.owner == this) {
+    inherited.snapshot = snapshot;
+  } else {
+    current_.store(snapshot, std::memory_order_release);
+  }
+}
+
+template <typename OptionEnum>
+void Options<OptionEnum>::publish(Snapshot snapshot) {
+  auto it = std::find_if(
+      snapshots_.begin(),
+      snapshots_.end(),
+      [&](const std::unique_ptr<const Snapshot>& interned) {
+        return *interned == snapshot;
+      });
+  const Snapshot* published = nullptr;
+  if (it != snapshots_.end()) {
+    published = it->get();
+  } else {
+    published =
+        snapshots_.emplace_back(std::make_unique<Snapshot>(std::move(snapshot)))
+            .get();
+  }
+
+  InheritedSnapshot<OptionEnum>& inherited = inheritedSnapshot<OptionEnum>();
+  if (inherited.owner == this) {
+    inherited.snapshot = published;
+  } else {
+    current_.store(published, std::memory_order_release);
+  }
+}
+
+template class Options<DebugDumpOption>;
+template class Options<EnableOption>;
+template class Options<DisableOption>;
+template class Options<ProfilerOption>;
+
 template <>
 Options<DebugDumpOption>& OptionsGuard<DebugDumpOption>::getCurOptions() {
-  // Note: Make options thread_local.
-  // We want the behavior that new threads would inherit options from the *base*
-  // threads. We need to figure out how to automatically do that before
-  // switching to thread_local. For now we are using mutex to guard option
-  // access, which is necessary to avoid data racing.
+  // Options are process-wide, so threads see the options of the thread that
+  // started them unless either changes them. Work that must keep the options
+  // of the thread that created it uses InheritedOptionsGuard.
   static DebugDumpOptions active_dump_options;
   return active_dump_options;
 }
@@ -349,4 +426,55 @@ bool isProfilerPrintingVerbose() {
       ProfilerOption::PrintVerbose);
 }
 
+namespace {
+
+template <typename OptionEnum>
+const OptionsSnapshot<OptionEnum>* inheritedOrCurrent() {
+  return OptionsGuard<OptionEnum>::getCurOptions().snapshot();
+}
+
+// Makes the calling thread read `snapshot` of the current options, or the
+// process-wide ones if it's null. Returns what it read before, or null if
+// it read the process-wide ones.
+template <typename OptionEnum>
+const OptionsSnapshot<OptionEnum>* inherit(
+    const OptionsSnapshot<OptionEnum>* snapshot) {
+  InheritedSnapshot<OptionEnum>& inherited = inheritedSnapshot<OptionEnum>();
+  const OptionsSnapshot<OptionEnum>* prev = inherited.snapshot;
+  if (snapshot == nullptr) {
+    inherited = {};
+  } else {
+    inherited = {&OptionsGuard<OptionEnum>::getCurOptions(), snapshot};
+  }
+  return prev;
+}
+
+} // namespace
+
+InheritedOptions InheritedOptions::capture() {
+  return {
+      .debug_dump = inheritedOrCurrent<DebugDumpOption>(),
+      .enable = inheritedOrCurrent<EnableOption>(),
+      .disable = inheritedOrCurrent<DisableOption>(),
+      .profiler = inheritedOrCurrent<ProfilerOption>(),
+      .target_device = guardedTargetDevice()};
+}
+
+InheritedOptionsGuard::InheritedOptionsGuard(const InheritedOptions& options)
+    : prev_{
+          .debug_dump = inherit(options.debug_dump),
+          .enable = inherit(options.enable),
+          .disable = inherit(options.disable),
+          .profiler = inherit(options.profiler),
+          .target_device =
+              exchangeGuardedTargetDevice(options.target_device)} {}
+
+InheritedOptionsGuard::~InheritedOptionsGuard() {
+  inherit(prev_.debug_dump);
+  inherit(prev_.enable);
+  inherit(prev_.disable);
+  inherit(prev_.profiler);
+  exchangeGuardedTargetDevice(prev_.target_device);
+}
+
 } // namespace nvfuser
@@ -11,6 +11,9 @@
 #include <visibility.h>
 
 #include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -18,6 +21,8 @@
 
 namespace nvfuser {
 
+struct TargetDeviceProperties;
+
 //! Types of debug print-outs
 //!
 //! These can be set through the `NVFUSER_DUMP` environment variable
@@ -46,6 +51,8 @@ enum class DebugDumpOption {
                 //!< for conciseness
   KernelIr, //!< Dump the compiler Kernel IR
   ComputeAtMap, //!< Dump the computeAt map
+  CommunicationCost, //!< Dump the predicted cost of every resharding
+                     //!< expression after InsertReshardingsPass
   CudaKernel, //!< Dump the generated CUDA C++ kernel code
   CudaFull, //!< Dump the complete CUDA C++ code
   CudaToFile, //!< Dump CUDA Strings to File
@@ -62,6 +69,11 @@ enum class DebugDumpOption {
   BufferReuseInfo, //!< Dump the analysis details of local/shared buffer re-use
   SchedulerDebug, //! Dump scheduler heuristic parameters
   SchedulerVerbose, //! Dump detailed scheduler logging
+  ShapeBucketing, //! Dump the shape bucketing stats of every runtime lookup,
+                  //! including how many recompilations it avoided
+  HeuristicCandidates, //! Dump the predicted cost of each segment's heuristic
+                       //! parameters and of the best alternatives. Takes the
+                       //! number of alternatives as an optional argument
   ParallelDimensions, //!< Dump known parallel dimensions
   PerfDebugVerbose, //! When running kernels, print verbose information
                     //! associated with what's running
@@ -95,8 +107,14 @@ enum class DebugDumpOption {
 //! These can be set through the `NVFUSER_ENABLE` environment variable
 //!
 enum class EnableOption {
+  AsyncCompile, //! Compile new kernels in the background and evaluate fusions
+                //! op by op with ATen until they are ready
+  ForEachScheduler, //! Enable the scheduler for fusions applying the same
+                    //! pointwise ops to many independent tensors
   FuseMatmul, //! Enable automatic fusion of matmul and linear ops
   FuseMultipleMatmuls, //! Allow fusing more than one matmul in a single kernel
+  HorizontalFusion, //! Launch independent segments of a segmented fusion as
+                    //! one kernel
   IdModel, //! Enable IdModel
   IdModelExtraValidation, //! Enable extra error checking when building IdModel
   IoToLowerPrecision, //! Enable castInputOutputToLowerPrecision. #1889 explains
@@ -108,6 +126,9 @@ enum class EnableOption {
   KernelProfile, //! Enable intra-kernel performance profiling
   MemoryPromotion, //! Enable promotion of memory types for non-pointwise ops
   ReuseZeroedMemory, //! Re-use zeroed memory used for grid synchronization
+  ShapeBucketing, //! Compute heuristics for bucketed input shapes. Optional
+                  //! arguments are increasing bucket boundaries; powers of
+                  //! two are used by default.
   StaticFusionCount, //! Enable using single static count in kernel name
   WaitDebugger, // Used for debugging multi-GPU. The rank given in the argument
                 // will wait for `gdb attach` at the start.
@@ -137,6 +158,8 @@ enum class DisableOption {
                   //! matmul
   Nvtx, //! Disable NVTX instrumentation
   ParallelCompile, //! Disable compiling Fusion segments in parallel
+  ParallelLowering, //! Disable running independent lowering analyses
+                    //! concurrently
   ParallelSerde, //! Disable deserializing FusionExecutorCache in parallel
   PredicateElimination, //! Disable predicate elimination
   PythonInlineDefinitions, //! Disable printing of inline definitions
@@ -177,81 +200,144 @@ enum class ProfilerOption {
   EndOfOption //! Placeholder for counting the number of elements
 };
 
+//! An immutable set of options of one kind, with their arguments. Options
+//! never modifies a snapshot. It publishes a new one instead, so reading
+//! options takes neither a lock nor a copy.
+template <typename OptionEnum>
+struct OptionsSnapshot {
+  std::bitset<static_cast<size_t>(OptionEnum::EndOfOption)> enabled;
+  std::unordered_map<OptionEnum, std::vector<std::string>> args;
+
+  bool has(OptionEnum option) const {
+    return enabled.test(static_cast<size_t>(option));
+  }
+
+  bool operator==(const OptionsSnapshot& other) const = default;
+};
+
 //! The base template class for the options such as EnableOption
+//!
+//! Reads load the current snapshot with a single atomic load, so they don't
+//! contend even when every compilation thread queries options. Writes are
+//! serialized and publish a new snapshot. Snapshots are interned and kept
+//! alive as long as the Options, so a reader may keep using the one it
+//! loaded, and getArgs returns references that stay valid.
 template <typename OptionEnum>
 class Options {
  public:
-  Options() : options_(getOptionsFromEnv()) {}
+  using Snapshot = OptionsSnapshot<OptionEnum>;
+
+  Options() {
+    Snapshot snapshot;
+    snapshot.args = getOptionsFromEnv();
+    for (const auto& [option, args] : snapshot.args) {
+      snapshot.enabled.set(static_cast<size_t>(option));
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    publish(std::move(snapshot));
+  }
 
   Options(const Options& other) {
-    std::lock_guard<std::mutex> lock_other(other.mutex_);
-    options_ = other.options_;
+    std::lock_guard<std::mutex> lock(mutex_);
+    publish(*other.snapshot());
   }
 
   Options& operator=(const Options& other) {
-    std::lock_guard<std::mutex> lock_other(other.mutex_);
-    std::lock_guard<std::mutex> lock(mutex_);
-    options_ = other.options_;
+    if (this != &other) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      publish(*other.snapshot());
+    }
     return *this;
   }
 
   bool has(OptionEnum option) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return options_.count(option);
+    return snapshot()->has(option);
   }
 
   bool hasAny() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return !options_.empty();
+    return snapshot()->enabled.any();
   }
 
   const std::vector<std::string>& getArgs(OptionEnum option) const {
-    NVF_ERROR(has(option), "Option not set");
-    std::lock_guard<std::mutex> lock(mutex_);
-    return options_.at(option);
+    const Snapshot* current = snapshot();
+    NVF_ERROR(current->has(option), "Option not set");
+    return current->args.at(option);
   }
 
   bool hasArg(OptionEnum option, const std::string& arg) const {
-    if (!has(option)) {
+    const Snapshot* current = snapshot();
+    if (!current->has(option)) {
       return false;
     }
-    const auto& args = getArgs(option);
+    const auto& args = current->args.at(option);
     return std::find(args.begin(), args.end(), arg) != args.end();
   }
 
   void set(OptionEnum option_type, std::vector<std::string> option = {}) {
     std::lock_guard<std::mutex> lock(mutex_);
-    options_[option_type] = option;
+    Snapshot next = *snapshot();
+    next.enabled.set(static_cast<size_t>(option_type));
+    next.args[option_type] = std::move(option);
+    publish(std::move(next));
   }
 
   void unset(OptionEnum option_type) {
     std::lock_guard<std::mutex> lock(mutex_);
-    options_.erase(option_type);
+    Snapshot next = *snapshot();
+    next.enabled.reset(static_cast<size_t>(option_type));
+    next.args.erase(option_type);
+    publish(std::move(next));
   }
 
+  //! The snapshot this thread reads: the one it inherited through an
+  //! InheritedOptionsGuard, if any, or else the one published to all
+  //! threads. It stays valid as long as this Options.
+  NVF_API const Snapshot* snapshot() const;
+
+  //! Makes `snapshot`, which must have come from snapshot() of this Options,
+  //! current again. Used by OptionsGuard.
+  NVF_API void restore(const Snapshot* snapshot);
+
   NVF_API static std::unordered_map<OptionEnum, std::vector<std::string>>
   getOptionsFromEnv();
 
- protected:
-  std::unordered_map<OptionEnum, std::vector<std::string>> options_;
-  mutable std::mutex mutex_;
+ private:
+  // Interns `snapshot` and makes it current, for this thread only if it
+  // inherited its options, or else for all threads. Requires mutex_.
+  NVF_API void publish(Snapshot snapshot);
+
+  // Points into snapshots_.
+  std::atomic<const Snapshot*> current_{nullptr};
+  // Every distinct snapshot published so far. Options change rarely, mostly
+  // in tests, which toggle between a handful of states.
+  std::vector<std::unique_ptr<const Snapshot>> snapshots_;
+  // Serializes writers.
+  std::mutex mutex_;
 };
 
 //! Utility class to temporarily overrride the Enable options,
 //! including those provided by the environment variable
+//!
+//! Options are process-wide, so a guard's changes are seen by every thread,
+//! including the threads compiling segments in parallel, unless that thread
+//! runs under an InheritedOptionsGuard. Then, the guard and any changes made
+//! while it's in scope only affect that thread.
 template <typename OptionEnum>
 class NVF_API OptionsGuard {
  public:
-  OptionsGuard() : prev_options_(getCurOptions()) {}
+  OptionsGuard() : prev_snapshot_(getCurOptions().snapshot()) {}
 
   ~OptionsGuard() {
-    getCurOptions() = prev_options_;
+    getCurOptions().restore(prev_snapshot_);
   }
 
+  OptionsGuard(const OptionsGuard&) = delete;
+  OptionsGuard& operator=(const OptionsGuard&) = delete;
+
   NVF_API static Options<OptionEnum>& getCurOptions();
 
  private:
-  Options<OptionEnum> prev_options_;
+  const OptionsSnapshot<OptionEnum>* prev_snapshot_;
 };
 
 // DebugDump options
@@ -337,4 +423,37 @@ NVF_API Options<ProfilerOption>& OptionsGuard<ProfilerOption>::getCurOptions();
 
 using ProfilerOptionsGuard = OptionsGuard<ProfilerOption>;
 
+//! The options of every kind the calling thread reads. Work handed to
+//! another thread, e.g., a background compilation, captures them when it's
+//! created and installs them there with an InheritedOptionsGuard, so it runs
+//! with the options of the thread that created it. Without one, a thread
+//! reads the process-wide options, which a guard on any thread may change.
+//! The target device of the TargetDeviceGuard in scope, if any, is inherited
+//! the same way.
+struct InheritedOptions {
+  const OptionsSnapshot<DebugDumpOption>* debug_dump = nullptr;
+  const OptionsSnapshot<EnableOption>* enable = nullptr;
+  const OptionsSnapshot<DisableOption>* disable = nullptr;
+  const OptionsSnapshot<ProfilerOption>* profiler = nullptr;
+  std::shared_ptr<const TargetDeviceProperties> target_device;
+
+  NVF_API static InheritedOptions capture();
+};
+
+//! Makes the calling thread read `options` while in scope. Changes to
+//! options on this thread, including those of OptionsGuards, are then only
+//! seen by this thread. Nests.
+class NVF_API InheritedOptionsGuard {
+ public:
+  explicit InheritedOptionsGuard(const InheritedOptions& options);
+  ~InheritedOptionsGuard();
+
+  InheritedOptionsGuard(const InheritedOptionsGuard&) = delete;
+  InheritedOptionsGuard& operator=(const InheritedOptionsGuard&) = delete;
+
+ private:
+  // What this thread inherited before, if anything.
+  InheritedOptions prev_;
+};
+
 } // namespace nvfuser
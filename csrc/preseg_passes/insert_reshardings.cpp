@@ -15,6 +15,7 @@
 #include <ir/iostream.h>
 #include <ir/utils.h>
 #include <linked_hash_map.h>
+#include <multidevice/communication_cost.h>
 #include <multidevice/utils.h>
 #include <ops/alias.h>
 #include <ops/arith.h>
@@ -30,18 +31,69 @@ enum class ReshardPosition {
   kAfter,
 };
 
-// TODO: We can either reshard the inputs of a resharding expression or
-// the outputs. Currently, we reshard the outputs when there is only one
-// input, otherwise we reshard the inputs. This heuristic should be smarter
-// and attempt to minimize communication.
+// Returns whether every device-parallel loop IterDomain of `consumer` is
+// derived from logical IterDomains that map to `producer`, so shardAllLike can
+// shard `producer` like `consumer`. This is not the case, e.g., when
+// `consumer` is sharded on a dimension created by a broadcast.
+bool canShardProducerLike(TensorView* producer, TensorView* consumer) {
+  const auto c2p =
+      PairwiseLogicalDomainMap(producer, consumer).mapConsumerToProducer();
+  for (IterDomain* loop_id : consumer->getLoopDomain()) {
+    if (!loop_id->isDeviceDim() || loop_id->isReduction()) {
+      continue;
+    }
+    for (IterDomain* logical_id :
+         getInputsInTargetDomain(loop_id, consumer->getLogicalDomain())) {
+      auto it = c2p.find(logical_id);
+      if (it == c2p.end() || it->second->isBroadcast()) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// We can either reshard the inputs of a resharding expression or the outputs.
+// Expressions with multiple inputs are resharded before because
+// insertReshardingSetsAfter can only follow the sharding of one input. For a
+// single-input expression, we compare the predicted cost of resharding its
+// input against resharding its output, e.g., allgathering an activation before
+// a reduction vs. allreducing the partial results after. Symbolic extents are
+// evaluated with `expr_eval` when given. We reshard after unless resharding
+// before is known to be cheaper, which is also the choice when sizes are
+// unknown.
 // We do no support resharding multi-output expressions. Fusions may contain
 // multi-output expressions if they don't require resharding.
-ReshardPosition whereToReshard(Expr* e) {
-  if (e->inputs().size() == 1 && e->outputs().size() == 1) {
+ReshardPosition whereToReshard(
+    Expr* e,
+    const CommunicationCostModel& model,
+    const ExpressionEvaluator* expr_eval) {
+  if (e->inputs().size() != 1 || e->outputs().size() != 1) {
+    return ReshardPosition::kBefore;
+  }
+
+  // Reshape's root-to-logical transforms conflict with the DID loop split
+  // shardAllLike would replay on its input.
+  if (e->isA<ViewOp>() || !e->input(0)->isA<TensorView>() ||
+      !e->output(0)->isA<TensorView>()) {
+    return ReshardPosition::kAfter;
+  }
+
+  auto* input = e->input(0)->as<TensorView>();
+  auto* output = e->output(0)->as<TensorView>();
+  if (!canShardProducerLike(input, output)) {
     return ReshardPosition::kAfter;
-  } else {
+  }
+
+  std::optional<CommunicationCost> before =
+      predictReshardingCost(input, input, output, model, expr_eval);
+  std::optional<CommunicationCost> after =
+      predictReshardingCost(output, input, output, model, expr_eval);
+  if (before.has_value() && after.has_value() && before->time.has_value() &&
+      after->time.has_value() && *before->time < *after->time) {
     return ReshardPosition::kBefore;
   }
+  return ReshardPosition::kAfter;
 }
 
 // This is supposed to be a sufficient condition for `e` to be a communication.
@@ -79,7 +131,10 @@ bool isLowerableToCommunication(Expr* e) {
   return false;
 }
 
-void insertReshardingSetsBefore(Fusion* fusion) {
+void insertReshardingSetsBefore(
+    Fusion* fusion,
+    const CommunicationCostModel& model,
+    const ExpressionEvaluator* expr_eval) {
   // Remove this after we refactor this as a pre-segmenter pass.
   FusionGuard fg(fusion);
   for (Expr* expr : fusion->exprs()) {
@@ -91,7 +146,7 @@ void insertReshardingSetsBefore(Fusion* fusion) {
       continue;
     }
 
-    if (whereToReshard(expr) != ReshardPosition::kBefore) {
+    if (whereToReshard(expr, model, expr_eval) != ReshardPosition::kBefore) {
       continue;
     }
 
@@ -132,7 +187,10 @@ void insertReshardingSetsBefore(Fusion* fusion) {
   }
 }
 
-void insertReshardingSetsAfter(Fusion* fusion) {
+void insertReshardingSetsAfter(
+    Fusion* fusion,
+    const CommunicationCostModel& model,
+    const ExpressionEvaluator* expr_eval) {
   // Remove this after we refactor this as a pre-segmenter pass.
   FusionGuard fg(fusion);
   // Iterate backwards over fusion expressions. Reshard after will
@@ -149,7 +207,7 @@ void insertReshardingSetsAfter(Fusion* fusion) {
       continue;
     }
 
-    if (whereToReshard(expr) != ReshardPosition::kAfter) {
+    if (whereToReshard(expr, model, expr_eval) != ReshardPosition::kAfter) {
       continue;
     }
 
@@ -385,15 +443,37 @@ void rFactorLoopSplits(Fusion* fusion) {
 
 } // namespace
 
+/*static*/ thread_local const ExpressionEvaluator*
+    InsertReshardingsPass::ExpressionEvaluatorGuard::active_expr_eval_ =
+        nullptr;
+
+InsertReshardingsPass::ExpressionEvaluatorGuard::ExpressionEvaluatorGuard(
+    const ExpressionEvaluator* expr_eval)
+    : prev_expr_eval_(active_expr_eval_) {
+  active_expr_eval_ = expr_eval;
+}
+
+InsertReshardingsPass::ExpressionEvaluatorGuard::~ExpressionEvaluatorGuard() {
+  active_expr_eval_ = prev_expr_eval_;
+}
+
+/*static*/ const ExpressionEvaluator* InsertReshardingsPass::
+    ExpressionEvaluatorGuard::getCurExpressionEvaluator() {
+  return active_expr_eval_;
+}
+
 void InsertReshardingsPass::runPass(Fusion* fusion) {
   decomposeRowParallelLinearWithBias(fusion);
 
   rFactorLoopSplits(fusion);
 
-  // shouldReshardAfter selects whether insertReshardingSetsAfter or
+  // whereToReshard selects whether insertReshardingSetsAfter or
   // insertReshardingSetsBefore is used.
-  insertReshardingSetsAfter(fusion);
-  insertReshardingSetsBefore(fusion);
+  const CommunicationCostModel model;
+  const ExpressionEvaluator* expr_eval =
+      ExpressionEvaluatorGuard::getCurExpressionEvaluator();
+  insertReshardingSetsAfter(fusion, model, expr_eval);
+  insertReshardingSetsBefore(fusion, model, expr_eval);
 
   // Validate
   for (Expr* e : fusion->exprs()) {
@@ -405,6 +485,14 @@ void InsertReshardingsPass::runPass(Fusion* fusion) {
           e);
     }
   }
+
+  if (isDebugDumpEnabled(DebugDumpOption::CommunicationCost)) {
+    debug() << "Predicted communication costs:" << std::endl;
+    for (const CommunicationCost& cost :
+         predictCommunicationCosts(fusion, model, expr_eval)) {
+      debug() << "  " << cost << std::endl;
+    }
+  }
 }
 
 } // namespace nvfuser::preseg_passes
@@ -8,9 +8,14 @@
 #pragma once
 
 #include <preseg_passes/optimization_pass.h>
+#include <visibility.h>
 
 #include <string>
 
+namespace nvfuser {
+class ExpressionEvaluator;
+} // namespace nvfuser
+
 namespace nvfuser::preseg_passes {
 // Runs through the fusion and inserts a resharding Set Op after
 // any resharding Expr that is not directly lowerable to a series of
@@ -18,6 +23,29 @@ namespace nvfuser::preseg_passes {
 class InsertReshardingsPass : public OptimizationPass<InsertReshardingsPass> {
   friend class OptimizationPass<InsertReshardingsPass>;
 
+ public:
+  // Makes the pass evaluate extents with `expr_eval`, typically bound to the
+  // fusion inputs, on the calling thread while in scope. The pass compares
+  // the predicted cost of resharding an expression's input against
+  // resharding its output, which it can't do for symbolic extents otherwise.
+  class ExpressionEvaluatorGuard {
+   public:
+    NVF_API explicit ExpressionEvaluatorGuard(
+        const ExpressionEvaluator* expr_eval);
+    NVF_API ~ExpressionEvaluatorGuard();
+
+    ExpressionEvaluatorGuard(const ExpressionEvaluatorGuard&) = delete;
+    ExpressionEvaluatorGuard& operator=(const ExpressionEvaluatorGuard&) =
+        delete;
+
+    static const ExpressionEvaluator* getCurExpressionEvaluator();
+
+   private:
+    const ExpressionEvaluator* prev_expr_eval_;
+
+    static thread_local const ExpressionEvaluator* active_expr_eval_;
+  };
+
  protected:
   static void runPass(Fusion* fusion);
   static constexpr std::string_view name() {
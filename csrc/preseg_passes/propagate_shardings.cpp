@@ -11,6 +11,7 @@
 #include <ir/interface_nodes.h>
 #include <ir/iostream.h>
 #include <ir/utils.h>
+#include <multidevice/communication_cost.h>
 #include <multidevice/utils.h>
 #include <preseg_passes/propagate_shardings.h>
 #include <scheduler/utils.h>
@@ -223,11 +224,46 @@ std::vector<TensorView*> sortTvsByDeviceDims(const Range& tvs) {
   return tvs_with_mesh;
 }
 
+// Among TensorViews with the same number of device dimensions, prefers the
+// reference that minimizes the predicted communication. The outputs are sharded
+// like the reference, so every other input that ends up sharded differently
+// has to be resharded. We approximate the cost of resharding a TensorView by
+// the cost of allgathering it and pick the reference whose peers are cheapest
+// to reshard in total, i.e., the one that is itself the most expensive to
+// reshard. `tvs` is expected to be sorted by sortTvsByDeviceDims;
+// it's left untouched if any size is unknown at this point.
+void orderByReshardingCost(std::vector<TensorView*>& tvs) {
+  if (tvs.size() <= 1) {
+    return;
+  }
+
+  const CommunicationCostModel model;
+  std::unordered_map<TensorView*, double> allgather_time;
+  for (TensorView* tv : tvs) {
+    std::optional<int64_t> bytes = unshardedSizeInBytes(tv);
+    if (!bytes.has_value()) {
+      return;
+    }
+    const double time = model.time(
+        CommunicationType::Allgather, tv->getDeviceMesh().size(), *bytes);
+    allgather_time[tv] = time;
+  }
+
+  std::stable_sort(tvs.begin(), tvs.end(), [&](TensorView* a, TensorView* b) {
+    int64_t a_device_dims = numDeviceDims(a);
+    int64_t b_device_dims = numDeviceDims(b);
+    if (a_device_dims != b_device_dims) {
+      return a_device_dims > b_device_dims;
+    }
+    return allgather_time.at(a) > allgather_time.at(b);
+  });
+}
+
 // Order the inputs of the expression based on their priority.
 // For linear op, we use weights and bias before input.
 // For matmul op, we use weights before input.
 // For other ops, we sort the inputs by the number of device dimensions in
-// descending order.
+// descending order and break ties by the predicted resharding cost.
 std::vector<TensorView*> getOrderedReferenceInputs(Expr* expr) {
   const auto& inputs = ir_utils::filterByType<TensorView>(expr->inputs());
   if (LinearOp* linear_op = dynamic_cast<LinearOp*>(expr)) {
@@ -244,6 +280,7 @@ std::vector<TensorView*> getOrderedReferenceInputs(Expr* expr) {
 
   // Sort inputs by number of device dimensions in descending order
   std::vector<TensorView*> sorted_inputs = sortTvsByDeviceDims(inputs);
+  orderByReshardingCost(sorted_inputs);
 
   return sorted_inputs;
 }
@@ -15,7 +15,8 @@ namespace nvfuser::preseg_passes {
 // DeviceMesh and shards it like its first producer tv with a sharding.  This
 // assumes that all global inputs are sharded.  This cannot be done when the Op
 // is inserted into the fusion, because the multidevice shcheduling hasn't been
-// applied.
+// applied. When several inputs are equally sharded candidates, the one that
+// minimizes the predicted communication (see CommunicationCostModel) is used.
 //
 // TODO: Re-implement a robust and smatert sharding propagation pass.
 class PropagateShardingsPass : public OptimizationPass<PropagateShardingsPass> {
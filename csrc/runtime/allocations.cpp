@@ -24,7 +24,7 @@ KernelArgumentHolder inferOutputSizes(
     const KernelArgumentHolder& args,
     PrecomputedValues* evaluator_precomputed_values) {
   FUSER_PERF_SCOPE("fusion_executor::allocations::inferOutputSizes");
-  ExpressionEvaluator expr_eval;
+  ExpressionEvaluator expr_eval(fusion);
 
   std::unique_ptr<PrecomputedValues> evaluator_precomputed_values_up = nullptr;
   if (evaluator_precomputed_values == nullptr) {
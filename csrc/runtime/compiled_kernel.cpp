@@ -32,6 +32,7 @@
 #include <runtime/executor_kernel_arg.h>
 #include <runtime/executor_utils.h>
 #include <serde/utils.h>
+#include <target_device.h>
 #include <tensor_metadata.h>
 #include <utils.h>
 
@@ -766,7 +767,7 @@ std::unique_ptr<executor_utils::CudaExecutable> getCudaExecutable(
     cudaFree(nullptr);
   }
 
-  const auto prop = at::cuda::getCurrentDeviceProperties();
+  const auto prop = getTargetDeviceProperties();
 
   int64_t major = 0, minor = 0;
   bool compile_to_sass = false;
@@ -909,7 +910,7 @@ std::unique_ptr<executor_utils::CudaExecutable> getCudaExecutable(
     cudaFree(nullptr);
   }
 
-  const auto prop = at::cuda::getCurrentDeviceProperties();
+  const auto prop = getTargetDeviceProperties();
 
   // Generate compile args and compare against saved args in compiled_kernel
   NvrtcCompileDriver nvrtc_compile_driver;
@@ -1353,6 +1354,23 @@ std::string CompiledKernel::getStructuredCode() const {
       kernelString(), kernel()->indexType(), kernelName());
 }
 
+std::unique_ptr<executor_utils::CudaExecutable> compileGeneratedCode(
+    const std::string& kernel_code,
+    const std::string& kernel_name,
+    PrimDataType index_type,
+    const CompileParams& compile_params,
+    int64_t block_size) {
+  FUSER_PERF_SCOPE("compileGeneratedCode");
+  NVF_ERROR(block_size > 0, "Invalid block size: ", block_size);
+  return getCudaExecutable(
+      kernel_code,
+      _getStructuredCode(kernel_code, index_type, kernel_name),
+      kernel_name,
+      kernel_name,
+      compile_params,
+      block_size);
+}
+
 std::string CompiledKernel::disassembledKernelSASS() const {
   return disassembleBinary(compiled_kernel_->cubin, "-fun 1 -c");
 }
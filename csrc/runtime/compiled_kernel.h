@@ -237,6 +237,9 @@ class CompiledKernel : public NonCopyable {
   const c10::Device& device() const {
     return device_;
   }
+  const CompileParams& compileParams() const {
+    return compile_params_;
+  }
 
  private:
   CompileParams compile_params_;
@@ -293,4 +296,15 @@ class CompiledKernel : public NonCopyable {
   const c10::Device device_ = c10::Device(c10::DeviceType::CUDA, 0);
 };
 
+//! Compiles CUDA code generated for kir::Kernels, e.g., with
+//! codegen::generateHorizontalCudaKernel, like CompiledKernel compiles the
+//! code of its kernel. `block_size` is the number of threads per block to
+//! compile for.
+NVF_API std::unique_ptr<executor_utils::CudaExecutable> compileGeneratedCode(
+    const std::string& kernel_code,
+    const std::string& kernel_name,
+    PrimDataType index_type,
+    const CompileParams& compile_params,
+    int64_t block_size);
+
 } // namespace nvfuser
@@ -72,11 +72,24 @@ void ExprEvalExecutor::compile(Fusion* fusion) {
       supported(fusion),
       "ExprEvalExecutor does not support the Fusion provided.");
   fusion_ = std::make_unique<Fusion>(*fusion);
+  plan_ = std::make_unique<ExprEvalPlan>(fusion_.get());
   if (isProfilerEnabled()) {
     FusionProfiler::segment(group_id_).stopCompile();
   }
 }
 
+void ExprEvalExecutor::compileEager(Fusion* fusion) {
+  FUSER_PERF_SCOPE("ExprEvalExecutor::compileEager");
+  NVF_ERROR(
+      std::all_of(
+          fusion->outputs().begin(),
+          fusion->outputs().end(),
+          [](Val* out) { return out->isA<TensorView>(); }),
+      "ExprEvalExecutor expects all fusion outputs to be TensorViews.");
+  fusion_ = std::make_unique<Fusion>(*fusion);
+  plan_ = std::make_unique<ExprEvalPlan>(fusion_.get());
+}
+
 bool ExprEvalExecutor::isCompiled() const {
   return fusion_ != nullptr;
 }
@@ -100,20 +113,11 @@ KernelArgumentHolder ExprEvalExecutor::run(
   NVF_ERROR(fusion_, "Need to compile before you can run.");
   // Bind fusion inputs
   auto expr_eval = executor_utils::bindInputs(args, fusion_.get());
-  {
-    NVF_ERROR(
-        outputs.empty(),
-        "Fusion executor is using expression evaluator,",
-        " and expects that the outputs are not populated, which they were.");
-    if (outputs.empty()) {
-      for (const auto& out_val : fusion_->outputs()) {
-        auto out_tensor =
-            expr_eval.evaluate(out_val->as<TensorView>()).as<at::Tensor>();
-        expr_eval.bind(out_val, out_tensor);
-        outputs.push(out_tensor);
-      }
-    }
-  }
+  NVF_ERROR(
+      outputs.empty(),
+      "Fusion executor is using expression evaluator,",
+      " and expects that the outputs are not populated, which they were.");
+  outputs = plan_->run(args, expr_eval);
   if (isProfilerEnabled()) {
     FusionProfiler::segment(group_id_).stopKernel();
     FusionProfiler::segment(group_id_).setDevice(args.getDeviceIndex());
@@ -829,45 +833,70 @@ void KernelExecutor::computeArgs(
     KernelExecutorEntry& entry,
     const KernelArgumentHolder& args) const {
   FUSER_PERF_SCOPE("KernelExecutor::computeArgs");
-  if (std::ssize(entry.args) != args.size()) {
-    entry.args.resize(args.size());
-    entry.arg_ptrs.resize(args.size());
-  }
+  const std::vector<Val*>& params = compiled_kernel_->kernel()->parameters();
+  NVF_ERROR_EQ(args.size(), std::ssize(params));
 
-  NVF_ERROR_EQ(
-      args.size(), std::ssize(compiled_kernel_->kernel()->parameters()));
-
-  for (auto inp : compiled_kernel_->kernel()->inputs()) {
-    if (!inp->isA<TensorView>()) {
-      continue;
+  const PrimDataType idx_type = compiled_kernel_->kernel()->indexType();
+  const auto tensor_shape = [&](int64_t buffer_info_idx)
+      -> std::pair<const std::vector<int64_t>&, const std::vector<int64_t>&> {
+    const auto& shape_info =
+        linear_buffer_info_getter(entry, buffer_info_idx).shape_info;
+    const auto& sizes =
+        shape_info.logical_sizes.size() ==
+            shape_info.unsharded_logical_sizes.size()
+        ? shape_info.unsharded_logical_sizes
+        : shape_info.logical_sizes;
+    const auto& strides = shape_info.allocation_strides.empty()
+        ? shape_info.logical_strides
+        : shape_info.allocation_strides;
+    return {sizes, strides};
+  };
+
+  // The parameter sizes are fixed once the kernel is compiled, so the block
+  // is laid out on the first launch of this entry.
+  if (entry.params.numParams() != args.size()) {
+    std::vector<int64_t> sizes;
+    std::vector<int64_t> alignments;
+    sizes.reserve(args.size());
+    alignments.reserve(args.size());
+    int64_t buffer_info_idx = 0;
+    for (auto&& [arg_idx, arg] : enumerate(args)) {
+      if (arg.is<at::Tensor>() && arg.as<at::Tensor>().is_cuda()) {
+        const auto& [logical_sizes, strides] = tensor_shape(buffer_info_idx++);
+        sizes.push_back(KernelParamBuffer::tensorParamSize(
+            std::ssize(logical_sizes), std::ssize(strides), idx_type));
+      } else {
+        if (arg.is<at::Tensor>()) {
+          buffer_info_idx++;
+        }
+        sizes.push_back(std::ssize(polymorphicValueToBytes(
+            arg, params[arg_idx]->dtype(), idx_type)));
+      }
+      alignments.push_back(
+          KernelParamBuffer::paramAlignment(params[arg_idx], idx_type));
     }
+    entry.params.layout(sizes, alignments);
   }
 
-  const PrimDataType idx_type = compiled_kernel_->kernel()->indexType();
+  // Only data pointers and the extents and strides that changed are
+  // written.
   int64_t buffer_info_idx = 0;
   for (auto&& [arg_idx, arg] : enumerate(args)) {
     if (arg.is<at::Tensor>() && arg.as<at::Tensor>().is_cuda()) {
-      const auto& buffer_info =
-          linear_buffer_info_getter(entry, buffer_info_idx++);
-      entry.args[arg_idx] = tensorToBytes(
-          arg,
-          buffer_info.shape_info.logical_sizes,
-          buffer_info.shape_info.allocation_strides.empty()
-              ? buffer_info.shape_info.logical_strides
-              : buffer_info.shape_info.allocation_strides,
-          idx_type,
-          buffer_info.shape_info.unsharded_logical_sizes);
-      entry.arg_ptrs[arg_idx] = entry.args[arg_idx].data();
+      const auto& [logical_sizes, strides] = tensor_shape(buffer_info_idx++);
+      entry.params.patchTensor(
+          arg_idx,
+          arg.as<at::Tensor>().data_ptr(),
+          logical_sizes,
+          strides,
+          idx_type);
     } else {
       if (arg.is<at::Tensor>()) {
         buffer_info_idx++;
       }
-      auto bytes = polymorphicValueToBytes(
-          arg,
-          compiled_kernel_->kernel()->parameters()[arg_idx]->dtype(),
-          idx_type);
-      entry.args[arg_idx] = bytes;
-      entry.arg_ptrs[arg_idx] = entry.args[arg_idx].data();
+      const std::vector<std::byte> bytes =
+          polymorphicValueToBytes(arg, params[arg_idx]->dtype(), idx_type);
+      entry.params.patch(arg_idx, bytes.data(), std::ssize(bytes));
     }
   }
 }
@@ -1009,6 +1038,22 @@ KernelArgumentHolder KernelExecutor::run(
     const LaunchParams& launch_constraints,
     CompileParams compile_params) {
   FUSER_PERF_SCOPE("KernelExecutor::runFusion");
+  KernelArgumentHolder outputs = prepareRun(
+      std::move(args),
+      std::move(output_args),
+      launch_constraints,
+      compile_params);
+  launchPrepared();
+  finishRun(outputs);
+  return outputs;
+}
+
+KernelArgumentHolder KernelExecutor::prepareRun(
+    KernelArgumentHolder args,
+    KernelArgumentHolder output_args,
+    const LaunchParams& launch_constraints,
+    CompileParams compile_params) {
+  FUSER_PERF_SCOPE("KernelExecutor::prepareRun");
 
   if (isProfilerEnabled()) {
     NVF_CHECK(
@@ -1040,17 +1085,19 @@ KernelArgumentHolder KernelExecutor::run(
   }
 
   c10::DeviceGuard dg(compiled_kernel_->device());
-  auto stream = at::cuda::getCurrentCUDAStream();
   at::cuda::jit::initializeCudaContext();
   NVF_ERROR(compiled_kernel_->lowered());
 
   // Placeholder for the case where parameter cache is not used
-  KernelExecutorEntry temporary_executor_entry;
+  if (!args.getCacheId().has_value() ||
+      compiled_kernel_->launchParamCacheDisabled()) {
+    temporary_executor_entry_ = KernelExecutorEntry();
+  }
 
   KernelExecutorEntry* executor_entry = args.getCacheId().has_value() &&
           !compiled_kernel_->launchParamCacheDisabled()
       ? &executor_entry_lookup_[*args.getCacheId()]
-      : &temporary_executor_entry;
+      : &temporary_executor_entry_;
 
   // Initialize the executor entry if not initlized
   if (!executor_entry->init) {
@@ -1119,7 +1166,7 @@ KernelArgumentHolder KernelExecutor::run(
   args.push(output_args);
 
   KernelArgumentHolder intermediate_args;
-  at::Tensor profile_buffer;
+  prepared_profile_buffer_ = at::Tensor();
   {
     FUSER_PERF_SCOPE("KernelExecutor::runFusion::intermediates");
     // Intermediates just use logical sizes and strides even though they're
@@ -1178,7 +1225,7 @@ KernelArgumentHolder KernelExecutor::run(
       args.push(intermediate_buffer);
       intermediate_args.push(intermediate_buffer);
       if (buf_info.is_profile_buffer) {
-        profile_buffer = intermediate_buffer;
+        prepared_profile_buffer_ = intermediate_buffer;
       }
     }
   }
@@ -1227,7 +1274,29 @@ KernelArgumentHolder KernelExecutor::run(
             << std::endl;
   }
 
-  if (execute_kernel_ && !compiled_kernel_->kernel()->topLevelExprs().empty()) {
+  prepared_entry_ = executor_entry;
+  prepared_args_ = std::move(args);
+  return output_args;
+}
+
+bool KernelExecutor::preparedRunLaunchesKernel() const {
+  NVF_ERROR(prepared_entry_ != nullptr, "No run is prepared.");
+  return execute_kernel_ &&
+      !compiled_kernel_->kernel()->topLevelExprs().empty();
+}
+
+void** KernelExecutor::preparedParamPointers() {
+  NVF_ERROR(prepared_entry_ != nullptr, "No run is prepared.");
+  return prepared_entry_->params.paramPointers();
+}
+
+void KernelExecutor::launchPrepared() {
+  NVF_ERROR(prepared_entry_ != nullptr, "No run is prepared.");
+  KernelExecutorEntry* executor_entry = prepared_entry_;
+  c10::DeviceGuard dg(compiled_kernel_->device());
+  auto stream = at::cuda::getCurrentCUDAStream();
+
+  if (preparedRunLaunchesKernel()) {
     FUSER_PERF_SCOPE("KernelExecutor::runFusion::execute_kernel");
     ensureAvailableDynamicSmemSize(executor_entry->launch_params.smem());
 
@@ -1272,8 +1341,12 @@ KernelArgumentHolder KernelExecutor::run(
           launch_params_.bdimz(),
           launch_params_.smem(),
           stream,
-          executor_entry->arg_ptrs.data(),
-          nullptr));
+          executor_entry->params.hasAbiLayout()
+              ? nullptr
+              : executor_entry->params.paramPointers(),
+          executor_entry->params.hasAbiLayout()
+              ? executor_entry->params.launchConfig()
+              : nullptr));
     } else {
       FUSER_PERF_SCOPE("ExecutorRunFusion::cuLaunchCooperativeKernel");
       NVFUSER_CUDA_SAFE_CALL(cuLaunchCooperativeKernel(
@@ -1286,23 +1359,29 @@ KernelArgumentHolder KernelExecutor::run(
           launch_params_.bdimz(),
           launch_params_.smem(),
           stream,
-          executor_entry->arg_ptrs.data()));
+          executor_entry->params.paramPointers()));
     }
   }
+}
 
+void KernelExecutor::finishRun(const KernelArgumentHolder& outputs) {
+  NVF_ERROR(prepared_entry_ != nullptr, "No run is prepared.");
   releaseZeroedMemory();
 
   if (isOptionEnabled(EnableOption::KernelProfile)) {
-    debug() << compiled_kernel_->kernel()->profile().toString(profile_buffer);
+    debug() << compiled_kernel_->kernel()->profile().toString(
+        prepared_profile_buffer_);
   }
 
   if (isProfilerEnabled()) {
     auto& sprof = FusionProfiler::segment(group_id_);
     sprof.stopKernel();
-    sprof.outputBytesAccessed(computeBytes(output_args));
+    sprof.outputBytesAccessed(computeBytes(outputs));
   }
 
-  return output_args;
+  prepared_entry_ = nullptr;
+  prepared_args_ = KernelArgumentHolder();
+  prepared_profile_buffer_ = at::Tensor();
 }
 
 flatbuffers::Offset<serde::KernelExecutor> KernelExecutor::serialize(
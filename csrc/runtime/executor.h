@@ -17,6 +17,8 @@
 #include <runtime/executor_abstract.h>
 #include <runtime/executor_params.h>
 #include <runtime/executor_utils.h>
+#include <runtime/expr_eval_plan.h>
+#include <runtime/kernel_param_buffer.h>
 #include <scheduler/scheduler_types.h>
 #include <serde/fusion_cache_generated.h>
 #include <utils.h>
@@ -42,6 +44,12 @@ class ExprEvalExecutor : public ExecutorAbstract {
 
   void compile(Fusion* fusion);
 
+  // Like compile, but doesn't require outputs to be marked
+  // AllocationType::Evaluate. `run` then evaluates an unscheduled fusion op
+  // by op with ATen, e.g., while its kernels are being compiled. Aliased
+  // outputs are not written back to inputs; callers handle that.
+  void compileEager(Fusion* fusion);
+
   bool isCompiled() const override;
 
   NVF_API KernelArgumentHolder
@@ -51,9 +59,15 @@ class ExprEvalExecutor : public ExecutorAbstract {
     return fusion_;
   }
 
+  const ExprEvalPlan* plan() const {
+    return plan_.get();
+  }
+
  private:
   // TODO: Set properly
   std::unique_ptr<Fusion> fusion_;
+  // Built from fusion_ at compile time.
+  std::unique_ptr<ExprEvalPlan> plan_;
 };
 
 // struct used to hold necessary information to launch compiled kernel on a
@@ -72,17 +86,14 @@ struct KernelExecutorEntry {
   // Temporary work buffers and intemediate global-memory tensors
   std::vector<GlobalBufferInfo> intermediates;
   std::vector<GlobalBufferInfo> inputs;
-  // The arguments to the kernel. These are configured in computeArgs and
-  // recomputeArgs.
-  // For the common case of a tensor argument, these correspond to the
-  // `struct Tensor` data in runtime/tensor.cu. That means each tensor
-  // element in `args` would be a sizeof(void*) + len(shape)*sizeof(int) +
+  // The arguments to the kernel, packed into one block. These are laid out
+  // by the first computeArgs and patched in place by later ones.
+  // For the common case of a tensor argument, a parameter corresponds to
+  // the `struct Tensor` data in runtime/tensor.cu. That means each tensor
+  // parameter is a sizeof(void*) + len(shape)*sizeof(int) +
   // len(shape)*sizeof(int) byte array (here "int" is used in place of the
   // index type, which varies in practice).
-  std::vector<std::vector<std::byte>> args;
-  // This is just the data() pointers to the above `args`; cuLaunchKernel
-  // requires an array of this form.
-  std::vector<void*> arg_ptrs;
+  KernelParamBuffer params;
 };
 
 class GpuLower;
@@ -116,6 +127,38 @@ class KernelExecutor : public ExecutorAbstract {
       const LaunchParams& launch_constraints = LaunchParams(),
       CompileParams compile_params = CompileParams());
 
+  //! run() is prepareRun(), launchPrepared() and finishRun(). They are
+  //! exposed so that the launch can be replaced, e.g., by a
+  //! HorizontalKernelExecutor launching several prepared kernels at once.
+  //!
+  //! prepareRun does everything run() does before the launch: computing
+  //! launch parameters, allocating outputs and intermediates and building
+  //! the kernel arguments. Returns the outputs. The arguments stay valid
+  //! until finishRun.
+  NVF_API KernelArgumentHolder prepareRun(
+      KernelArgumentHolder args,
+      KernelArgumentHolder outputs = {},
+      const LaunchParams& launch_constraints = LaunchParams(),
+      CompileParams compile_params = CompileParams());
+
+  //! Launches the kernel prepared by the last prepareRun.
+  NVF_API void launchPrepared();
+
+  //! Completes the run started by the last prepareRun once its kernel is
+  //! launched. `outputs` are the ones prepareRun returned.
+  NVF_API void finishRun(const KernelArgumentHolder& outputs);
+
+  //! Whether the last prepareRun needs a kernel launch, which it doesn't if
+  //! the kernel is empty or kernel execution is disabled.
+  NVF_API bool preparedRunLaunchesKernel() const;
+
+  //! Pointers to the kernel arguments of the last prepareRun, in the form of
+  //! the `kernelParams` argument of cuLaunchKernel.
+  NVF_API void** preparedParamPointers();
+
+  //! Get the static shared memory size of the current compiled kernel
+  NVF_API int64_t getStaticSmemSize();
+
   // Register a lowering hooks that are called to modify the GpuLower object
   // before running lowering passes. The main use case is for unit tests to
   // modify the lowering process.
@@ -273,9 +316,6 @@ class KernelExecutor : public ExecutorAbstract {
   //! Get the current dynamic shared memory size
   int64_t getAvailableDynamicSmemSize();
 
-  //! Get the static shared memory size of the current compiled kernel
-  int64_t getStaticSmemSize();
-
   //! Check if the shared memory size can be expandable to accommodate
   //! the given dynamic size. The total shared memory size consumed
   //! would be the sum of the static and dynamic sizes.
@@ -339,6 +379,15 @@ class KernelExecutor : public ExecutorAbstract {
   // Profiling support: the last launch param used
   LaunchParams launch_params_;
 
+  // State of a run between prepareRun and finishRun. prepared_entry_ points
+  // to an entry of executor_entry_lookup_, or to temporary_executor_entry_
+  // if the parameter cache isn't used. prepared_args_ holds all kernel
+  // arguments, including the intermediates, until the kernel is launched.
+  KernelExecutorEntry temporary_executor_entry_;
+  KernelExecutorEntry* prepared_entry_ = nullptr;
+  KernelArgumentHolder prepared_args_;
+  at::Tensor prepared_profile_buffer_;
+
   // Lowering hooks that are called after the GpuLower instance is created
   // before running lowering passes.
   // The main use case is for unit tests to modify the lowering process.
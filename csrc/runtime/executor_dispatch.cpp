@@ -10,6 +10,7 @@
 
 #include <host_ir/executor.h>
 #include <instrumentation.h>
+#include <runtime/foreach_executor.h>
 
 #include <typeinfo>
 
@@ -22,7 +23,8 @@ std::unique_ptr<ExecutorAbstract> ExecutorDispatch::makeExecutor(
     int64_t fusion_id,
     int64_t concrete_id,
     int64_t runtime_id,
-    int64_t group_id) {
+    int64_t group_id,
+    const HeuristicParams* heuristic_params) {
   FUSER_PERF_SCOPE("ExecutorDispatch::makeExecutor");
   if (HostIrExecutor::supported(fusion)) {
     return std::make_unique<HostIrExecutor>(
@@ -32,6 +34,14 @@ std::unique_ptr<ExecutorAbstract> ExecutorDispatch::makeExecutor(
     return std::make_unique<ExprEvalExecutor>(
         fusion_id, concrete_id, runtime_id, group_id);
   }
+  if (ForEachKernelExecutor::supported(heuristic_params)) {
+    return std::make_unique<ForEachKernelExecutor>(
+        *heuristic_params->as<ForEachParams>(),
+        fusion_id,
+        concrete_id,
+        runtime_id,
+        group_id);
+  }
   if (KernelExecutor::supported(fusion)) {
     return std::make_unique<KernelExecutor>(
         fusion_id, concrete_id, runtime_id, group_id);
@@ -49,7 +59,8 @@ void ExecutorDispatch::compile(ExecutorAbstract* executor, Fusion* fusion) {
     eee->compile(fusion);
     return;
   }
-  if (dynamic_cast<KernelExecutor*>(executor) != nullptr) {
+  if (dynamic_cast<KernelExecutor*>(executor) != nullptr ||
+      dynamic_cast<ForEachKernelExecutor*>(executor) != nullptr) {
     NVF_THROW(
         "KernelExecutor needs more information to be provided for "
         "compilation.");
@@ -74,6 +85,10 @@ void ExecutorDispatch::compile(
     eee->compile(fusion);
     return;
   }
+  if (auto fke = dynamic_cast<ForEachKernelExecutor*>(executor)) {
+    fke->compile(fusion, args);
+    return;
+  }
   if (auto ke = dynamic_cast<KernelExecutor*>(executor)) {
     ke->compile(
         fusion, args, launch_constraints, compile_params, scheduler_type);
@@ -93,6 +108,9 @@ bool ExecutorDispatch::isCompiled(const ExecutorAbstract* executor) {
   if (auto eee = dynamic_cast<const ExprEvalExecutor*>(executor)) {
     return eee->isCompiled();
   }
+  if (auto fke = dynamic_cast<const ForEachKernelExecutor*>(executor)) {
+    return fke->isCompiled();
+  }
   if (auto ke = dynamic_cast<const KernelExecutor*>(executor)) {
     return ke->isCompiled();
   }
@@ -101,19 +119,26 @@ bool ExecutorDispatch::isCompiled(const ExecutorAbstract* executor) {
 
 KernelArgumentHolder ExecutorDispatch::run(
     ExecutorAbstract* executor,
-    const KernelArgumentHolder& args,
+    KernelArgumentHolder args,
     KernelArgumentHolder outputs,
     const LaunchParams& launch_constraints,
     const CompileParams& compile_params) {
   FUSER_PERF_SCOPE("ExecutorDispatch::run2");
   if (auto hire = dynamic_cast<HostIrExecutor*>(executor)) {
-    return hire->run(args, outputs);
+    return hire->run(args, std::move(outputs));
   }
   if (auto eee = dynamic_cast<ExprEvalExecutor*>(executor)) {
-    return eee->run(args, outputs);
+    return eee->run(args, std::move(outputs));
+  }
+  if (auto fke = dynamic_cast<ForEachKernelExecutor*>(executor)) {
+    return fke->run(args, std::move(outputs));
   }
   if (auto ke = dynamic_cast<KernelExecutor*>(executor)) {
-    return ke->run(args, outputs, launch_constraints, compile_params);
+    return ke->run(
+        std::move(args),
+        std::move(outputs),
+        launch_constraints,
+        compile_params);
   }
   NVF_THROW("Unsupported Executor detected.");
 }
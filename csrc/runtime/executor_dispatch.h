@@ -9,21 +9,25 @@
 
 #include <runtime/executor.h>
 #include <runtime/executor_abstract.h>
+#include <scheduler/heuristic.h>
 
 namespace nvfuser {
 
-// Simple stateless dispatch system for KernelExecutor, HostIrExecutor, and
-// ExprEvalExecutor
+// Simple stateless dispatch system for KernelExecutor, HostIrExecutor,
+// ExprEvalExecutor, and ForEachKernelExecutor
 class ExecutorDispatch {
  public:
   // Iterates through executors in priority order creating the first executor
-  // that returns true when checking their "supported" method
+  // that returns true when checking their "supported" method. The heuristics
+  // of the segment, if given, select executors that depend on them rather
+  // than on the fusion, i.e., ForEachKernelExecutor.
   static std::unique_ptr<ExecutorAbstract> makeExecutor(
       Fusion* fusion,
       int64_t fusion_id = -1,
       int64_t concrete_id = -1,
       int64_t runtime_id = -1,
-      int64_t group_id = -1);
+      int64_t group_id = -1,
+      const HeuristicParams* heuristic_params = nullptr);
 
   static void compile(ExecutorAbstract* executor, Fusion* fusion);
 
@@ -37,9 +41,11 @@ class ExecutorDispatch {
 
   static bool isCompiled(const ExecutorAbstract* executor);
 
+  // Takes `args` by value so callers that are done with their arguments can
+  // move them into KernelExecutor::run.
   static KernelArgumentHolder run(
       ExecutorAbstract* executor,
-      const KernelArgumentHolder& args,
+      KernelArgumentHolder args,
       KernelArgumentHolder outputs = {},
       const LaunchParams& launch_constraints = LaunchParams(),
       const CompileParams& compile_params = CompileParams());
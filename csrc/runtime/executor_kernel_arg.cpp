@@ -363,12 +363,46 @@ std::vector<std::byte> tensorToBytes(
   return bytes;
 }
 
-int64_t computeBytes(const KernelArgumentHolder& args) {
+KernelArgumentHolder KernelArgumentSpan::toHolder() const {
+  KernelArgumentHolder holder;
+  holder.reserve(size_);
+  for (const PolymorphicValue& arg : *this) {
+    holder.push(arg);
+  }
+  holder.setDeviceIndex(device_index_);
+  if (cache_id_.has_value()) {
+    holder.setCacheId(*cache_id_);
+  }
+  return holder;
+}
+
+int64_t kernelParameterBytes(const Val* param, PrimDataType index_type) {
+  const int64_t index_bytes = dataTypeSize(index_type);
+  int64_t num_bytes = 0;
+  if (auto* tv = dynamic_cast<const TensorView*>(param)) {
+    if (tv->isCpuScalar()) {
+      num_bytes = dataTypeSize(tv->dtype());
+    } else {
+      // Data pointer, logical sizes and allocation strides
+      num_bytes = (int64_t)sizeof(void*) +
+          index_bytes *
+              std::ssize(TensorDomain::noReductions(tv->getLogicalDomain())) +
+          index_bytes *
+              std::ssize(TensorDomain::noReductions(
+                  tv->getMaybeAllocationDomain()));
+    }
+  } else {
+    num_bytes = dataTypeSize(param->dtype(), index_type);
+  }
+  return roundUpToMultiple(num_bytes, 8);
+}
+
+int64_t computeBytes(KernelArgumentSpan args) {
   int64_t num_bytes = 0;
   // Figure how many bytes are inputs, outputs, and temporary buffers
-  for (auto i : arange(args.size())) {
-    if (args[i].is<at::Tensor>()) {
-      auto t = args[i].as<at::Tensor>();
+  for (const PolymorphicValue& arg : args) {
+    if (arg.is<at::Tensor>()) {
+      const auto& t = arg.as<at::Tensor>();
       num_bytes += static_cast<int64_t>(t.storage().nbytes());
     }
   }
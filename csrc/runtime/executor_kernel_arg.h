@@ -8,6 +8,7 @@
 #pragma once
 
 #include <ATen/core/ivalue.h>
+#include <c10/util/SmallVector.h>
 #include <exceptions.h>
 #include <expr_evaluator.h>
 #include <ir/all_nodes.h>
@@ -18,6 +19,7 @@
 
 #include <cstddef>
 #include <optional>
+#include <utility>
 #include <vector>
 
 namespace nvfuser {
@@ -28,8 +30,16 @@ struct GlobalBufferInfo;
 //! tensor sizes/shapes/dtype/memory_ptr and copies scalar inputs. It is used
 //! for both compilation as well as kernel execution. It takes ownership of
 //! at::Tensors so care should be taken when using it relative to tensor.
+//!
+//! Up to kNumInlineArguments arguments are stored inline, so holders of
+//! typical fusions don't allocate. Copying a holder still copies every
+//! at::Tensor, which updates its refcount atomically, so hot paths should
+//! move holders, and APIs that only read arguments should take a
+//! KernelArgumentSpan.
 class NVF_API KernelArgumentHolder {
  public:
+  static constexpr unsigned kNumInlineArguments = 16;
+
   KernelArgumentHolder() = default;
 
   KernelArgumentHolder(const KernelArgumentHolder& self) = default;
@@ -74,6 +84,14 @@ class NVF_API KernelArgumentHolder {
     }
   }
 
+  void push(KernelArgumentHolder&& args) {
+    arguments_.reserve(arguments_.size() + args.size());
+    for (auto& arg : args) {
+      arguments_.emplace_back(std::move(arg));
+    }
+    args.arguments_.clear();
+  }
+
   void reserve(size_t size) {
     arguments_.reserve(size);
   }
@@ -91,9 +109,10 @@ class NVF_API KernelArgumentHolder {
   void push(std::initializer_list<at::Tensor> args) {
     push(std::vector<at::Tensor>(args));
   }
-  void push(std::vector<PolymorphicValue> args) {
-    for (const auto& arg : args) {
-      push(arg);
+  void push(std::vector<PolymorphicValue>&& args) {
+    arguments_.reserve(arguments_.size() + args.size());
+    for (auto& arg : args) {
+      arguments_.emplace_back(std::move(arg));
     }
   }
 
@@ -116,11 +135,17 @@ class NVF_API KernelArgumentHolder {
   }
 
   PolymorphicValue& operator[](size_t ind) {
-    return arguments_.at(ind);
+    checkIndex(ind);
+    return arguments_[ind];
   }
 
   const PolymorphicValue& operator[](size_t ind) const {
-    return arguments_.at(ind);
+    checkIndex(ind);
+    return arguments_[ind];
+  }
+
+  const PolymorphicValue* data() const {
+    return arguments_.data();
   }
 
   // Returns iterator pointing to the beginning of vector container
@@ -160,19 +185,11 @@ class NVF_API KernelArgumentHolder {
   }
 
   auto cbegin() const {
-    return arguments_.cbegin();
+    return std::as_const(arguments_).begin();
   }
 
   auto cend() const {
-    return arguments_.cend();
-  }
-
-  auto cbegin() {
-    return arguments_.cbegin();
-  }
-
-  auto cend() {
-    return arguments_.cend();
+    return std::as_const(arguments_).end();
   }
 
   auto getBackInserter() {
@@ -213,9 +230,98 @@ class NVF_API KernelArgumentHolder {
  private:
   void setCommonDevice();
 
+  // c10::SmallVector has no bounds-checked at().
+  void checkIndex(size_t ind) const {
+    NVF_ERROR(
+        ind < arguments_.size(),
+        "Argument index ",
+        ind,
+        " out of bounds for ",
+        arguments_.size(),
+        " arguments.");
+  }
+
  private:
-  std::vector<PolymorphicValue> arguments_;
+  c10::SmallVector<PolymorphicValue, kNumInlineArguments> arguments_;
+
+  int8_t device_index_ = 0;
+  std::optional<size_t> cache_id_ = std::nullopt;
+};
+
+//! A read-only view of consecutive arguments of a KernelArgumentHolder,
+//! along with its device index and cache id. Internal APIs that only read
+//! their arguments take this, so neither callers nor callees copy tensors.
+//! The viewed holder must outlive the span and not be resized meanwhile.
+class KernelArgumentSpan {
+ public:
+  KernelArgumentSpan() = default;
+
+  // Implicit, so a KernelArgumentHolder can be passed wherever a span is
+  // expected.
+  KernelArgumentSpan(const KernelArgumentHolder& args)
+      : data_(args.data()),
+        size_(args.size()),
+        device_index_(args.getDeviceIndex()),
+        cache_id_(args.getCacheId()) {}
+
+  const PolymorphicValue& operator[](int64_t ind) const {
+    NVF_ERROR(
+        ind >= 0 && ind < size_,
+        "Argument index ",
+        ind,
+        " out of bounds for ",
+        size_,
+        " arguments.");
+    return data_[ind];
+  }
+
+  const PolymorphicValue* begin() const {
+    return data_;
+  }
+
+  const PolymorphicValue* end() const {
+    return data_ + size_;
+  }
+
+  int64_t size() const {
+    return size_;
+  }
 
+  bool empty() const {
+    return size_ == 0;
+  }
+
+  //! The `count` arguments starting at `offset`.
+  KernelArgumentSpan subspan(int64_t offset, int64_t count) const {
+    NVF_ERROR(
+        offset >= 0 && count >= 0 && offset + count <= size_,
+        "Subspan [",
+        offset,
+        ", ",
+        offset + count,
+        ") out of bounds for ",
+        size_,
+        " arguments.");
+    KernelArgumentSpan span = *this;
+    span.data_ = data_ + offset;
+    span.size_ = count;
+    return span;
+  }
+
+  int8_t getDeviceIndex() const {
+    return device_index_;
+  }
+
+  std::optional<size_t> getCacheId() const {
+    return cache_id_;
+  }
+
+  //! Copies the viewed arguments, for the few callees that need to own them.
+  NVF_API KernelArgumentHolder toHolder() const;
+
+ private:
+  const PolymorphicValue* data_ = nullptr;
+  int64_t size_ = 0;
   int8_t device_index_ = 0;
   std::optional<size_t> cache_id_ = std::nullopt;
 };
@@ -235,6 +341,16 @@ std::vector<std::byte> tensorToBytes(
     PrimDataType idx_type,
     const std::vector<int64_t>& unsharded_logical_sizes = {});
 
-int64_t computeBytes(const KernelArgumentHolder& args);
+int64_t computeBytes(KernelArgumentSpan args);
+
+// CUDA's limit on the total size of the parameters of a kernel. Volta and
+// newer GPUs allow more with CUDA 12.1 and later, but every supported setup
+// accepts this much.
+constexpr int64_t kMaxKernelParameterBytes = 4096;
+
+// An upper bound of the bytes `param` takes among the kernel parameters, as
+// laid out by polymorphicValueToBytes and tensorToBytes. Each parameter is
+// rounded up to 8 bytes for alignment.
+NVF_API int64_t kernelParameterBytes(const Val* param, PrimDataType index_type);
 
 } // namespace nvfuser
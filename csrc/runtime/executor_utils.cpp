@@ -464,9 +464,7 @@ void validateVectorizedTensors(
       kernel, args, output_args, data_cache, expr_eval);
 }
 
-ExpressionEvaluator bindInputs(
-    const KernelArgumentHolder& args,
-    Fusion* kernel) {
+ExpressionEvaluator bindInputs(KernelArgumentSpan args, Fusion* kernel) {
   FUSER_PERF_SCOPE("executor_utils::bindInputs");
 
   // args may contains more than just inputs, but inputs are always at the
@@ -475,7 +473,7 @@ ExpressionEvaluator bindInputs(
       std::ssize(kernel->inputs()) <= args.size(),
       "KernelArgumentHolder contains less argument than kernel's input.");
 
-  ExpressionEvaluator expr_eval;
+  ExpressionEvaluator expr_eval(kernel);
   const auto& inputs = kernel->inputs();
   for (const auto i : arange(inputs.size())) {
     // NOTE: we bind all inputs here, including at::Tensors. This means that
@@ -52,8 +52,7 @@ struct CudaExecutable : public NonCopyable {
 };
 
 //! Bind input values to runtime values
-NVF_API ExpressionEvaluator
-bindInputs(const KernelArgumentHolder& args, Fusion* fusion);
+NVF_API ExpressionEvaluator bindInputs(KernelArgumentSpan args, Fusion* fusion);
 
 // Returns a vector where vector[out_idx] == the input index in fusion->inputs()
 // that output[out_idx] is aliased to. If output[out_idx] is not aliased to any
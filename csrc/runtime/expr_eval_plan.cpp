@@ -0,0 +1,195 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <runtime/expr_eval_plan.h>
+
+#include <fusion.h>
+#include <instrumentation.h>
+#include <ir/all_nodes.h>
+#include <utils.h>
+
+#include <unordered_map>
+
+namespace nvfuser {
+
+namespace {
+
+// The values `expr` is evaluated from.
+std::vector<const Val*> dependenciesOf(const Expr* expr) {
+  std::vector<const Val*> dependencies;
+  dependencies.reserve(expr->inputs().size());
+  for (Val* in : expr->inputs()) {
+    if (expr->isA<CatOp>()) {
+      NVF_ERROR(
+          in->definition() != nullptr && in->definition()->isA<PadOp>(),
+          "Expected CatOp to be preceded by a PadOp.");
+      dependencies.push_back(in->definition()->input(0));
+    } else {
+      dependencies.push_back(in);
+    }
+  }
+  return dependencies;
+}
+
+} // namespace
+
+ExprEvalPlan::ExprEvalPlan(Fusion* fusion) {
+  FUSER_PERF_SCOPE("ExprEvalPlan::ExprEvalPlan");
+  std::unordered_map<const Val*, int64_t> input_indices;
+  for (auto&& [i, in] : enumerate(fusion->inputs())) {
+    input_indices.emplace(in, i);
+  }
+
+  std::unordered_map<const Val*, int64_t> slots;
+  const auto add_leaf = [&](const Val* val) {
+    const int64_t slot = num_slots_++;
+    slots.emplace(val, slot);
+    if (auto it = input_indices.find(val); it != input_indices.end()) {
+      leaves_.push_back({slot, it->second, val});
+    } else if (val->isScalar() && val->isConst()) {
+      constants_.emplace_back(slot, val->value());
+    } else {
+      leaves_.push_back({slot, -1, val});
+    }
+  };
+  const auto add_step = [&](const Expr* expr) {
+    Step step;
+    step.expr = expr;
+    step.is_cat = expr->isA<CatOp>();
+    step.input_vals = dependenciesOf(expr);
+    for (const Val* in : step.input_vals) {
+      step.input_slots.push_back(slots.at(in));
+    }
+    for (Val* out : expr->outputs()) {
+      const int64_t slot = num_slots_++;
+      slots.emplace(out, slot);
+      step.output_slots.push_back(slot);
+    }
+    steps_.push_back(std::move(step));
+  };
+  const auto is_leaf = [&](const Val* val) {
+    return input_indices.count(val) || val->definition() == nullptr ||
+        (val->isScalar() && val->isConst());
+  };
+
+  // Post-order traversal from the outputs. Each entry is a value and whether
+  // its dependencies have been pushed already.
+  std::vector<std::pair<const Val*, bool>> stack;
+  for (Val* out : fusion->outputs() | std::views::reverse) {
+    stack.emplace_back(out, false);
+  }
+  while (!stack.empty()) {
+    auto [val, expanded] = stack.back();
+    stack.pop_back();
+    if (slots.count(val)) {
+      continue;
+    }
+    if (is_leaf(val)) {
+      add_leaf(val);
+      continue;
+    }
+    if (expanded) {
+      add_step(val->definition());
+      continue;
+    }
+    stack.emplace_back(val, true);
+    std::vector<const Val*> dependencies = dependenciesOf(val->definition());
+    for (const Val* dependency : dependencies | std::views::reverse) {
+      if (!slots.count(dependency)) {
+        stack.emplace_back(dependency, false);
+      }
+    }
+  }
+
+  for (Val* out : fusion->outputs()) {
+    output_slots_.push_back(slots.at(out));
+  }
+
+  // Release each intermediate after the last step that reads it, or right
+  // after it's produced if nothing does. Fusion outputs are never released.
+  std::vector<int64_t> last_use(num_slots_, -1);
+  std::vector<bool> is_intermediate(num_slots_, false);
+  for (auto&& [i, step] : enumerate(steps_)) {
+    for (int64_t slot : step.input_slots) {
+      last_use[slot] = i;
+    }
+    for (int64_t slot : step.output_slots) {
+      last_use[slot] = i;
+      is_intermediate[slot] = true;
+    }
+  }
+  for (int64_t slot : output_slots_) {
+    is_intermediate[slot] = false;
+  }
+  for (int64_t slot : arange(num_slots_)) {
+    if (is_intermediate[slot]) {
+      steps_[last_use[slot]].release_slots.push_back(slot);
+    }
+  }
+
+  int64_t live_values = 0;
+  for (const Step& step : steps_) {
+    live_values += std::ssize(step.output_slots);
+    peak_live_values_ = std::max(peak_live_values_, live_values);
+    live_values -= std::ssize(step.release_slots);
+  }
+}
+
+KernelArgumentHolder ExprEvalPlan::run(
+    const KernelArgumentHolder& args,
+    ExpressionEvaluator& expr_eval) const {
+  FUSER_PERF_SCOPE("ExprEvalPlan::run");
+  std::vector<PolymorphicValue> slots(num_slots_);
+  for (const Leaf& leaf : leaves_) {
+    slots[leaf.slot] = leaf.input_index >= 0 ? args[leaf.input_index]
+                                             : expr_eval.evaluate(leaf.val);
+  }
+  for (const auto& [slot, value] : constants_) {
+    slots[slot] = value;
+  }
+
+  for (const Step& step : steps_) {
+    std::vector<PolymorphicValue> outputs;
+    {
+      std::vector<PolymorphicValue> inputs;
+      inputs.reserve(step.input_slots.size());
+      for (auto&& [val, slot] : zip(step.input_vals, step.input_slots)) {
+        NVF_ERROR(
+            slots[slot].hasValue(),
+            "Could not evaluate ",
+            val->toString(),
+            " needed by ",
+            step.expr->toString());
+        inputs.push_back(slots[slot]);
+      }
+      if (step.is_cat) {
+        std::unordered_map<const Val*, PolymorphicValue> known_values;
+        for (auto&& [val, input] : zip(step.input_vals, inputs)) {
+          known_values.emplace(val, std::move(input));
+        }
+        outputs = step.expr->evaluate(expr_eval, known_values);
+      } else {
+        outputs = step.expr->evaluate(expr_eval, inputs);
+      }
+    }
+    NVF_ERROR_EQ(outputs.size(), step.output_slots.size());
+    for (auto&& [slot, output] : zip(step.output_slots, outputs)) {
+      slots[slot] = std::move(output);
+    }
+    for (int64_t slot : step.release_slots) {
+      slots[slot] = std::monostate{};
+    }
+  }
+
+  KernelArgumentHolder outputs;
+  for (int64_t slot : output_slots_) {
+    outputs.push(slots[slot]);
+  }
+  return outputs;
+}
+
+} // namespace nvfuser
@@ -0,0 +1,93 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <expr_evaluator.h>
+#include <polymorphic_value.h>
+#include <runtime/executor_kernel_arg.h>
+#include <visibility.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace nvfuser {
+
+class Expr;
+class Fusion;
+class Val;
+
+//! A flat evaluation plan of the fusion outputs of an ExprEvalExecutor.
+//!
+//! ExpressionEvaluator evaluates outputs recursively and memoizes every value
+//! in a hash map, so all intermediate tensors stay alive until the evaluator
+//! is destroyed. The plan instead orders the expressions that produce the
+//! outputs topologically once, at compile time, and assigns each value a
+//! dense slot. Running the plan evaluates the expressions in order and
+//! releases an intermediate right after its last use, which bounds peak
+//! memory by the live set rather than by the whole segment.
+//!
+//! Values without a definition in the fusion, e.g., extents of input
+//! tensors, are still looked up through the ExpressionEvaluator the inputs
+//! are bound to, and expressions may query it, e.g., for output extents.
+class ExprEvalPlan {
+ public:
+  //! Plans the evaluation of the outputs of `fusion`, which must outlive the
+  //! plan.
+  NVF_API explicit ExprEvalPlan(Fusion* fusion);
+
+  //! Evaluates the fusion outputs. `expr_eval` must have the fusion inputs
+  //! bound, and `args` starts with the fusion inputs in order.
+  NVF_API KernelArgumentHolder
+  run(const KernelArgumentHolder& args, ExpressionEvaluator& expr_eval) const;
+
+  int64_t numSteps() const {
+    return std::ssize(steps_);
+  }
+
+  int64_t numSlots() const {
+    return num_slots_;
+  }
+
+  //! The most intermediate values alive at once while running the plan.
+  int64_t peakLiveValues() const {
+    return peak_live_values_;
+  }
+
+ private:
+  // A value that doesn't come from a step.
+  struct Leaf {
+    int64_t slot = -1;
+    // Position in the fusion inputs, or -1 for values evaluated through the
+    // ExpressionEvaluator.
+    int64_t input_index = -1;
+    const Val* val = nullptr;
+  };
+
+  struct Step {
+    const Expr* expr = nullptr;
+    // For CatOp, these are the inputs of the PadOps preceding it. See
+    // CatOp::evaluate.
+    std::vector<const Val*> input_vals;
+    std::vector<int64_t> input_slots;
+    // -1 for outputs nothing uses.
+    std::vector<int64_t> output_slots;
+    // Slots whose last use is this step.
+    std::vector<int64_t> release_slots;
+    bool is_cat = false;
+  };
+
+  std::vector<Leaf> leaves_;
+  // Constants are filled in at compile time.
+  std::vector<std::pair<int64_t, PolymorphicValue>> constants_;
+  std::vector<Step> steps_;
+  std::vector<int64_t> output_slots_;
+  int64_t num_slots_ = 0;
+  int64_t peak_live_values_ = 0;
+};
+
+} // namespace nvfuser
@@ -0,0 +1,188 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <runtime/foreach_executor.h>
+
+#include <codegen.h>
+#include <device_lower/lower2device.h>
+#include <driver_api.h>
+#include <instrumentation.h>
+#include <runtime/allocations.h>
+#include <runtime/compiled_kernel.h>
+#include <scheduler/foreach.h>
+#include <scheduler/foreach_utils.h>
+
+#include <ATen/ATen.h>
+#include <c10/core/DeviceGuard.h>
+#include <c10/cuda/CUDAStream.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+namespace nvfuser {
+
+ForEachKernelExecutor::ForEachKernelExecutor(
+    const ForEachParams& params,
+    int64_t fusion_id,
+    int64_t concrete_id,
+    int64_t runtime_id,
+    int64_t group_id)
+    : ExecutorAbstract(fusion_id, concrete_id, runtime_id, group_id),
+      params_(params) {
+  NVF_ERROR(supported(&params_), "ForEach heuristics without a chunk table.");
+  std::stringstream name;
+  name << "nvfuser_foreach_f" << fusion_id << "_c" << concrete_id << "_r"
+       << runtime_id << "_g" << group_id;
+  kernel_name_ = name.str();
+}
+
+bool ForEachKernelExecutor::supported(const HeuristicParams* params) {
+  auto* foreach_params = dynamic_cast<const ForEachParams*>(params);
+  return foreach_params != nullptr && foreach_params->use_chunk_table;
+}
+
+void ForEachKernelExecutor::compile(
+    Fusion* fusion,
+    const KernelArgumentHolder& args) {
+  FUSER_PERF_SCOPE("ForEachKernelExecutor::compile");
+  NVF_ERROR(
+      params_.cparams.index_type.has_value(),
+      "Kernel index type is not defined.");
+  fusion_ = std::make_unique<Fusion>(*fusion);
+  device_ = c10::Device(c10::DeviceType::CUDA, args.getDeviceIndex());
+
+  auto position = [](const std::vector<Val*>& vals, Val* val) {
+    auto it = std::find(vals.begin(), vals.end(), val);
+    NVF_ERROR(it != vals.end(), "Not found: ", val->toString());
+    return (int64_t)std::distance(vals.begin(), it);
+  };
+  for (auto&& [i, in] : enumerate(fusion_->inputs())) {
+    if (!in->isA<TensorView>()) {
+      scalar_inputs_.push_back((int64_t)i);
+    }
+  }
+  for (const foreach_utils::ForEachGroup& group :
+       foreach_utils::getForEachGroups(fusion_.get())) {
+    reference_outputs_.push_back(
+        position(fusion_->outputs(), group.reference));
+    std::vector<TableTensor>& tensors = table_tensors_.emplace_back();
+    for (TensorView* tv : foreach_utils::getTableTensors(group)) {
+      tensors.push_back(
+          tv->isFusionInput()
+              ? TableTensor{false, position(fusion_->inputs(), tv)}
+              : TableTensor{true, position(fusion_->outputs(), tv)});
+    }
+  }
+
+  c10::DeviceGuard dg(device_);
+  std::unique_ptr<Fusion> chunk_fusion =
+      ForEachScheduler::makeChunkFusion(fusion_.get(), &params_);
+  GpuLower lower(chunk_fusion.get(), params_.cparams);
+  lower.run();
+  kernel_code_ =
+      codegen::generateForEachCudaKernel(lower.kernel(), kernel_name_);
+  compiled_kernel_ = compileGeneratedCode(
+      kernel_code_,
+      kernel_name_,
+      params_.cparams.index_type.value(),
+      params_.cparams,
+      params_.bdimx);
+}
+
+KernelArgumentHolder ForEachKernelExecutor::run(
+    const KernelArgumentHolder& args,
+    KernelArgumentHolder outputs) {
+  FUSER_PERF_SCOPE("ForEachKernelExecutor::run");
+  NVF_ERROR(isCompiled(), "The ForEach kernel is not compiled.");
+  c10::DeviceGuard dg(device_);
+  const PrimDataType index_type = params_.cparams.index_type.value();
+
+  if (outputs.empty()) {
+    // context manager to disable auto grad for `empty_cuda` calls later
+    at::AutoDispatchBelowADInplaceOrView non_variable_type_mode;
+    ExpressionEvaluator expr_eval =
+        executor_utils::bindInputs(args, fusion_.get());
+    outputs = allocateOutputs(
+        fusion_.get(),
+        getBufferInfos(expr_eval, index_type, fusion_->outputs()),
+        executor_utils::getOutputAliasToInputMap(fusion_.get()),
+        device_,
+        args);
+  }
+
+  std::vector<int64_t> numels;
+  std::vector<std::vector<void*>> data;
+  numels.reserve(table_tensors_.size());
+  data.reserve(table_tensors_.size());
+  for (auto&& [tensors, reference] :
+       zip(table_tensors_, reference_outputs_)) {
+    numels.push_back(outputs[reference].as<at::Tensor>().numel());
+    std::vector<void*>& group_data = data.emplace_back();
+    for (const TableTensor& tensor : tensors) {
+      const PolymorphicValue& arg =
+          tensor.is_output ? outputs[tensor.index] : args[tensor.index];
+      group_data.push_back(arg.as<at::Tensor>().data_ptr());
+    }
+  }
+
+  // The same split over the grid as without a chunk table, but each chunk
+  // gets a block of its own.
+  const std::vector<foreach_utils::ForEachChunk> chunks =
+      foreach_utils::makeChunkTable(
+          numels, params_.bdimx * params_.vectorization_factor, params_.gdimx);
+  if (chunks.empty()) {
+    return outputs;
+  }
+  NVF_ERROR(
+      std::ssize(chunks) <= std::numeric_limits<int32_t>::max(),
+      "Too many chunks: ",
+      chunks.size());
+
+  // Copied through pinned memory so the copy doesn't block the host. The
+  // caching host allocator keeps the pinned buffer until the copy is done.
+  const std::vector<std::byte> host_table =
+      foreach_utils::packChunkTable(chunks, data, index_type);
+  at::Tensor pinned_table = at::empty(
+      {std::ssize(host_table)},
+      at::TensorOptions().dtype(at::kByte).pinned_memory(true));
+  std::memcpy(pinned_table.data_ptr(), host_table.data(), host_table.size());
+  at::Tensor table = pinned_table.to(
+      at::TensorOptions().device(device_), /*non_blocking=*/true);
+
+  std::vector<std::vector<std::byte>> scalars;
+  scalars.reserve(scalar_inputs_.size());
+  for (int64_t i : scalar_inputs_) {
+    scalars.push_back(polymorphicValueToBytes(
+        args[i], fusion_->inputs().at(i)->dtype(), index_type));
+  }
+  void* table_ptr = table.data_ptr();
+  std::vector<void*> params;
+  params.reserve(scalars.size() + 1);
+  params.push_back(&table_ptr);
+  for (std::vector<std::byte>& scalar : scalars) {
+    params.push_back(scalar.data());
+  }
+
+  auto stream = at::cuda::getCurrentCUDAStream();
+  NVFUSER_CUDA_SAFE_CALL(cuLaunchKernel(
+      compiled_kernel_->function,
+      (unsigned)chunks.size(),
+      1,
+      1,
+      (unsigned)params_.bdimx,
+      1,
+      1,
+      0,
+      stream,
+      params.data(),
+      nullptr));
+  return outputs;
+}
+
+} // namespace nvfuser
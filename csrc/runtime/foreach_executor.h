@@ -0,0 +1,95 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <runtime/executor_abstract.h>
+#include <runtime/executor_utils.h>
+#include <scheduler/foreach_heuristic.h>
+#include <visibility.h>
+
+#include <c10/core/Device.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace nvfuser {
+
+//! Runs a fusion of the ForEach scheduler in the style of multi-tensor
+//! apply, when its tensors would exceed the kernel parameter limit as
+//! parameters of their own. The data pointers of the tensors of every group
+//! are packed with the group, offset and numel of each chunk into a table in
+//! global memory (see foreach_utils::packChunkTable), and the kernel only
+//! takes the address of the table and the scalar inputs. Each block runs the
+//! kernel of ForEachScheduler::makeChunkFusion on a chunk (see
+//! codegen::generateForEachCudaKernel).
+//!
+//! Used instead of KernelExecutor for ForEachParams::use_chunk_table.
+class ForEachKernelExecutor : public ExecutorAbstract {
+ public:
+  NVF_API ForEachKernelExecutor(
+      const ForEachParams& params,
+      int64_t fusion_id = 0,
+      int64_t concrete_id = 0,
+      int64_t runtime_id = 0,
+      int64_t group_id = 0);
+
+  //! Whether a segment with heuristics `params` runs with this executor
+  NVF_API static bool supported(const HeuristicParams* params);
+
+  //! `fusion` is the segment left unscheduled by ForEachScheduler::schedule.
+  NVF_API void compile(Fusion* fusion, const KernelArgumentHolder& args);
+
+  bool isCompiled() const override {
+    return compiled_kernel_ != nullptr;
+  }
+
+  NVF_API KernelArgumentHolder
+  run(const KernelArgumentHolder& args, KernelArgumentHolder outputs = {});
+
+  const std::string& kernelName() const {
+    return kernel_name_;
+  }
+
+  //! Returns the generated CUDA code of the kernel
+  const std::string& kernelString() const {
+    NVF_ERROR(!kernel_code_.empty(), "Kernel code not generated");
+    return kernel_code_;
+  }
+
+ private:
+  //! An argument or output whose data pointer goes into the table
+  struct TableTensor {
+    bool is_output = false;
+    int64_t index = 0;
+  };
+
+  ForEachParams params_;
+
+  //! The unscheduled segment, used to allocate outputs
+  std::unique_ptr<Fusion> fusion_;
+
+  //! foreach_utils::getTableTensors of each group
+  std::vector<std::vector<TableTensor>> table_tensors_;
+
+  //! The output whose numel is that of each group
+  std::vector<int64_t> reference_outputs_;
+
+  //! The arguments passed to the kernel as scalars, in order
+  std::vector<int64_t> scalar_inputs_;
+
+  std::string kernel_name_;
+
+  std::string kernel_code_;
+
+  std::unique_ptr<executor_utils::CudaExecutable> compiled_kernel_;
+
+  c10::Device device_ = c10::Device(c10::DeviceType::CUDA, 0);
+};
+
+} // namespace nvfuser
@@ -30,124 +30,177 @@ void encodeBuffer(T value, std::string& buffer) {
 }
 } // namespace
 
-ArgumentManager::ArgumentManager(
-    const KernelArgumentHolder& args,
+SegmentDataflowPlan::SegmentDataflowPlan(
     const RuntimeWorkSpace& runtime_workspace,
-    const std::vector<Val*>& fusion_inputs) {
-  // map from val to args
-  mapFusionInputsToArgs(
-      fusion_inputs, args, runtime_workspace.group_extent_binding_order);
-  setLastUsedSegmentID(runtime_workspace.group_run_order);
+    const std::vector<Val*>& fusion_inputs,
+    const std::vector<Val*>& fusion_outputs) {
+  const auto get_or_add_slot = [&](Val* val) {
+    auto [it, inserted] = slots_.emplace(val, std::ssize(vals_));
+    if (inserted) {
+      vals_.push_back(val);
+    }
+    return it->second;
+  };
+  // Only the first binding of a value counts, like emplacing into a map.
+  const auto add_binding = [&](Val* val) -> int64_t {
+    return slots_.count(val) ? -1 : get_or_add_slot(val);
+  };
+
+  // Bind the fusion inputs and the extents of input tensors, in the order
+  // prepareRuntimeOrder binds them.
+  const std::vector<Val*>& extents =
+      runtime_workspace.group_extent_binding_order;
+  auto extent_it = extents.begin();
+  input_slots_.reserve(fusion_inputs.size());
+  input_extent_slots_.reserve(fusion_inputs.size());
+  for (Val* in : fusion_inputs) {
+    input_slots_.push_back(add_binding(in));
+    std::vector<int64_t>& extent_slots = input_extent_slots_.emplace_back();
+    if (auto* tv = dynamic_cast<TensorView*>(in)) {
+      const auto rank =
+          std::ssize(TensorDomain::noReductions(tv->getLogicalDomain()));
+      NVF_ERROR(
+          std::distance(extent_it, extents.end()) >= rank,
+          "Too few extents to bind for ",
+          tv->toString());
+      for ([[maybe_unused]] auto i : arange(rank)) {
+        extent_slots.push_back(add_binding(*extent_it++));
+      }
+    }
+  }
+
+  // Set the segment where each value is last used. Fusion inputs and outputs
+  // are never released since other fusions or code may use them. Values are
+  // only released with 3 or more segments, starting from the second: the
+  // inputs of the first segment are always fusion inputs and its outputs
+  // are used by at least one following segment.
+  const std::vector<SegmentedGroup*>& run_order =
+      runtime_workspace.group_run_order;
+  const int64_t num_groups = std::ssize(run_order);
+  std::vector<int64_t> last_use;
+  const auto use = [&](Val* val, int64_t run_order_id) {
+    const int64_t slot = get_or_add_slot(val);
+    if (std::ssize(last_use) <= slot) {
+      last_use.resize(slot + 1, -1);
+    }
+    if (num_groups >= 3 && run_order_id >= 1 && !val->isFusionInput() &&
+        !val->isFusionOutput()) {
+      last_use[slot] = run_order_id;
+    }
+    return slot;
+  };
+  segments_.resize(num_groups);
+  for (int64_t run_order_id : arange(num_groups)) {
+    SegmentedGroup* group = run_order[run_order_id];
+    Segment& segment = segments_[run_order_id];
+    for (Val* in : group->inputs()) {
+      segment.input_slots.push_back(use(in, run_order_id));
+    }
+    for (Val* out : group->outputs()) {
+      // The outputs of the last segment are always fusion outputs.
+      segment.output_slots.push_back(
+          use(out, run_order_id < num_groups - 1 ? run_order_id : -1));
+    }
+  }
+  for (int64_t slot : arange(std::ssize(last_use))) {
+    if (last_use[slot] >= 1) {
+      segments_[last_use[slot]].release_slots.push_back(slot);
+    }
+  }
+
+  output_slots_.reserve(fusion_outputs.size());
+  output_repeats_.reserve(fusion_outputs.size());
+  std::unordered_map<int64_t, int64_t> first_output;
+  for (int64_t i : arange(std::ssize(fusion_outputs))) {
+    const int64_t slot = get_or_add_slot(fusion_outputs[i]);
+    output_slots_.push_back(slot);
+    auto [it, inserted] = first_output.emplace(slot, i);
+    output_repeats_.push_back(inserted ? -1 : it->second);
+  }
 }
 
-const PolymorphicValue& ArgumentManager::checkTensorMap(Val* v) const {
-  return tensor_map_.at(v);
+int64_t SegmentDataflowPlan::slot(Val* val) const {
+  auto it = slots_.find(val);
+  return it == slots_.end() ? -1 : it->second;
 }
 
-KernelArgumentHolder ArgumentManager::translateValsToArgs(
-    const std::vector<Val*>& vals) const {
-  std::vector<PolymorphicValue> arg_values;
-  arg_values.reserve(vals.size());
+std::vector<PolymorphicValue> SegmentDataflowPlan::bindInputs(
+    KernelArgumentSpan args) const {
+  NVF_ERROR_EQ(args.size(), std::ssize(input_slots_));
+  std::vector<PolymorphicValue> slots(vals_.size());
+  for (auto&& [i, arg] : enumerate(args)) {
+    if (input_slots_[i] >= 0) {
+      slots[input_slots_[i]] = arg;
+    }
+    // Bind the extents of input tensors in case some segment needs them.
+    const std::vector<int64_t>& extent_slots = input_extent_slots_[i];
+    if (extent_slots.empty() || !arg.is<at::Tensor>()) {
+      continue;
+    }
+    const auto& tensor = arg.as<at::Tensor>();
+    NVF_ERROR_EQ(tensor.dim(), std::ssize(extent_slots));
+    for (auto&& [dim, slot] : enumerate(extent_slots)) {
+      if (slot >= 0) {
+        slots[slot] = tensor.size(dim);
+      }
+    }
+  }
+  return slots;
+}
 
-  for (auto val : vals) {
-    auto it = tensor_map_.find(val);
+KernelArgumentHolder SegmentDataflowPlan::segmentInputs(
+    const std::vector<PolymorphicValue>& slots,
+    int64_t run_order_id) const {
+  const Segment& segment = segments_.at(run_order_id);
+  KernelArgumentHolder holder;
+  holder.reserve(segment.input_slots.size());
+  for (int64_t slot : segment.input_slots) {
     NVF_ERROR(
-        it != tensor_map_.end(),
+        slots[slot].hasValue(),
         "Could not find value ",
-        val->toString(),
+        vals_[slot]->toString(),
         " in tensor map");
-    arg_values.push_back(it->second);
-  }
-
-  KernelArgumentHolder holder;
-  for (auto arg : arg_values) {
-    holder.push(std::move(arg));
+    holder.push(slots[slot]);
   }
   return holder;
 }
 
-void ArgumentManager::updateWithSegmentOutputs(
-    const std::vector<Val*>& group_outputs,
-    const KernelArgumentHolder& group_runtime_outputs,
-    const int64_t group_id) {
-  // Insert graph segment output to tensor map
+void SegmentDataflowPlan::storeSegmentOutputs(
+    std::vector<PolymorphicValue>& slots,
+    KernelArgumentHolder outputs,
+    int64_t run_order_id) const {
+  const Segment& segment = segments_.at(run_order_id);
   NVF_ERROR_EQ(
-      std::ssize(group_outputs),
-      group_runtime_outputs.size(),
+      std::ssize(segment.output_slots),
+      outputs.size(),
       "Output size does not match.");
-  for (const size_t group_out_i : arange(group_outputs.size())) {
-    tensor_map_.emplace(
-        group_outputs[group_out_i], group_runtime_outputs[group_out_i]);
-  }
-
-  // Delete args corresponding to vals lastly used in this segment
-  if (group_id >= 1 && vals_last_used_at_segment_.count(group_id)) {
-    for (auto val : vals_last_used_at_segment_[group_id]) {
-      tensor_map_.erase(val);
+  for (auto&& [slot, output] : zip(segment.output_slots, outputs)) {
+    if (!slots[slot].hasValue()) {
+      slots[slot] = std::move(output);
     }
   }
-}
-
-void ArgumentManager::mapFusionInputsToArgs(
-    const std::vector<Val*>& fusion_inputs,
-    const KernelArgumentHolder& args,
-    const std::vector<Val*>& group_extent_binding_order) {
-  int extent_index = 0;
-  auto original_args_size = args.size();
-  // Bind args in the tensor_map
-  for (const auto i : arange(original_args_size)) {
-    tensor_map_.emplace(fusion_inputs[i], args[i]);
-    // Bind tensorview inputs values in case some segmented group
-    //  needs it down the road.
-    if (args[i].is<at::Tensor>()) {
-      auto rank = args[i].as<at::Tensor>().dim();
-      for (const auto dim : arange(rank)) {
-        tensor_map_.emplace(
-            group_extent_binding_order[extent_index++],
-            args[i].as<at::Tensor>().size(dim));
-      }
-    }
+  for (int64_t slot : segment.release_slots) {
+    slots[slot] = std::monostate{};
   }
 }
 
-void ArgumentManager::setLastUsedSegmentID(
-    const std::vector<SegmentedGroup*>& group_run_order) {
-  // map val to segment_id where arg is lastly used
-  std::unordered_map<Val*, int64_t> last_used_segment_map;
-  const int64_t num_groups = (int64_t)group_run_order.size();
-  // only need to set lifetime of vals if there are more than 3 groups
-  if (num_groups >= 3) {
-    // start from the 2nd group, since the input of the first group is always
-    // the global input and its outputs are always used by at least one of the
-    // following groups
-    for (auto run_order_id : arange(1l, num_groups)) {
-      auto group_to_run = group_run_order.at(run_order_id);
-      // set/update life of vals in inputs of this group
-      for (auto val : group_to_run->inputs()) {
-        // skip fusion inputs and outputs, they may be used by other fusions
-        // or code
-        if (!val->isFusionInput() && !val->isFusionOutput()) {
-          last_used_segment_map[val] = run_order_id;
-        }
-      }
-      // set/update life of vals in outputs of this group
-      // skip the last group since its outputs are always the global outputs
-      if (run_order_id < num_groups - 1) {
-        for (auto val : group_to_run->outputs()) {
-          // skip fusion inputs and outputs, they may be used by other fusions
-          // or code
-          if (!val->isFusionInput() && !val->isFusionOutput()) {
-            last_used_segment_map[val] = run_order_id;
-          }
-        }
-      }
-    }
-    // convert to vals_last_used_at_segment_, so we don't need to iterate over
-    // all vals when erasing
-    for (auto item : last_used_segment_map) {
-      vals_last_used_at_segment_[item.second].push_back(item.first);
+KernelArgumentHolder SegmentDataflowPlan::takeFusionOutputs(
+    std::vector<PolymorphicValue>& slots) const {
+  KernelArgumentHolder outputs;
+  outputs.reserve(output_slots_.size());
+  for (auto&& [slot, repeat] : zip(output_slots_, output_repeats_)) {
+    if (repeat >= 0) {
+      outputs.push(outputs[repeat]);
+      continue;
     }
+    NVF_ERROR(
+        slots[slot].hasValue(),
+        "Segmented fusion output ",
+        vals_[slot]->toString(),
+        " does not exist in `tensor_map`.");
+    outputs.push(std::move(slots[slot]));
   }
+  return outputs;
 }
 
 void prepareRuntimeOrder(
@@ -17,6 +17,7 @@
 #include <list>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -78,66 +79,74 @@ struct PairPointerEquals {
   }
 };
 
-// ArgumentManager is used to manage the lifetime of arguments. It accepts
-// runtime_workspace and fusion_inputs which determine the lifetime of
-// arguments. When updateWithSegmentOutputs is called, it will remove arguments
-// based on the information in runtime_workspace and the group_id passed into
-// updateWithSegmentOutputs.
-class ArgumentManager {
+//! The dataflow between the segments of a SegmentedFusion, computed once
+//! from the run order in RuntimeWorkSpace since it only depends on the
+//! segmentation. Every value passed between segments, i.e., the fusion
+//! inputs, their extents, and the inputs and outputs of each segment, gets a
+//! dense slot. A call fills a flat vector of slots, moving segment outputs
+//! in, and releases a value after the last segment that uses it.
+class SegmentDataflowPlan {
  public:
-  ArgumentManager(
-      const KernelArgumentHolder& args,
-      const RuntimeWorkSpace& runtime_workspace,
-      const std::vector<Val*>& fusion_inputs);
-
-  // Delete copy constructor and assignment operator since we have unique_ptrs
-  ArgumentManager(const ArgumentManager&) = delete;
-  ArgumentManager& operator=(const ArgumentManager&) = delete;
-
-  // Allow move operations
-  ArgumentManager(ArgumentManager&&) = default;
-  ArgumentManager& operator=(ArgumentManager&&) = default;
+  SegmentDataflowPlan() = default;
 
-  // This map is only taken on destruction. It might be good to steal the tensor
-  // map instead of make a copy.
-  std::unordered_map<Val*, PolymorphicValue> getTensorMap() const {
-    return tensor_map_;
+  SegmentDataflowPlan(
+      const RuntimeWorkSpace& runtime_workspace,
+      const std::vector<Val*>& fusion_inputs,
+      const std::vector<Val*>& fusion_outputs);
+
+  //! Returns the slots of a call, with the fusion inputs and the extents of
+  //! the input tensors bound.
+  std::vector<PolymorphicValue> bindInputs(KernelArgumentSpan args) const;
+
+  //! The arguments of the segment at `run_order_id`.
+  KernelArgumentHolder segmentInputs(
+      const std::vector<PolymorphicValue>& slots,
+      int64_t run_order_id) const;
+
+  //! Moves the outputs of the segment at `run_order_id` into their slots and
+  //! releases the values last used by that segment.
+  void storeSegmentOutputs(
+      std::vector<PolymorphicValue>& slots,
+      KernelArgumentHolder outputs,
+      int64_t run_order_id) const;
+
+  //! Moves the fusion outputs out of `slots`.
+  KernelArgumentHolder takeFusionOutputs(
+      std::vector<PolymorphicValue>& slots) const;
+
+  int64_t numSlots() const {
+    return std::ssize(vals_);
   }
 
-  const PolymorphicValue& checkTensorMap(Val* v) const;
-
-  // Translate a vector of Vals to their corresponding entries in tensor_map_
-  KernelArgumentHolder translateValsToArgs(const std::vector<Val*>& vals) const;
+  //! The slot of `val`, or -1 if it isn't passed between segments.
+  int64_t slot(Val* val) const;
 
-  // Update argument manager with outputs from a segment
-  void updateWithSegmentOutputs(
-      const std::vector<Val*>& group_outputs,
-      const KernelArgumentHolder& group_runtime_outputs,
-      const int64_t group_id);
-
-  std::string toString() const {
-    std::stringstream ss;
-    ss << "ArgumentManager {";
-    for (const auto& [key, value] : tensor_map_) {
-      ss << "  " << key->toString() << " : "
-         << PolymorphicValue_functions::toString(value) << std::endl;
-    }
-    ss << "}" << std::endl;
-    return ss.str();
+  //! The slots released after the segment at `run_order_id`.
+  const std::vector<int64_t>& releasedSlots(int64_t run_order_id) const {
+    return segments_.at(run_order_id).release_slots;
   }
 
  private:
-  std::unordered_map<Val*, PolymorphicValue> tensor_map_;
-  // map segment_id to vector of fusion vals lastly used at this segment
-  std::unordered_map<int64_t, std::vector<Val*>> vals_last_used_at_segment_;
-
-  void mapFusionInputsToArgs(
-      const std::vector<Val*>& fusion_inputs,
-      const KernelArgumentHolder& args,
-      const std::vector<Val*>& group_extent_binding_order);
+  struct Segment {
+    std::vector<int64_t> input_slots;
+    std::vector<int64_t> output_slots;
+    std::vector<int64_t> release_slots;
+  };
 
-  void setLastUsedSegmentID(
-      const std::vector<SegmentedGroup*>& group_run_order);
+  // The value of each slot, for error messages.
+  std::vector<Val*> vals_;
+  std::unordered_map<Val*, int64_t> slots_;
+  // Per fusion input, its slot and the slots of its extents, in the order of
+  // RuntimeWorkSpace::group_extent_binding_order. A value is only bound the
+  // first time it appears, so later occurrences are -1.
+  std::vector<int64_t> input_slots_;
+  std::vector<std::vector<int64_t>> input_extent_slots_;
+  // In run order.
+  std::vector<Segment> segments_;
+  std::vector<int64_t> output_slots_;
+  // For a fusion output that repeats an earlier one, the position of the
+  // earlier one. -1 otherwise.
+  std::vector<int64_t> output_repeats_;
 };
 
 //! Encoding an input set to unique id, which is used to short-cut cache entry
@@ -31,8 +31,22 @@
 #include <scheduler/registry.h>
 #include <utils.h>
 
+#include <chrono>
+
 namespace nvfuser {
 
+namespace {
+
+// Background compilations get their own thread. They can't run on
+// getThreadPool() because compileFusionParallel waits for that pool to
+// drain. One thread is enough since segments are still compiled in parallel.
+c10::ThreadPool* getBackgroundCompilationThreadPool() {
+  static c10::ThreadPool pool(1);
+  return &pool;
+}
+
+} // namespace
+
 FusionExecutorCache::FusionExecutorCache(
     std::unique_ptr<Fusion> fusion,
     int64_t fusion_id,
@@ -42,6 +56,12 @@ FusionExecutorCache::FusionExecutorCache(
       fusion_id_{fusion_id},
       auto_schedule_(auto_schedule) {}
 
+FusionExecutorCache::~FusionExecutorCache() {
+  if (background_compilation_.valid()) {
+    background_compilation_.wait();
+  }
+}
+
 KernelArgumentHolder FusionExecutorCache::runFusionWithInputs(
     KernelArgumentHolder args,
     std::optional<PrimDataType> forced_index_type,
@@ -53,7 +73,24 @@ KernelArgumentHolder FusionExecutorCache::runFusionWithInputs(
   }
 
   args.setDeviceIndex(selected_device);
+
+  // FusionProfiler isn't thread-safe, so profiling always compiles in the
+  // foreground.
+  const bool compile_in_background =
+      compilation_policy_ == CompilationPolicy::Background &&
+      !isProfilerEnabled();
   setCacheId(args);
+  // Inputs whose runtime is already compiled keep running kernels while
+  // another runtime is compiled in the background.
+  if (compile_in_background && isCompilingInBackground() &&
+      !hasCompiledKernelRuntimeFor(args, forced_index_type)) {
+    if (std::optional<KernelArgumentHolder> outputs = runEagerFallback(args)) {
+      return *outputs;
+    }
+    background_compilation_stats_.blocking_waits++;
+    waitForBackgroundCompilation();
+  }
+
   auto kernel_runtime = getKernelRuntimeFor(args, forced_index_type);
 
   if (isProfilerEnabled()) {
@@ -61,7 +98,17 @@ KernelArgumentHolder FusionExecutorCache::runFusionWithInputs(
   }
 
   if (!kernel_runtime->isCompiled()) {
-    kernel_runtime->compileFusionParallel(args);
+    if (compile_in_background) {
+      compileInBackground(kernel_runtime, args);
+      if (std::optional<KernelArgumentHolder> outputs =
+              runEagerFallback(args)) {
+        return *outputs;
+      }
+      background_compilation_stats_.blocking_waits++;
+      waitForBackgroundCompilation();
+    } else {
+      kernel_runtime->compileFusionParallel(args);
+    }
   }
 
   most_recent_runtime_ = kernel_runtime;
@@ -77,22 +124,27 @@ KernelArgumentHolder FusionExecutorCache::runFusionWithInputs(
         " failed");
   }
 
-  auto outputs = kernel_runtime->runWithInputs(args);
+  KernelArgumentHolder outputs = kernel_runtime->runWithInputs(args);
 
   // Kernel time measurement is off by default
   kernel_runtime->disableKernelTimeMeasurement();
 
   // Removing aliased outputs, since those are updated by the Fusion. It is not
   // semantically correct to actually return them as outputs from
-  // fusion.
+  // fusion. The rest are moved, not copied, to the front of `outputs`.
   NVF_ERROR_EQ(std::ssize(fusion->outputs()), outputs.size());
-  KernelArgumentHolder unaliased_outputs;
+  int64_t num_unaliased_outputs = 0;
   for (auto out_index : arange(outputs.size())) {
     Val* out = fusion->outputs()[out_index];
-    if (!fusion->getOutputAlias(out).hide_output) {
-      unaliased_outputs.push(outputs[out_index]);
+    if (fusion->getOutputAlias(out).hide_output) {
+      continue;
     }
+    if (num_unaliased_outputs != out_index) {
+      outputs[num_unaliased_outputs] = std::move(outputs[out_index]);
+    }
+    num_unaliased_outputs++;
   }
+  outputs.resize(num_unaliased_outputs);
 
   // NOTE: This should be the last code in the method to capture all host time
   if (isProfilerEnabled()) {
@@ -102,7 +154,7 @@ KernelArgumentHolder FusionExecutorCache::runFusionWithInputs(
     debug() << FusionProfiler::profile();
   }
 
-  return unaliased_outputs;
+  return outputs;
 }
 
 void FusionExecutorCache::setCacheId(KernelArgumentHolder& args) {
@@ -124,17 +176,169 @@ void FusionExecutorCache::setCacheId(KernelArgumentHolder& args) {
   args.setCacheId(id_lookup_ret.id);
 }
 
-bool FusionExecutorCache::isCompiled(
-    const KernelArgumentHolder& inputs,
+void FusionExecutorCache::precompile(
+    const std::vector<KernelArgumentHolder>& signatures,
     int8_t device) {
+  FUSER_PERF_SCOPE("FusionExecutorCache::precompile");
+  waitForBackgroundCompilation();
+
+  // Creating runtimes updates the cache, so it's done sequentially. A
+  // signature may reuse a runtime created for an earlier one.
+  std::vector<std::pair<FusionKernelRuntime*, KernelArgumentHolder>>
+      to_compile;
+  std::unordered_set<FusionKernelRuntime*> seen;
+  for (const KernelArgumentHolder& signature : signatures) {
+    KernelArgumentHolder args(signature);
+    args.setDeviceIndex(device);
+    setCacheId(args);
+    FusionKernelRuntime* kernel_runtime = getKernelRuntimeFor(args);
+    if (!kernel_runtime->isCompiled() && seen.insert(kernel_runtime).second) {
+      to_compile.emplace_back(kernel_runtime, std::move(args));
+    }
+  }
+
+  // FusionProfiler isn't thread-safe.
+  if (to_compile.size() <= 1 || isProfilerEnabled() ||
+      isOptionDisabled(DisableOption::ParallelCompile)) {
+    for (auto& [kernel_runtime, args] : to_compile) {
+      kernel_runtime->compileFusionParallel(args);
+    }
+    return;
+  }
+
+  // Runtimes are independent, so each is compiled on its own thread. Their
+  // segments are still compiled in parallel on getThreadPool(), which can't
+  // run these tasks because compileFusionParallel waits for it to drain.
+  std::vector<std::future<void>> compilations;
+  compilations.reserve(to_compile.size());
+  const InheritedOptions inherited_options = InheritedOptions::capture();
+  for (auto& [kernel_runtime, args] : to_compile) {
+    compilations.push_back(std::async(
+        std::launch::async,
+        [kernel_runtime = kernel_runtime, &args = args, &inherited_options]() {
+          InheritedOptionsGuard options_guard(inherited_options);
+          kernel_runtime->compileFusionParallel(args);
+        }));
+  }
+  for (std::future<void>& compilation : compilations) {
+    compilation.get();
+  }
+}
+
+bool FusionExecutorCache::isCompiled(KernelArgumentHolder args, int8_t device) {
   FUSER_PERF_SCOPE("FusionExecutorCache::isCompiled");
+  waitForBackgroundCompilation();
 
   // Access kernels associated with the common device id
-  KernelArgumentHolder args(inputs);
   setCacheId(args);
   return getKernelRuntimeFor(args)->isCompiled();
 }
 
+void FusionExecutorCache::waitForBackgroundCompilation() {
+  if (background_compilation_.valid()) {
+    background_runtime_ = nullptr;
+    background_compilation_.get();
+  }
+}
+
+bool FusionExecutorCache::isCompilingInBackground() {
+  if (!background_compilation_.valid()) {
+    return false;
+  }
+  if (background_compilation_.wait_for(std::chrono::seconds(0)) !=
+      std::future_status::ready) {
+    return true;
+  }
+  // Rethrows errors from the compilation.
+  waitForBackgroundCompilation();
+  return false;
+}
+
+bool FusionExecutorCache::hasCompiledKernelRuntimeFor(
+    const KernelArgumentHolder& args,
+    std::optional<PrimDataType> forced_index_type) {
+  // Only the cache ID is looked up. Looking for a reusable runtime would ask
+  // every runtime for heuristics, including the one being compiled.
+  auto id_it = id_to_kernel_runtime_.find(args.getCacheId().value());
+  if (id_it == id_to_kernel_runtime_.end()) {
+    return false;
+  }
+  FusionKernelRuntime* kernel_runtime = id_it->second;
+  if (kernel_runtime == background_runtime_) {
+    return false;
+  }
+  if (forced_index_type.has_value() &&
+      kernel_runtime->getIndexType() != forced_index_type.value()) {
+    return false;
+  }
+  return kernel_runtime->isCompiled();
+}
+
+void FusionExecutorCache::compileInBackground(
+    FusionKernelRuntime* kernel_runtime,
+    KernelArgumentHolder args) {
+  FUSER_PERF_SCOPE("FusionExecutorCache::compileInBackground");
+  NVF_ERROR(
+      !background_compilation_.valid(),
+      "Expected at most one background compilation at a time.");
+  // std::function requires a copyable callable, hence the shared_ptr.
+  // The compilation may outlive the caller's option guards, so it captures
+  // the options it was requested with.
+  auto task = std::make_shared<std::packaged_task<void()>>(
+      [kernel_runtime,
+       args = std::move(args),
+       options = InheritedOptions::capture()]() {
+        InheritedOptionsGuard options_guard(options);
+        kernel_runtime->compileFusionParallel(args);
+      });
+  background_compilation_ = task->get_future();
+  background_runtime_ = kernel_runtime;
+  getBackgroundCompilationThreadPool()->run([task]() { (*task)(); });
+  background_compilation_stats_.background_compilations++;
+}
+
+std::optional<KernelArgumentHolder> FusionExecutorCache::runEagerFallback(
+    const KernelArgumentHolder& args) {
+  FUSER_PERF_SCOPE("FusionExecutorCache::runEagerFallback");
+  if (eager_executor_ == nullptr) {
+    eager_executor_ = std::make_unique<ExprEvalExecutor>();
+    eager_executor_->compileEager(fusion());
+  }
+
+  KernelArgumentHolder outputs;
+  try {
+    outputs = eager_executor_->run(args);
+  } catch (const std::exception&) {
+    // nvfError for unsupported ops, but ATen may also throw c10::Error, e.g.,
+    // for mismatching devices. Either way, the kernels will be used instead.
+    return std::nullopt;
+  }
+  background_compilation_stats_.eager_fallbacks++;
+
+  // Match what kernels would have done to aliased inputs and which outputs
+  // runFusionWithInputs returns.
+  Fusion* fusion = eager_executor_->fusion().get();
+  KernelArgumentHolder unaliased_outputs;
+  for (auto out_index : arange(outputs.size())) {
+    Val* out = fusion->outputs()[out_index];
+    const AliasInfo& alias_info = fusion->getOutputAlias(out);
+    if (alias_info.type == AllocationType::ReuseBuffer) {
+      const auto in_index = std::distance(
+          fusion->inputs().begin(),
+          std::find(
+              fusion->inputs().begin(),
+              fusion->inputs().end(),
+              alias_info.aliased_io));
+      args[in_index].as<at::Tensor>().copy_(
+          outputs[out_index].as<at::Tensor>());
+    }
+    if (!alias_info.hide_output) {
+      unaliased_outputs.push(outputs[out_index]);
+    }
+  }
+  return unaliased_outputs;
+}
+
 Fusion* FusionExecutorCache::fusion() {
   return fusion_.get();
 }
@@ -345,6 +549,9 @@ flatbuffers::Offset<serde::FusionExecutorCache> FusionExecutorCache::serialize(
     flatbuffers::FlatBufferBuilder& builder) const {
   // See definitions in serde/fusion_cache.fbs for tables
   // FusionExecutorCache and KernelRuntimes
+  if (background_compilation_.valid()) {
+    background_compilation_.wait();
+  }
 
   // For serialization, we require a consistent ordering for the
   // kernel_runtimes_ map.
@@ -436,11 +643,7 @@ void FusionExecutorCache::deserialize(
       // to recompute the concretization info.
       KernelArgumentHolder args;
       args.deserialize(fb_device_runtimes->runtimes()->begin()->args());
-      auto expr_eval = executor_utils::bindInputs(args, fusion_.get());
-      cached_conc_info_.emplace_back(
-          std::make_unique<DynamicTransformConcretizationInfo>(
-              &initial_info, &expr_eval, &exact_map_));
-      conc_info = cached_conc_info_.back().get();
+      conc_info = concretizationCache().get(args);
     }
 
     auto config =
@@ -513,6 +716,10 @@ void FusionExecutorCache::deserialize(
 void FusionExecutorCache::evictCache(size_t cache_id) {
   auto it = id_to_kernel_runtime_.find(cache_id);
   NVF_ERROR(it != id_to_kernel_runtime_.end());
+  // Leave the runtime being compiled in the background alone until it's done.
+  if (it->second == background_runtime_) {
+    waitForBackgroundCompilation();
+  }
   it->second->evictCache(cache_id);
   id_to_kernel_runtime_.erase(it);
 }
@@ -575,13 +782,9 @@ FusionKernelRuntime* FusionExecutorCache::getKernelRuntimeFor(
   // Compute concretization info to use as cache key
   DynamicTransformConcretizationInfo* conc_info = nullptr;
   if (initial_info.isDynamic()) {
-    // This class needs to own conc_info so it can be compared in subsequent
-    // invocations.
-    auto expr_eval = executor_utils::bindInputs(args, fusion_.get());
-    cached_conc_info_.emplace_back(
-        std::make_unique<DynamicTransformConcretizationInfo>(
-            &initial_info, &expr_eval, &exact_map_));
-    conc_info = cached_conc_info_.back().get();
+    // The cache owns conc_info, and returns the same pointer for inputs that
+    // concretize the same way.
+    conc_info = concretizationCache().get(args);
   }
 
   // Initialize or fetch vector of FusionKernelRuntime objects associated with
@@ -595,6 +798,20 @@ FusionKernelRuntime* FusionExecutorCache::getKernelRuntimeFor(
     deterministic_conc_info_.emplace_back(device_concrete_key);
   }
 
+  // With shape bucketing, heuristics are computed for a representative of
+  // the bucket the input shapes fall into, both when looking for a reusable
+  // runtime and when creating a new one. Dynamic fusions aren't bucketed
+  // because their concretization depends on the actual extents.
+  std::optional<KernelArgumentHolder> bucketed_args;
+  if (shape_bucketing_.has_value() && !initial_info.isDynamic()) {
+    bucketed_args = shape_bucketing_->bucketArgs(args);
+  }
+  const KernelArgumentHolder& heuristic_args =
+      bucketed_args.has_value() ? *bucketed_args : args;
+  if (bucketed_args.has_value()) {
+    shape_bucketing_stats_.bucketed_lookups++;
+  }
+
   // Check for re-use hit case
   //  a kernel runtime is re-usable if all the compiled
   //  kernels have the same heuristic parameters
@@ -616,9 +833,10 @@ FusionKernelRuntime* FusionExecutorCache::getKernelRuntimeFor(
     auto runtime_it = std::find_if(
         kernel_runtimes.begin(),
         kernel_runtimes.end(),
-        [&args, &new_heuristics, &forced_index_type](auto& kernel_runtime) {
-          auto maybe_heuristics =
-              kernel_runtime->getMaybeHeuristicsFor(args, forced_index_type);
+        [&heuristic_args, &new_heuristics, &forced_index_type](
+            auto& kernel_runtime) {
+          auto maybe_heuristics = kernel_runtime->getMaybeHeuristicsFor(
+              heuristic_args, forced_index_type);
           if (!maybe_heuristics.has_value()) {
             return false;
           }
@@ -627,6 +845,16 @@ FusionKernelRuntime* FusionExecutorCache::getKernelRuntimeFor(
         });
     if (runtime_it != kernel_runtimes.end()) {
       kernel_runtime = runtime_it->get();
+      if (bucketed_args.has_value()) {
+        shape_bucketing_stats_.reused_runtimes++;
+        if (isDebugDumpEnabled(DebugDumpOption::ShapeBucketing)) {
+          if (!kernel_runtime->getMaybeHeuristicsFor(args, forced_index_type)
+                   .has_value()) {
+            shape_bucketing_stats_.compiles_avoided++;
+          }
+          debug() << shape_bucketing_stats_ << std::endl;
+        }
+      }
       kernel_runtime->updateHeuristicsLaunchParams(new_heuristics.get());
       id_to_kernel_runtime_[unique_id] = kernel_runtime;
       return kernel_runtime;
@@ -667,7 +895,7 @@ FusionKernelRuntime* FusionExecutorCache::getKernelRuntimeFor(
     FusionGuard fg(conc_fusion.get());
     kernel_runtimes.emplace_back(std::make_unique<FusionKernelRuntime>(
         std::move(conc_fusion),
-        args,
+        heuristic_args,
         /*serde_buffer=*/nullptr,
         forced_index_type,
         fusion_id_,
@@ -675,6 +903,12 @@ FusionKernelRuntime* FusionExecutorCache::getKernelRuntimeFor(
         kernel_runtimes.size(),
         auto_schedule_));
     kernel_runtime = kernel_runtimes.back().get();
+    if (bucketed_args.has_value()) {
+      shape_bucketing_stats_.new_runtimes++;
+      if (isDebugDumpEnabled(DebugDumpOption::ShapeBucketing)) {
+        debug() << shape_bucketing_stats_ << std::endl;
+      }
+    }
 
     if (profiling_) {
       kernel_runtime->profile(true);
@@ -698,4 +932,13 @@ DynamicTransformInitialInfo& FusionExecutorCache::initialInfo() {
   return initial_info_.value();
 }
 
+DynamicTransformConcretizationCache& FusionExecutorCache::
+    concretizationCache() {
+  if (conc_info_cache_ == nullptr) {
+    conc_info_cache_ = std::make_unique<DynamicTransformConcretizationCache>(
+        &initialInfo(), &exact_map_);
+  }
+  return *conc_info_cache_;
+}
+
 } // namespace nvfuser
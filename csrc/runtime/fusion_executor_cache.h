@@ -12,12 +12,15 @@
 #include <exceptions.h>
 #include <fusion.h>
 #include <fusion_segmenter.h>
+#include <options.h>
 #include <runtime/fusion_cache_utils.h>
+#include <runtime/shape_bucketing.h>
 #include <scheduler/heuristic.h>
 #include <serde/fusion_cache_generated.h>
 
 #include <c10/util/ArrayRef.h>
 
+#include <future>
 #include <mutex>
 #include <type_traits>
 #include <unordered_map>
@@ -31,6 +34,27 @@ class FusionKernelRuntime;
 class KernelArgumentHolder;
 enum class PrimDataType;
 
+//! How FusionExecutorCache::runFusionWithInputs compiles kernels for inputs
+//! that no compiled FusionKernelRuntime can run.
+enum class CompilationPolicy {
+  //! Block until all segments are compiled.
+  Blocking,
+  //! Compile in the background and, until the kernels are ready, evaluate the
+  //! unscheduled fusion op by op with ATen. Defaults to this with
+  //! NVFUSER_ENABLE=async_compile.
+  Background,
+};
+
+struct BackgroundCompilationStats {
+  //! Compilations started in the background.
+  int64_t background_compilations = 0;
+  //! Calls evaluated op by op because their kernels were still compiling.
+  int64_t eager_fallbacks = 0;
+  //! Calls that waited for a compilation because op-by-op evaluation failed,
+  //! e.g., because the fusion has an op without an ATen evaluation.
+  int64_t blocking_waits = 0;
+};
+
 //! [ Note -- Post-definition cache implementation ]
 //!
 //! First note that depending on how we acquire a computational graph, there may
@@ -89,7 +113,10 @@ enum class PrimDataType;
 //! In the case of a dynamic Fusion, input scalars such as integer parameters to
 //! a model could potentially affect the structure of a concretized Fusion, so
 //! we take care to include those scalars in the input ID along with the extents
-//! of tensor arguments.
+//! of tensor arguments. Concretization infos are computed and interned by a
+//! DynamicTransformConcretizationCache, so a cache ID miss whose inputs
+//! concretize like earlier ones neither reanalyzes the Fusion nor keeps
+//! another copy of the same info.
 //!
 //! * note on unique computational graph
 //! In theory, computational graph should refer to only the computational nodes
@@ -124,6 +151,9 @@ class FusionExecutorCache {
       int64_t fusion_id = 0,
       bool auto_schedule = true);
 
+  //! Waits for a background compilation, if any, to finish.
+  NVF_API ~FusionExecutorCache();
+
   //! Execute fusion graph with given inputs, create `KernelExecutor` as needed
   //! Note this function also handles permutation & input update outside of
   //! codegen.
@@ -140,11 +170,21 @@ class FusionExecutorCache {
       std::optional<PrimDataType> forced_index_type = std::nullopt,
       std::optional<int8_t> selected_device = std::nullopt);
 
-  //! query if there's a kernel ready to go for given inputs
-  NVF_API bool isCompiled(
-      const KernelArgumentHolder& inputs,
+  //! Ahead-of-time compilation for a known set of input signatures. Each
+  //! element of `signatures` stands for a set of inputs, typically with
+  //! tensors created by KernelArgumentHolder::pushTensorProxy so no device
+  //! memory or data is needed. Every signature that no existing runtime can
+  //! run gets a segmented, scheduled and compiled FusionKernelRuntime, and
+  //! the new runtimes are compiled in parallel. Later calls with real tensors
+  //! of the same shapes and strides hit the cache, and serialize() includes
+  //! the precompiled runtimes.
+  NVF_API void precompile(
+      const std::vector<KernelArgumentHolder>& signatures,
       int8_t device = 0);
 
+  //! query if there's a kernel ready to go for given inputs
+  NVF_API bool isCompiled(KernelArgumentHolder args, int8_t device = 0);
+
   Fusion* fusion();
 
   const Fusion* fusion() const;
@@ -203,6 +243,34 @@ class FusionExecutorCache {
   //! runtimes on all devices.
   size_t countRuntimes(int8_t device = -1) const;
 
+  //! Compute heuristics for bucketed input shapes so that inputs whose
+  //! shapes fall into the same buckets share a FusionKernelRuntime. Pass
+  //! std::nullopt to disable. Defaults to what
+  //! NVFUSER_ENABLE=shape_bucketing requests. See ShapeBucketing.
+  void setShapeBucketing(std::optional<ShapeBucketing> shape_bucketing) {
+    shape_bucketing_ = std::move(shape_bucketing);
+  }
+
+  const ShapeBucketingStats& shapeBucketingStats() const {
+    return shape_bucketing_stats_;
+  }
+
+  void setCompilationPolicy(CompilationPolicy policy) {
+    compilation_policy_ = policy;
+  }
+
+  CompilationPolicy compilationPolicy() const {
+    return compilation_policy_;
+  }
+
+  const BackgroundCompilationStats& backgroundCompilationStats() const {
+    return background_compilation_stats_;
+  }
+
+  //! Blocks until the background compilation, if any, finishes. Rethrows
+  //! errors from the compilation.
+  NVF_API void waitForBackgroundCompilation();
+
   void profile(bool to_profile);
 
   //! Internal knob for profiling shape inference
@@ -246,12 +314,37 @@ class FusionExecutorCache {
       const KernelArgumentHolder& inputs,
       std::optional<PrimDataType> forced_index_type = std::nullopt);
 
+  //! Returns true if a background compilation is still in flight. Rethrows
+  //! errors from a finished one.
+  bool isCompilingInBackground();
+
+  //! Returns true if the runtime cached for the cache ID of `args` is
+  //! compiled. It is never the runtime being compiled in the background.
+  bool hasCompiledKernelRuntimeFor(
+      const KernelArgumentHolder& args,
+      std::optional<PrimDataType> forced_index_type);
+
+  //! Compiles `kernel_runtime` on the background compilation thread.
+  void compileInBackground(
+      FusionKernelRuntime* kernel_runtime,
+      KernelArgumentHolder args);
+
+  //! Evaluates the unscheduled fusion op by op with ATen. Returns
+  //! std::nullopt if that fails.
+  std::optional<KernelArgumentHolder> runEagerFallback(
+      const KernelArgumentHolder& args);
+
   //! Get initial concretization info (without inputs). This computes the info
   //! if it has not yet been computed, then caches it for later use. This means
   //! this method should not be called until the definition of the Fusion is
   //! finalized.
   DynamicTransformInitialInfo& initialInfo();
 
+  //! Get the cache of concretization infos, creating it on first use. Like
+  //! initialInfo(), this should only be called for a finalized dynamic
+  //! Fusion.
+  DynamicTransformConcretizationCache& concretizationCache();
+
  private:
   //! original un-scheduled `Fusion`. This may contain dynamic transforms and
   //! Symbolic IterDomains.
@@ -274,12 +367,9 @@ class FusionExecutorCache {
       PairPointerEquals>
       kernel_runtimes_;
 
-  //! This seems to just own the unique pointer of
-  //! DynamicTransformConcretizationInfo which is implicitly being used for
-  //! lifetime of entries in kernel_runtimes_. We should push the lifetime to
-  //! the unordered_map if possible.
-  std::vector<std::unique_ptr<DynamicTransformConcretizationInfo>>
-      cached_conc_info_;
+  //! Owns the interned DynamicTransformConcretizationInfo objects keying
+  //! kernel_runtimes_ and conc_info_id_map_, so they outlive those entries.
+  std::unique_ptr<DynamicTransformConcretizationCache> conc_info_cache_;
 
   //! Map each pair of device_id and concretization info to an integer id
   std::unordered_map<ConcreteInfo, int64_t, PairPointerHash, PairPointerEquals>
@@ -301,6 +391,29 @@ class FusionExecutorCache {
   //! Flag to indicate kernel time measurement
   bool measure_kernel_time_ = false;
 
+  //! Bucketing policy for heuristics. Unset when bucketing is disabled.
+  std::optional<ShapeBucketing> shape_bucketing_ =
+      ShapeBucketing::fromOptions();
+
+  ShapeBucketingStats shape_bucketing_stats_;
+
+  CompilationPolicy compilation_policy_ =
+      isOptionEnabled(EnableOption::AsyncCompile)
+      ? CompilationPolicy::Background
+      : CompilationPolicy::Blocking;
+
+  //! At most one compilation is in flight per FusionExecutorCache. While it
+  //! is, the runtime being compiled is left alone, so the compilation thread
+  //! is the only one touching it. Other runtimes that are already compiled
+  //! keep running.
+  std::future<void> background_compilation_;
+  FusionKernelRuntime* background_runtime_ = nullptr;
+
+  //! Evaluates the unscheduled fusion while kernels are being compiled.
+  std::unique_ptr<ExprEvalExecutor> eager_executor_;
+
+  BackgroundCompilationStats background_compilation_stats_;
+
   //! Logging state for most recent compilation
   ExecutorLog most_recent_executor_log_;
 
@@ -17,18 +17,28 @@
 #include <ir/base_nodes.h>
 #include <multidevice/communication.h>
 #include <multidevice/utils.h>
+#include <options.h>
+#include <preseg_passes/insert_reshardings.h>
 #include <preseg_passes/pre_segmenter.h>
 #include <python_frontend/fusion_definition.h>
 #include <python_frontend/translation.h>
 #include <runtime/executor.h>
 #include <runtime/executor_dispatch.h>
+#include <runtime/executor_kernel_arg.h>
+#include <runtime/executor_utils.h>
+#include <runtime/foreach_executor.h>
 #include <runtime/fusion_cache_utils.h>
+#include <runtime/horizontal_executor.h>
+#include <scheduler/cost_model.h>
 #include <scheduler/heuristic.h>
 #include <serde/fusion_cache_generated.h>
 #include <type.h>
 
 #include <c10/cuda/CUDAGuard.h>
 
+#include <algorithm>
+#include <unordered_set>
+
 namespace nvfuser {
 
 namespace {
@@ -79,8 +89,23 @@ FusionKernelRuntime::FusionKernelRuntime(
       !fusion->hasDynamicTransform(),
       "Fusion must be concretized before constructing FusionKernelRuntime");
 
-  preseg_passes::OptimizationPass<preseg_passes::PreSegmenter>::runPass(
-      fusion.get());
+  // Lets InsertReshardingsPass weigh reshardings by the actual sizes. Only
+  // multi-device fusions have reshardings, so others skip the binding. Note
+  // that the resharding decisions are made for the sizes of this first
+  // call: the runtime is reused for any later inputs its heuristics accept,
+  // even if different sizes would have favored different reshardings.
+  std::optional<ExpressionEvaluator> expr_eval;
+  if (std::ranges::any_of(fusion->allTvs(), [](TensorView* tv) {
+        return tv->hasDeviceMesh();
+      })) {
+    expr_eval = executor_utils::bindInputs(args, fusion.get());
+  }
+  {
+    preseg_passes::InsertReshardingsPass::ExpressionEvaluatorGuard
+        expr_eval_guard(expr_eval.has_value() ? &*expr_eval : nullptr);
+    preseg_passes::OptimizationPass<preseg_passes::PreSegmenter>::runPass(
+        fusion.get());
+  }
 
   if (isDebugDumpEnabled(DebugDumpOption::FusionIrPreseg)) {
     const auto& communicator = Communicator::getInstance();
@@ -131,6 +156,10 @@ FusionKernelRuntime::FusionKernelRuntime(
   // Pre-compute the executor order so that the run time path
   //  would go directly to kernel launch.
   prepareRuntimeOrder(segmented_fusion_.get(), runtime_workspace_);
+  segment_dataflow_plan_ = SegmentDataflowPlan(
+      runtime_workspace_,
+      segmented_fusion_->inputs(),
+      segmented_fusion_->outputs());
 
   executors_.resize(segmented_fusion_->groups().size());
 
@@ -246,7 +275,12 @@ void FusionKernelRuntime::deserialize(
 
     // Initialize associated executors
     executors_[group_id] = ExecutorDispatch::makeExecutor(
-        fusion_to_run.get(), fusion_id_, concrete_id_, runtime_id_, group_id);
+        fusion_to_run.get(),
+        fusion_id_,
+        concrete_id_,
+        runtime_id_,
+        group_id,
+        heuristic_params);
 
     // Deserialize KernelExecutor; Otherwise use ExecutorDispatch
     if (auto ke =
@@ -271,6 +305,8 @@ void FusionKernelRuntime::deserialize(
           heuristic_params->scheduler_type);
     }
   }
+
+  fuseSegmentsHorizontally();
 }
 
 PrimDataType FusionKernelRuntime::getIndexType() const {
@@ -308,23 +344,13 @@ KernelArgumentHolder FusionKernelRuntime::runWithInputs(
   }
 
   c10::Device device(c10::DeviceType::CUDA, (int8_t)args.getDeviceIndex());
-  const auto& tensor_map = runSegmentsWithInputs(args);
+  KernelArgumentHolder fusion_outputs = runSegmentsWithInputs(args);
 
   if (isDebugDumpEnabled(DebugDumpOption::PerfDebugVerbose)) {
     debug() << "============= FINISHED RUNNING FUSION SEGMENTS ============"
             << std::endl;
   }
 
-  // Produce final global output
-  KernelArgumentHolder fusion_outputs;
-  for (Val* output : segmented_fusion_->outputs()) {
-    NVF_ERROR(
-        tensor_map.count(output),
-        "Segmented fusion output ",
-        output->toString(),
-        " does not exist in `tensor_map`.");
-    fusion_outputs.push(tensor_map.at(output));
-  }
   return fusion_outputs;
 }
 
@@ -334,8 +360,8 @@ std::vector<KernelArgumentHolder> FusionKernelRuntime::prepareInputs(
   const int64_t num_groups = numGroups();
   all_runtime_inputs.reserve(num_groups);
 
-  ArgumentManager args_manager(
-      args, runtime_workspace_, segmented_fusion_->inputs());
+  std::vector<PolymorphicValue> slots =
+      segment_dataflow_plan_.bindInputs(args);
 
   // group should share cache id.
   const auto group_cache_id = args.getCacheId();
@@ -345,7 +371,7 @@ std::vector<KernelArgumentHolder> FusionKernelRuntime::prepareInputs(
     // TODO: index mode should be updated per segmented kernel
     // Prepare input vector
     all_runtime_inputs.push_back(
-        args_manager.translateValsToArgs(group_to_run->inputs()));
+        segment_dataflow_plan_.segmentInputs(slots, run_order_id));
     auto& group_runtime_inputs = all_runtime_inputs.back();
 
     group_runtime_inputs.setDeviceIndex(args.getDeviceIndex());
@@ -359,9 +385,8 @@ std::vector<KernelArgumentHolder> FusionKernelRuntime::prepareInputs(
     auto group_runtime_outputs =
         inferOutputSizes(fusion_to_run.get(), group_runtime_inputs);
 
-    // map output args to tensor map
-    args_manager.updateWithSegmentOutputs(
-        group_to_run->outputs(), group_runtime_outputs, run_order_id);
+    segment_dataflow_plan_.storeSegmentOutputs(
+        slots, std::move(group_runtime_outputs), run_order_id);
   }
 
   return all_runtime_inputs;
@@ -407,6 +432,9 @@ void FusionKernelRuntime::compileFusionParallel(KernelArgumentHolder args) {
   std::atomic<bool> detect_exception_in_thread_pool{false};
   std::string thread_pool_error_message;
   std::mutex thread_pool_error_message_mutex;
+  // Segments compile with the options of this thread, even if options are
+  // changed elsewhere meanwhile.
+  const InheritedOptions inherited_options = InheritedOptions::capture();
 
   // As we pass pointers taken from unique_ptrs to worker threads,
   // exception handling needs to wait for the worker threads before
@@ -426,10 +454,12 @@ void FusionKernelRuntime::compileFusionParallel(KernelArgumentHolder args) {
                               &group_runtime_inputs,
                               group_to_run,
                               hic_ptr,
+                              &inherited_options,
                               &detect_exception_in_thread_pool,
                               &thread_pool_error_message,
                               &thread_pool_error_message_mutex]() {
           FUSER_PERF_SCOPE("FusionKernelRuntime::compileFusionParallel");
+          InheritedOptionsGuard options_guard(inherited_options);
           try {
             compileKernel(group_runtime_inputs, group_to_run, hic_ptr);
           } catch (const std::exception& e) {
@@ -556,6 +586,8 @@ void FusionKernelRuntime::compileFusionParallel(KernelArgumentHolder args) {
 
     hie_ = std::make_unique<hir::HostIrEvaluator>(
         std::move(hic), &Communicator::getInstance());
+  } else {
+    fuseSegmentsHorizontally();
   }
 
   if (isProfilerEnabled()) {
@@ -563,6 +595,85 @@ void FusionKernelRuntime::compileFusionParallel(KernelArgumentHolder args) {
   }
 }
 
+void FusionKernelRuntime::fuseSegmentsHorizontally() {
+  FUSER_PERF_SCOPE("FusionKernelRuntime::fuseSegmentsHorizontally");
+  // The static shared memory of the segments adds up in the horizontal
+  // kernel. This is the limit CompiledKernel checks for a single kernel.
+  constexpr int64_t max_static_smem = 48 << 10;
+
+  const int64_t num_groups = numGroups();
+  horizontal_executors_.clear();
+  if (!isOptionEnabled(EnableOption::HorizontalFusion)) {
+    return;
+  }
+  horizontal_executors_.resize(num_groups);
+
+  int64_t begin = 0;
+  while (begin < num_groups) {
+    std::vector<KernelExecutor*> batch;
+    std::unordered_set<Val*> batch_outputs;
+    // The parameters of all the segments, plus the grid dimensions of each,
+    // are passed to the horizontal kernel.
+    int64_t param_bytes = 0;
+    int64_t static_smem = 0;
+    int64_t end = begin;
+    for (; end < num_groups; ++end) {
+      SegmentedGroup* group = runtime_workspace_.group_run_order.at(end);
+      auto* ke =
+          dynamic_cast<KernelExecutor*>(executors_.at(group->groupId()).get());
+      if (!HorizontalKernelExecutor::supported(ke)) {
+        break;
+      }
+      kir::Kernel* kernel = ke->compiledKernel()->kernel();
+      if (!batch.empty() &&
+          kernel->indexType() !=
+              batch.front()->compiledKernel()->kernel()->indexType()) {
+        break;
+      }
+      // Segments in a batch are consecutive in the run order, so a segment
+      // can only depend on the batch through the inputs it takes from it.
+      if (std::any_of(
+              group->inputs().begin(), group->inputs().end(), [&](Val* in) {
+                return batch_outputs.count(in) > 0;
+              })) {
+        break;
+      }
+      int64_t segment_param_bytes = (int64_t)sizeof(dim3);
+      for (Val* param : kernel->parameters()) {
+        segment_param_bytes +=
+            kernelParameterBytes(param, kernel->indexType());
+      }
+      const int64_t segment_static_smem = ke->getStaticSmemSize();
+      if (param_bytes + segment_param_bytes > kMaxKernelParameterBytes ||
+          static_smem + segment_static_smem > max_static_smem) {
+        break;
+      }
+      param_bytes += segment_param_bytes;
+      static_smem += segment_static_smem;
+      batch.push_back(ke);
+      batch_outputs.insert(group->outputs().begin(), group->outputs().end());
+    }
+
+    if (batch.size() > 1) {
+      auto hke = std::make_unique<HorizontalKernelExecutor>(
+          std::move(batch), fusion_id_, concrete_id_, runtime_id_);
+      // The segments still run separately if the horizontal kernel fails to
+      // compile, e.g., because it needs more registers than any segment.
+      try {
+        hke->compile();
+        horizontal_executors_.at(begin) = std::move(hke);
+      } catch (const std::exception& e) {
+        if (isDebugDumpEnabled(DebugDumpOption::FusionSegments)) {
+          debug() << "Horizontal fusion of segments " << begin << " to "
+                  << end - 1 << " failed to compile: " << e.what()
+                  << std::endl;
+        }
+      }
+    }
+    begin = std::max(end, begin + 1);
+  }
+}
+
 void FusionKernelRuntime::disableKernelLaunch() {
   NVF_CHECK(
       isCompiled(),
@@ -600,10 +711,8 @@ std::optional<std::unique_ptr<HeuristicParamsList>> FusionKernelRuntime::
   std::unique_ptr<HeuristicParamsList> heuristics =
       std::make_unique<HeuristicParamsList>(num_groups);
 
-  // We make a mutable copy of args so that we can use it in an
-  // ArgumentManager
-  ArgumentManager args_manager(
-      args, runtime_workspace_, segmented_fusion_->inputs());
+  std::vector<PolymorphicValue> slots =
+      segment_dataflow_plan_.bindInputs(args);
   // Follow group run order
   for (int64_t run_order_id : arange(num_groups)) {
     auto group_to_run = runtime_workspace_.group_run_order.at(run_order_id);
@@ -615,7 +724,7 @@ std::optional<std::unique_ptr<HeuristicParamsList>> FusionKernelRuntime::
 
     // Get input arguments for SchedulerRuntimeInfo
     KernelArgumentHolder group_runtime_inputs =
-        args_manager.translateValsToArgs(group_to_run->inputs());
+        segment_dataflow_plan_.segmentInputs(slots, run_order_id);
     group_runtime_inputs.setDeviceIndex(args.getDeviceIndex());
 
     // Create PrecomputedValues for fusion segment
@@ -649,6 +758,28 @@ std::optional<std::unique_ptr<HeuristicParamsList>> FusionKernelRuntime::
       heuristics->at(group_to_run->groupId()) =
           segmented_fusion_->makeInitialHeuristicParams(
               group_to_run, fusion_to_run_info);
+      if (isDebugDumpEnabled(DebugDumpOption::HeuristicCandidates)) {
+        const auto& dump_args =
+            getDebugDumpArguments(DebugDumpOption::HeuristicCandidates);
+        int64_t k = 5;
+        if (!dump_args.empty()) {
+          try {
+            size_t pos = 0;
+            k = std::stoll(dump_args.at(0), &pos);
+            NVF_CHECK(pos == dump_args.at(0).size() && k > 0);
+          } catch (const std::exception&) {
+            NVF_THROW(
+                "Expected a positive number of heuristic candidates: ",
+                dump_args.at(0));
+          }
+        }
+        cost_model::dumpCandidates(
+            debug(),
+            fusion_to_run,
+            fusion_to_run_info,
+            *heuristics->at(group_to_run->groupId()),
+            k);
+      }
     } else {
       // Try to get scheduler entry
       // NOTE: we are able to skip compile time checks here since the fusion
@@ -682,8 +813,8 @@ std::optional<std::unique_ptr<HeuristicParamsList>> FusionKernelRuntime::
         group_runtime_inputs,
         evaluator_precomputed_values.get());
 
-    args_manager.updateWithSegmentOutputs(
-        group_to_run->outputs(), group_runtime_outputs, run_order_id);
+    segment_dataflow_plan_.storeSegmentOutputs(
+        slots, std::move(group_runtime_outputs), run_order_id);
   }
   return heuristics;
 }
@@ -704,27 +835,38 @@ const std::vector<std::unique_ptr<ExecutorAbstract>>& FusionKernelRuntime::
   return executors_;
 }
 
-std::unordered_map<Val*, PolymorphicValue> FusionKernelRuntime::
-    runSegmentsWithInputs(const KernelArgumentHolder& args) {
+KernelArgumentHolder FusionKernelRuntime::runSegmentsWithInputs(
+    const KernelArgumentHolder& args) {
   FUSER_PERF_SCOPE("FusionKernelRuntime::runSegmentsWithInputs");
   NVF_ERROR_EQ(
       args.size(),
       std::ssize(segmented_fusion_->inputs()),
       "Inputs were not set up correctly.");
 
-  ArgumentManager args_manager(
-      args, runtime_workspace_, segmented_fusion_->inputs());
+  std::vector<PolymorphicValue> slots =
+      segment_dataflow_plan_.bindInputs(args);
 
   // group should share cache id.
   auto group_cache_id = args.getCacheId();
   const int64_t num_groups = (int64_t)runtime_workspace_.group_run_order.size();
   kernel_time_ms_ = 0;
-  for (auto run_order_id : arange(num_groups)) {
+  // The profilers time and log each segment on its own.
+  const bool run_horizontally = !horizontal_executors_.empty() &&
+      !profiling_ && !isProfilerEnabled();
+  for (int64_t run_order_id = 0; run_order_id < num_groups; ++run_order_id) {
+    if (run_horizontally && horizontal_executors_.at(run_order_id)) {
+      HorizontalKernelExecutor* hke =
+          horizontal_executors_.at(run_order_id).get();
+      runHorizontalSegments(hke, run_order_id, slots, args);
+      run_order_id += std::ssize(hke->executors()) - 1;
+      continue;
+    }
+
     // TODO: index mode should be updated per segmented kernel
     // Prepare input vector
     auto group_to_run = runtime_workspace_.group_run_order.at(run_order_id);
     KernelArgumentHolder group_runtime_inputs =
-        args_manager.translateValsToArgs(group_to_run->inputs());
+        segment_dataflow_plan_.segmentInputs(slots, run_order_id);
     group_runtime_inputs.setDeviceIndex(args.getDeviceIndex());
     if (group_cache_id.has_value()) {
       group_runtime_inputs.setCacheId(group_cache_id.value());
@@ -735,37 +877,41 @@ std::unordered_map<Val*, PolymorphicValue> FusionKernelRuntime::
 
     // Run graph segment
     KernelArgumentHolder group_runtime_outputs =
-        runKernelWithInput(group_runtime_inputs, group_to_run);
+        runKernelWithInput(std::move(group_runtime_inputs), group_to_run);
 
-    args_manager.updateWithSegmentOutputs(
-        group_to_run->outputs(), group_runtime_outputs, run_order_id);
+    segment_dataflow_plan_.storeSegmentOutputs(
+        slots, std::move(group_runtime_outputs), run_order_id);
   }
 
+  KernelArgumentHolder fusion_outputs =
+      segment_dataflow_plan_.takeFusionOutputs(slots);
+
   if (isProfilerEnabled()) {
     int64_t input_bytes = 0;
-    for (auto* inp : fusionSegments()->inputs()) {
+    for (auto&& [inp, arg] : zip(fusionSegments()->inputs(), args)) {
       if (inp->isA<TensorView>()) {
-        const auto& tensor = args_manager.checkTensorMap(inp).as<at::Tensor>();
+        const auto& tensor = arg.as<at::Tensor>();
         input_bytes += static_cast<int64_t>(tensor.storage().nbytes());
       }
     }
     FusionProfiler::inputBytesAccessed(input_bytes);
 
     int64_t output_bytes = 0;
-    for (auto* outp : fusionSegments()->outputs()) {
+    for (auto&& [outp, output] :
+         zip(fusionSegments()->outputs(), fusion_outputs)) {
       if (outp->isA<TensorView>()) {
-        const auto& tensor = args_manager.checkTensorMap(outp).as<at::Tensor>();
+        const auto& tensor = output.as<at::Tensor>();
         output_bytes += static_cast<int64_t>(tensor.storage().nbytes());
       }
     }
     FusionProfiler::outputBytesAccessed(output_bytes);
   }
 
-  return args_manager.getTensorMap();
+  return fusion_outputs;
 }
 
 KernelArgumentHolder FusionKernelRuntime::runKernelWithInput(
-    const KernelArgumentHolder& args,
+    KernelArgumentHolder args,
     SegmentedGroup* sg) {
   FUSER_PERF_SCOPE("FusionKernelRuntime::runKernelWithInput");
   std::lock_guard<std::mutex> guard(mutex_);
@@ -793,10 +939,51 @@ KernelArgumentHolder FusionKernelRuntime::runKernelWithInput(
   if (auto ke = dynamic_cast<KernelExecutor*>(ea)) {
     ke->setGroupId(group_id);
   }
-  auto outputs =
-      ExecutorDispatch::run(ea, args, {}, launch_params, compile_params);
+  return ExecutorDispatch::run(
+      ea, std::move(args), {}, launch_params, compile_params);
+}
 
-  return outputs;
+void FusionKernelRuntime::runHorizontalSegments(
+    HorizontalKernelExecutor* hke,
+    int64_t run_order_id,
+    std::vector<PolymorphicValue>& slots,
+    const KernelArgumentHolder& args) {
+  FUSER_PERF_SCOPE("FusionKernelRuntime::runHorizontalSegments");
+  std::lock_guard<std::mutex> guard(mutex_);
+  const std::vector<KernelExecutor*>& executors = hke->executors();
+
+  // Prepare all the segments before launching any, since the horizontal
+  // kernel needs the launch parameters and arguments of each.
+  std::vector<KernelArgumentHolder> segment_outputs;
+  segment_outputs.reserve(executors.size());
+  for (auto&& [i, ke] : enumerate(executors)) {
+    const int64_t segment_run_order_id = run_order_id + (int64_t)i;
+    SegmentedGroup* group =
+        runtime_workspace_.group_run_order.at(segment_run_order_id);
+    KernelArgumentHolder group_runtime_inputs =
+        segment_dataflow_plan_.segmentInputs(slots, segment_run_order_id);
+    group_runtime_inputs.setDeviceIndex(args.getDeviceIndex());
+    if (args.getCacheId().has_value()) {
+      group_runtime_inputs.setCacheId(args.getCacheId().value());
+    }
+    auto [launch_params, compile_params] =
+        getKernelConfig(group_runtime_inputs, group);
+    ke->setGroupId(group->groupId());
+    segment_outputs.push_back(ke->prepareRun(
+        std::move(group_runtime_inputs), {}, launch_params, compile_params));
+  }
+
+  if (!hke->launchPrepared()) {
+    for (KernelExecutor* ke : executors) {
+      ke->launchPrepared();
+    }
+  }
+
+  for (auto&& [i, ke] : enumerate(executors)) {
+    ke->finishRun(segment_outputs.at(i));
+    segment_dataflow_plan_.storeSegmentOutputs(
+        slots, std::move(segment_outputs.at(i)), run_order_id + (int64_t)i);
+  }
 }
 
 void FusionKernelRuntime::compileKernel(
@@ -838,6 +1025,8 @@ void FusionKernelRuntime::compileKernel(
       "Kernel index type is not defined.");
 
   if (hic != nullptr) {
+    // ForEachScheduler doesn't use chunk tables with host IR lowering.
+    NVF_ERROR(!ForEachKernelExecutor::supported(heuristic_params));
     auto ke = std::make_unique<KernelExecutor>();
     ke->setGroupId(group_id);
     ke->compile(
@@ -850,7 +1039,12 @@ void FusionKernelRuntime::compileKernel(
   } else {
     // Initialize associated executors
     executors_[group_id] = ExecutorDispatch::makeExecutor(
-        fusion_to_run.get(), fusion_id_, concrete_id_, runtime_id_, group_id);
+        fusion_to_run.get(),
+        fusion_id_,
+        concrete_id_,
+        runtime_id_,
+        group_id,
+        heuristic_params);
 
     ExecutorDispatch::compile(
         executors_.at(group_id).get(),
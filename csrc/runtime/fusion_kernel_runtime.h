@@ -15,6 +15,7 @@
 #include <runtime/executor.h>
 #include <runtime/executor_kernel_arg.h>
 #include <runtime/fusion_cache_utils.h>
+#include <runtime/horizontal_executor.h>
 
 #include <mutex>
 #include <vector>
@@ -139,23 +140,27 @@ class FusionKernelRuntime {
 
   const std::vector<std::unique_ptr<ExecutorAbstract>>& executors() const;
 
+  //! Indexed by run order id. Empty unless EnableOption::HorizontalFusion.
+  const std::vector<std::unique_ptr<HorizontalKernelExecutor>>&
+  horizontalExecutors() const {
+    return horizontal_executors_;
+  }
+
   const hir::HostIrEvaluator& getHostIrEvaluator() const {
     return *hie_.get();
   };
 
  private:
-  //! Runs each fusion segment given arguments. The outputs for a fusion are
-  //! added back to the arguments, so they can be used as inputs to successive
-  //! segments. Returns a map that links each NvFuser Val to its corresponding
-  //! tensor.
-  std::unordered_map<Val*, PolymorphicValue> runSegmentsWithInputs(
-      const KernelArgumentHolder& args);
+  //! Runs each fusion segment given arguments. The outputs of a segment are
+  //! stored in the slots of segment_dataflow_plan_, so they can be used as
+  //! inputs to successive segments. Returns the outputs of the fusion.
+  KernelArgumentHolder runSegmentsWithInputs(const KernelArgumentHolder& args);
 
   //! Interface to run a single kernel, either one kernel for single-kernel
   //! fusions, or a kernel for a segmentedGrouup in a segmented fusion. Returns
   //! the kernel outputs.
   KernelArgumentHolder runKernelWithInput(
-      const KernelArgumentHolder& args,
+      KernelArgumentHolder args,
       SegmentedGroup* sg);
 
   //! Interface to compile a single kernel. It is either a single kernel for a
@@ -166,6 +171,21 @@ class FusionKernelRuntime {
       SegmentedGroup* sg,
       hir::HostIrContainer* hic);
 
+  //! With EnableOption::HorizontalFusion, groups consecutive segments in the
+  //! run order that don't depend on each other and compiles a
+  //! HorizontalKernelExecutor for each group of at least two. A group is
+  //! bounded by the kernel parameter space and the static shared memory its
+  //! segments need together. Groups that fail to compile run separately.
+  void fuseSegmentsHorizontally();
+
+  //! Runs the segments in run order from `run_order_id` that are launched by
+  //! `hke`. Their outputs are stored in `slots`.
+  void runHorizontalSegments(
+      HorizontalKernelExecutor* hke,
+      int64_t run_order_id,
+      std::vector<PolymorphicValue>& slots,
+      const KernelArgumentHolder& args);
+
   std::pair<LaunchParams, CompileParams> getKernelConfig(
       const KernelArgumentHolder& args,
       SegmentedGroup* sg);
@@ -190,6 +210,10 @@ class FusionKernelRuntime {
   //! Executors holding compiled kernels
   std::vector<std::unique_ptr<ExecutorAbstract>> executors_;
 
+  //! Entries indexed by run order id: the horizontal kernel launching the
+  //! segments from that id on, or nullptr.
+  std::vector<std::unique_ptr<HorizontalKernelExecutor>> horizontal_executors_;
+
   //! Host IR Evaluator
   std::unique_ptr<hir::HostIrEvaluator> hie_;
 
@@ -211,6 +235,10 @@ class FusionKernelRuntime {
   //! Pre-allocated runtime workspace to speed up kernel launch preparation.
   RuntimeWorkSpace runtime_workspace_;
 
+  //! Slots of the values passed between segments, following
+  //! runtime_workspace_.
+  SegmentDataflowPlan segment_dataflow_plan_;
+
   // States for profiling support
   bool profiling_ = false;
 
@@ -0,0 +1,195 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <runtime/horizontal_executor.h>
+
+#include <codegen.h>
+#include <device_lower/utils.h>
+#include <driver_api.h>
+#include <instrumentation.h>
+#include <kernel.h>
+#include <runtime/compiled_kernel.h>
+
+#include <ATen/cuda/CUDAContext.h>
+#include <c10/core/DeviceGuard.h>
+#include <c10/cuda/CUDAStream.h>
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
+namespace nvfuser {
+
+bool HorizontalKernelExecutor::supported(const KernelExecutor* ke) {
+  if (ke == nullptr || !ke->isCompiled()) {
+    return false;
+  }
+  const kir::Kernel* kernel = ke->compiledKernel()->kernel();
+  if (kernel->topLevelExprs().empty()) {
+    return false;
+  }
+
+  const kir::KernelSummary& summary = kernel->summary();
+  if (summary.has_grid_reductions || summary.has_grid_broadcasts ||
+      summary.has_grid_welford || summary.has_cooperative_grid_reduction) {
+    return false;
+  }
+  if (summary.has_iter_grouped_reductions ||
+      summary.circular_buffer_info.hasWarpSpecialized() ||
+      kernel->hasManaged("enable_register_sharing") ||
+      kernel->hasManaged("cluster_dims")) {
+    return false;
+  }
+
+  // TMA descriptors are encoded for the grid of each launch
+  const std::vector<Expr*> exprs = kernel->exprs();
+  if (std::any_of(exprs.begin(), exprs.end(), [](Expr* expr) {
+        return ir_utils::isCpAsyncBulk(expr);
+      })) {
+    return false;
+  }
+
+  return std::all_of(
+      kernel->outputs().begin(), kernel->outputs().end(), [&](Val* output) {
+        return !output->isA<TensorView>() ||
+            kernel->getOutputAlias(output).type == AllocationType::New;
+      });
+}
+
+HorizontalKernelExecutor::HorizontalKernelExecutor(
+    std::vector<KernelExecutor*> executors,
+    int64_t fusion_id,
+    int64_t concrete_id,
+    int64_t runtime_id)
+    : executors_(std::move(executors)) {
+  NVF_ERROR(
+      executors_.size() > 1,
+      "A horizontal kernel needs at least two kernels.");
+  std::stringstream name;
+  name << "nvfuser_horizontal_f" << fusion_id << "_c" << concrete_id << "_r"
+       << runtime_id << "_g";
+  for (auto&& [i, ke] : enumerate(executors_)) {
+    NVF_ERROR(supported(ke), "Kernel can't be horizontally fused.");
+    name << (i == 0 ? "" : "_") << ke->groupId();
+  }
+  kernel_name_ = name.str();
+}
+
+void HorizontalKernelExecutor::compile() {
+  FUSER_PERF_SCOPE("HorizontalKernelExecutor::compile");
+  const CompiledKernel* first = executors_.front()->compiledKernel().get();
+  const PrimDataType index_type = first->kernel()->indexType();
+
+  std::vector<const kir::Kernel*> kernels;
+  kernels.reserve(executors_.size());
+  CompileParams compile_params = first->compileParams();
+  compile_params.index_type = index_type;
+  for (KernelExecutor* ke : executors_) {
+    const CompiledKernel* compiled_kernel = ke->compiledKernel().get();
+    NVF_ERROR_EQ(compiled_kernel->kernel()->indexType(), index_type);
+    NVF_ERROR(
+        compiled_kernel->device() == first->device(),
+        "Horizontally fused kernels must be on the same device.");
+    kernels.push_back(compiled_kernel->kernel());
+    block_size_ =
+        std::max(block_size_, compiled_kernel->blockSizeHighWaterMark());
+    compile_params.maxrregcount = std::min(
+        compile_params.maxrregcount,
+        compiled_kernel->maxrregcountHighWaterMark());
+  }
+
+  kernel_code_ = codegen::generateHorizontalCudaKernel(kernels, kernel_name_);
+
+  c10::DeviceGuard dg(first->device());
+  compiled_kernel_ = compileGeneratedCode(
+      kernel_code_, kernel_name_, index_type, compile_params, block_size_);
+
+  int size = 0;
+  NVFUSER_CUDA_SAFE_CALL(cuFuncGetAttribute(
+      &size,
+      CU_FUNC_ATTRIBUTE_MAX_DYNAMIC_SHARED_SIZE_BYTES,
+      compiled_kernel_->function));
+  available_dynamic_smem_size_ = size;
+}
+
+bool HorizontalKernelExecutor::launchPrepared() {
+  FUSER_PERF_SCOPE("HorizontalKernelExecutor::launchPrepared");
+  NVF_ERROR(isCompiled(), "The horizontal kernel is not compiled.");
+
+  const LaunchParams block = executors_.front()->lastLaunchParams();
+  int64_t num_blocks = 0;
+  int64_t smem = 0;
+  std::vector<dim3> grid_dims;
+  grid_dims.reserve(executors_.size());
+  for (KernelExecutor* ke : executors_) {
+    if (!ke->preparedRunLaunchesKernel()) {
+      return false;
+    }
+    const LaunchParams lparams = ke->lastLaunchParams();
+    if (lparams.bdimx() != block.bdimx() || lparams.bdimy() != block.bdimy() ||
+        lparams.bdimz() != block.bdimz()) {
+      return false;
+    }
+    num_blocks += lparams.nBlocks();
+    smem = std::max(smem, lparams.smem());
+    grid_dims.emplace_back(
+        (unsigned)lparams.gdimx(),
+        (unsigned)lparams.gdimy(),
+        (unsigned)lparams.gdimz());
+  }
+  if (block.nThreads() > block_size_ ||
+      num_blocks > std::numeric_limits<int32_t>::max()) {
+    return false;
+  }
+
+  const c10::Device device = executors_.front()->compiledKernel()->device();
+  c10::DeviceGuard dg(device);
+  if (smem > available_dynamic_smem_size_) {
+    int static_smem = 0;
+    NVFUSER_CUDA_SAFE_CALL(cuFuncGetAttribute(
+        &static_smem,
+        CU_FUNC_ATTRIBUTE_SHARED_SIZE_BYTES,
+        compiled_kernel_->function));
+    const auto smem_limit = static_cast<int64_t>(
+        at::cuda::getDeviceProperties(device.index())->sharedMemPerBlockOptin);
+    if (static_smem + smem >= smem_limit) {
+      return false;
+    }
+    NVFUSER_CUDA_SAFE_CALL(cuFuncSetAttribute(
+        compiled_kernel_->function,
+        CU_FUNC_ATTRIBUTE_MAX_DYNAMIC_SHARED_SIZE_BYTES,
+        smem));
+    available_dynamic_smem_size_ = smem;
+  }
+
+  // The parameters of each segment followed by its grid dimensions
+  std::vector<void*> params;
+  for (auto&& [ke, grid_dim] : zip(executors_, grid_dims)) {
+    void** segment_params = ke->preparedParamPointers();
+    const auto num_params =
+        std::ssize(ke->compiledKernel()->kernel()->parameters());
+    params.insert(params.end(), segment_params, segment_params + num_params);
+    params.push_back(&grid_dim);
+  }
+
+  auto stream = at::cuda::getCurrentCUDAStream();
+  NVFUSER_CUDA_SAFE_CALL(cuLaunchKernel(
+      compiled_kernel_->function,
+      num_blocks,
+      1,
+      1,
+      block.bdimx(),
+      block.bdimy(),
+      block.bdimz(),
+      smem,
+      stream,
+      params.data(),
+      nullptr));
+  return true;
+}
+
+} // namespace nvfuser
@@ -0,0 +1,91 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <runtime/executor.h>
+#include <runtime/executor_utils.h>
+#include <utils.h>
+#include <visibility.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace nvfuser {
+
+//! Launches the kernels of segments that don't depend on each other as one
+//! kernel. Each segment runs on its own range of blocks with its own grid
+//! dimensions, dispatched on blockIdx.x in the generated code (see
+//! codegen::generateHorizontalCudaKernel). This saves a launch per segment
+//! for segmented fusions with many small independent kernels.
+//!
+//! The segments are still run through their KernelExecutors, which compute
+//! launch parameters and arguments and allocate outputs as usual with
+//! KernelExecutor::prepareRun. Only the launch is replaced. Segments can only
+//! be launched together if they have the same block dimensions, which is
+//! checked at every launch, so launchPrepared may decline to launch them.
+class HorizontalKernelExecutor : public NonCopyable {
+ public:
+  //! Whether the kernel of `ke` can be a part of a horizontal kernel. Kernels
+  //! that assume they own the whole grid, e.g., with grid reductions, or that
+  //! need static launch parameters can't. Neither can kernels writing to
+  //! their inputs, as another segment may read them.
+  NVF_API static bool supported(const KernelExecutor* ke);
+
+  //! `executors` are compiled and supported, with the same index type. Their
+  //! segments must not depend on each other.
+  NVF_API HorizontalKernelExecutor(
+      std::vector<KernelExecutor*> executors,
+      int64_t fusion_id = 0,
+      int64_t concrete_id = 0,
+      int64_t runtime_id = 0);
+
+  NVF_API void compile();
+
+  bool isCompiled() const {
+    return compiled_kernel_ != nullptr;
+  }
+
+  const std::vector<KernelExecutor*>& executors() const {
+    return executors_;
+  }
+
+  const std::string& kernelName() const {
+    return kernel_name_;
+  }
+
+  //! Returns the generated CUDA code of the kernel
+  const std::string& kernelString() const {
+    NVF_ERROR(!kernel_code_.empty(), "Kernel code not generated");
+    return kernel_code_;
+  }
+
+  //! Launches the kernels last prepared with KernelExecutor::prepareRun as
+  //! one kernel. Returns false without launching anything if they can't be
+  //! launched together, e.g., because their block dimensions differ. Each
+  //! executor then needs to launch its own kernel.
+  NVF_API bool launchPrepared();
+
+ private:
+  std::vector<KernelExecutor*> executors_;
+
+  std::string kernel_name_;
+
+  std::string kernel_code_;
+
+  //! The number of threads per block the kernel was compiled for. Launching
+  //! with more may exceed the registers available.
+  int64_t block_size_ = 0;
+
+  std::unique_ptr<executor_utils::CudaExecutable> compiled_kernel_;
+
+  //! Dynamic shared memory the kernel is currently allowed to use
+  int64_t available_dynamic_smem_size_ = 0;
+};
+
+} // namespace nvfuser
@@ -0,0 +1,204 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <runtime/kernel_param_buffer.h>
+
+#include <exceptions.h>
+#include <ir/all_nodes.h>
+#include <utils.h>
+
+#include <cuda.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace nvfuser {
+
+namespace {
+
+// Used for parameters of unknown alignment. Their offsets don't follow the
+// kernel ABI anyway, so this only keeps their bytes aligned for the host.
+constexpr int64_t kFallbackAlignment = 16;
+
+int64_t dataTypeAlignment(const DataType& dtype, PrimDataType index_type) {
+  return std::visit(
+      [&](auto&& type) -> int64_t {
+        using T = std::decay_t<decltype(type)>;
+        if constexpr (std::is_same_v<T, PrimDataType>) {
+          // Scalars, including the complex types of runtime/complex_number.cu
+          // and runtime/fp16_support.cu, are aligned to their size.
+          return dataTypeSize(dtype, index_type);
+        } else if constexpr (std::is_same_v<T, ArrayType>) {
+          // Array<T, N> in runtime/array.cu has the alignment of T.
+          return dataTypeAlignment(*type.type, index_type);
+        } else if constexpr (std::is_same_v<T, PointerType>) {
+          return (int64_t)sizeof(void*);
+        } else if constexpr (std::is_same_v<T, StructType>) {
+          int64_t alignment = 1;
+          for (const auto& field : type.fields) {
+            if (!field.used_in_kernel) {
+              continue;
+            }
+            const int64_t field_alignment =
+                dataTypeAlignment(*field.type, index_type);
+            if (field_alignment == 0) {
+              return 0;
+            }
+            alignment = std::max(alignment, field_alignment);
+          }
+          return alignment;
+        } else if constexpr (std::is_same_v<T, OpaqueType>) {
+          return (int64_t)type.alignment;
+        } else {
+          return 0;
+        }
+      },
+      dtype.type);
+}
+
+// Copies `value` to `dst` unless it's already there. Returns whether it
+// wasn't.
+template <typename T>
+bool store(std::byte* dst, T value) {
+  if (std::memcmp(dst, &value, sizeof(T)) == 0) {
+    return false;
+  }
+  std::memcpy(dst, &value, sizeof(T));
+  return true;
+}
+
+template <typename IndexType>
+bool storeIndices(std::byte* dst, const std::vector<int64_t>& values) {
+  bool changed = false;
+  for (int64_t value : values) {
+    changed |= store(dst, (IndexType)value);
+    dst += sizeof(IndexType);
+  }
+  return changed;
+}
+
+} // namespace
+
+void KernelParamBuffer::layout(
+    const std::vector<int64_t>& sizes,
+    const std::vector<int64_t>& alignments) {
+  NVF_ERROR_EQ(sizes.size(), alignments.size());
+  offsets_.clear();
+  offsets_.reserve(sizes.size());
+  has_abi_layout_ = true;
+  int64_t offset = 0;
+  for (auto&& [size, alignment] : zip(sizes, alignments)) {
+    NVF_ERROR(size >= 0, "Negative kernel parameter size: ", size);
+    if (alignment == 0) {
+      has_abi_layout_ = false;
+    }
+    const int64_t effective_alignment =
+        alignment == 0 ? kFallbackAlignment : alignment;
+    NVF_ERROR(
+        (effective_alignment & (effective_alignment - 1)) == 0,
+        "Alignment must be a power of two: ",
+        effective_alignment);
+    offset = roundUpToMultiple(offset, effective_alignment);
+    offsets_.push_back(offset);
+    offset += size;
+  }
+  sizes_ = sizes;
+  // Value-initialized, so padding is deterministic.
+  bytes_.assign(offset, std::byte{0});
+  param_ptrs_.clear();
+  param_ptrs_.reserve(offsets_.size());
+  for (int64_t param_offset : offsets_) {
+    param_ptrs_.push_back(bytes_.data() + param_offset);
+  }
+  config_.clear();
+  laid_out_ = true;
+}
+
+bool KernelParamBuffer::patch(int64_t index, const void* src, int64_t size) {
+  NVF_ERROR_EQ(
+      size,
+      sizes_.at(index),
+      "Size of kernel parameter ",
+      index,
+      " changed since it was laid out.");
+  std::byte* dst = bytes_.data() + offsets_.at(index);
+  if (std::memcmp(dst, src, size) == 0) {
+    return false;
+  }
+  std::memcpy(dst, src, size);
+  return true;
+}
+
+bool KernelParamBuffer::patchTensor(
+    int64_t index,
+    void* data,
+    const std::vector<int64_t>& sizes,
+    const std::vector<int64_t>& strides,
+    PrimDataType index_type) {
+  NVF_ERROR_EQ(
+      tensorParamSize(std::ssize(sizes), std::ssize(strides), index_type),
+      sizes_.at(index),
+      "Rank of tensor parameter ",
+      index,
+      " changed since it was laid out.");
+  std::byte* dst = bytes_.data() + offsets_.at(index);
+  bool changed = store(dst, data);
+  dst += sizeof(void*);
+  if (index_type == PrimDataType::Int) {
+    changed |= storeIndices<int64_t>(dst, sizes);
+    dst += sizeof(int64_t) * sizes.size();
+    changed |= storeIndices<int64_t>(dst, strides);
+  } else {
+    changed |= storeIndices<int32_t>(dst, sizes);
+    dst += sizeof(int32_t) * sizes.size();
+    changed |= storeIndices<int32_t>(dst, strides);
+  }
+  return changed;
+}
+
+void** KernelParamBuffer::launchConfig() {
+  NVF_ERROR(
+      has_abi_layout_,
+      "Kernel parameters of unknown alignment can't be passed as one block.");
+  if (config_.empty()) {
+    config_size_ = bytes_.size();
+    config_ = {
+        CU_LAUNCH_PARAM_BUFFER_POINTER,
+        bytes_.data(),
+        CU_LAUNCH_PARAM_BUFFER_SIZE,
+        &config_size_,
+        CU_LAUNCH_PARAM_END};
+  }
+  return config_.data();
+}
+
+int64_t KernelParamBuffer::tensorParamSize(
+    int64_t num_sizes,
+    int64_t num_strides,
+    PrimDataType index_type) {
+  const int64_t index_size =
+      index_type == PrimDataType::Int ? sizeof(int64_t) : sizeof(int32_t);
+  // The struct is aligned like its data pointer, so its sizeof includes
+  // trailing padding, e.g., with 32-bit indices and an odd rank.
+  return roundUpToMultiple(
+      (int64_t)sizeof(void*) + index_size * (num_sizes + num_strides),
+      (int64_t)sizeof(void*));
+}
+
+int64_t KernelParamBuffer::paramAlignment(
+    const Val* param,
+    PrimDataType index_type) {
+  // A CPU scalar tensor is passed by value. See polymorphicValueToBytes.
+  if (auto* tv = dynamic_cast<const TensorView*>(param);
+      tv != nullptr && !tv->isCpuScalar()) {
+    // Tensor<T, N, M> starts with the data pointer.
+    return (int64_t)sizeof(void*);
+  }
+  return dataTypeAlignment(param->dtype(), index_type);
+}
+
+} // namespace nvfuser
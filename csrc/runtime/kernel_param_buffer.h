@@ -0,0 +1,126 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <type.h>
+#include <visibility.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nvfuser {
+
+class Val;
+
+//! The parameters of a compiled kernel packed into one contiguous block.
+//!
+//! The parameter order and the byte size of each parameter, e.g., the
+//! `Tensor<T, N, M>` struct in runtime/tensor.cu, are fixed once a kernel is
+//! compiled, so the block is laid out once and later launches overwrite
+//! only the bytes that changed, typically data pointers. Each parameter is
+//! placed at an offset aligned like the kernel ABI expects, so the block can
+//! be passed as is through CU_LAUNCH_PARAM_BUFFER_POINTER. The encoding of
+//! each parameter is the one of tensorToBytes and polymorphicValueToBytes.
+class KernelParamBuffer {
+ public:
+  //! Lays out parameters of the given sizes and alignments in order. An
+  //! alignment of 0 means it is unknown, in which case the parameter is
+  //! aligned conservatively and the block can only be passed through
+  //! pointers to each parameter. Previous contents are discarded.
+  NVF_API void layout(
+      const std::vector<int64_t>& sizes,
+      const std::vector<int64_t>& alignments);
+
+  bool isLaidOut() const {
+    return laid_out_;
+  }
+
+  int64_t numParams() const {
+    return std::ssize(offsets_);
+  }
+
+  int64_t offset(int64_t index) const {
+    return offsets_.at(index);
+  }
+
+  int64_t paramSize(int64_t index) const {
+    return sizes_.at(index);
+  }
+
+  //! Total size of the block, including padding.
+  int64_t size() const {
+    return std::ssize(bytes_);
+  }
+
+  //! Whether every parameter is at its kernel ABI offset, so the block can
+  //! be passed through CU_LAUNCH_PARAM_BUFFER_POINTER.
+  bool hasAbiLayout() const {
+    return has_abi_layout_;
+  }
+
+  const std::byte* data() const {
+    return bytes_.data();
+  }
+
+  //! The bytes of parameter `index`.
+  const std::byte* param(int64_t index) const {
+    return bytes_.data() + offsets_.at(index);
+  }
+
+  //! Overwrites parameter `index` with `size` bytes at `src`, which must be
+  //! the size it was laid out with. Returns whether any byte changed.
+  NVF_API bool patch(int64_t index, const void* src, int64_t size);
+
+  //! Overwrites parameter `index`, a `Tensor<T, N, M>` struct, with the
+  //! data pointer, sizes and strides given, in the encoding of tensorToBytes
+  //! but without building an intermediate byte vector. Returns whether any
+  //! byte changed.
+  NVF_API bool patchTensor(
+      int64_t index,
+      void* data,
+      const std::vector<int64_t>& sizes,
+      const std::vector<int64_t>& strides,
+      PrimDataType index_type);
+
+  //! Pointers to each parameter, in the form of the `kernelParams` argument
+  //! of cuLaunchKernel. Valid until the next layout().
+  void** paramPointers() {
+    return param_ptrs_.data();
+  }
+
+  //! The `extra` argument of cuLaunchKernel passing the whole block. Only
+  //! valid if hasAbiLayout(), and until the next layout().
+  NVF_API void** launchConfig();
+
+  //! Byte size of a `Tensor<T, N, M>` struct with `num_sizes` sizes and
+  //! `num_strides` strides, i.e., its sizeof including trailing padding.
+  static int64_t tensorParamSize(
+      int64_t num_sizes,
+      int64_t num_strides,
+      PrimDataType index_type);
+
+  //! Alignment of the kernel parameter `param` as declared in the kernel
+  //! signature, or 0 if it is unknown.
+  NVF_API static int64_t paramAlignment(
+      const Val* param,
+      PrimDataType index_type);
+
+ private:
+  std::vector<std::byte> bytes_;
+  std::vector<int64_t> offsets_;
+  std::vector<int64_t> sizes_;
+  std::vector<void*> param_ptrs_;
+  bool has_abi_layout_ = false;
+  bool laid_out_ = false;
+  // Storage for launchConfig().
+  size_t config_size_ = 0;
+  std::vector<void*> config_;
+};
+
+} // namespace nvfuser
@@ -0,0 +1,126 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <runtime/shape_bucketing.h>
+
+#include <algorithm>
+#include <ostream>
+#include <string>
+
+#include <exceptions.h>
+#include <options.h>
+
+namespace nvfuser {
+
+namespace {
+
+// Alignment in bytes assumed by the widest vectorized access.
+constexpr int64_t kAlignmentBytes = 16;
+
+int64_t nextPowerOfTwo(int64_t x) {
+  int64_t p = 1;
+  while (p < x) {
+    p <<= 1;
+  }
+  return p;
+}
+
+} // namespace
+
+ShapeBucketing::ShapeBucketing(std::vector<int64_t> boundaries)
+    : boundaries_(std::move(boundaries)) {
+  NVF_CHECK(
+      std::is_sorted(boundaries_.begin(), boundaries_.end()) &&
+          std::adjacent_find(boundaries_.begin(), boundaries_.end()) ==
+              boundaries_.end(),
+      "Shape bucket boundaries must be strictly increasing.");
+  NVF_CHECK(
+      boundaries_.empty() || boundaries_.front() > 0,
+      "Shape bucket boundaries must be positive.");
+}
+
+std::optional<ShapeBucketing> ShapeBucketing::fromOptions() {
+  if (!isOptionEnabled(EnableOption::ShapeBucketing)) {
+    return std::nullopt;
+  }
+  std::vector<int64_t> boundaries;
+  for (const std::string& arg :
+       getEnableOptionArguments(EnableOption::ShapeBucketing)) {
+    try {
+      boundaries.push_back(std::stoll(arg));
+    } catch (const std::exception&) {
+      NVF_THROW("Invalid shape bucket boundary: ", arg);
+    }
+  }
+  return ShapeBucketing(std::move(boundaries));
+}
+
+int64_t ShapeBucketing::bucket(int64_t extent) const {
+  if (extent <= 1) {
+    return extent;
+  }
+  if (boundaries_.empty()) {
+    return nextPowerOfTwo(extent);
+  }
+  auto it = std::lower_bound(boundaries_.begin(), boundaries_.end(), extent);
+  return it == boundaries_.end() ? extent : *it;
+}
+
+int64_t ShapeBucketing::representative(int64_t extent) const {
+  const int64_t upper = bucket(extent);
+  return upper - (upper - extent) % kMaxVectorizationElements;
+}
+
+std::optional<KernelArgumentHolder> ShapeBucketing::bucketArgs(
+    const KernelArgumentHolder& args) const {
+  KernelArgumentHolder bucketed;
+  for (const PolymorphicValue& arg : args) {
+    if (!arg.is<at::Tensor>()) {
+      bucketed.push(arg);
+      continue;
+    }
+    const at::Tensor& tensor = arg.as<at::Tensor>();
+    // CPU scalars are passed by value and have no shape to bucket.
+    if (tensor.is_cpu() && tensor.dim() == 0) {
+      bucketed.push(arg);
+      continue;
+    }
+    if (!tensor.is_contiguous()) {
+      return std::nullopt;
+    }
+    if (!tensor.is_meta() &&
+        reinterpret_cast<uintptr_t>(tensor.data_ptr()) % kAlignmentBytes !=
+            0) {
+      return std::nullopt;
+    }
+
+    std::vector<int64_t> sizes;
+    sizes.reserve(tensor.dim());
+    for (int64_t size : tensor.sizes()) {
+      sizes.push_back(representative(size));
+    }
+    std::vector<int64_t> strides(sizes.size());
+    int64_t stride = 1;
+    for (int64_t i = std::ssize(sizes) - 1; i >= 0; i--) {
+      strides[i] = stride;
+      stride *= std::max<int64_t>(sizes[i], 1);
+    }
+    bucketed.pushTensorProxy(sizes, strides, tensor.scalar_type());
+  }
+  bucketed.setDeviceIndex(args.getDeviceIndex());
+  return bucketed;
+}
+
+std::ostream& operator<<(std::ostream& os, const ShapeBucketingStats& stats) {
+  os << "ShapeBucketingStats{bucketed_lookups=" << stats.bucketed_lookups
+     << ", reused_runtimes=" << stats.reused_runtimes
+     << ", compiles_avoided=" << stats.compiles_avoided
+     << ", new_runtimes=" << stats.new_runtimes << "}";
+  return os;
+}
+
+} // namespace nvfuser
@@ -0,0 +1,85 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <vector>
+
+#include <runtime/executor_kernel_arg.h>
+#include <visibility.h>
+
+namespace nvfuser {
+
+// Rounds input extents up to buckets so that FusionExecutorCache computes
+// heuristics once per bucket instead of once per shape. This cuts
+// recompilations when an extent, e.g., a sequence length, takes many values.
+//
+// By default, buckets are powers of two. With user-provided boundaries
+// b_0 < b_1 < ..., extent e falls into the smallest b_i >= e, and extents
+// larger than the last boundary are not bucketed.
+//
+// An extent isn't replaced by its bucket's upper bound directly. Heuristics
+// pick vectorization factors from the divisibility of extents, so a shape
+// must be scheduled like a bucketed shape that is just as divisible. The
+// representative of e is therefore the largest value in e's bucket that is
+// congruent to e modulo kMaxVectorizationElements. All kernels scheduled for
+// a representative are valid for every smaller extent mapped to it, because
+// generated kernels predicate out-of-bound accesses.
+class ShapeBucketing {
+ public:
+  // Largest vectorization factor in elements, i.e., 16 bytes of 1-byte
+  // elements.
+  static constexpr int64_t kMaxVectorizationElements = 16;
+
+  // Power-of-two buckets.
+  ShapeBucketing() = default;
+
+  NVF_API explicit ShapeBucketing(std::vector<int64_t> boundaries);
+
+  // Returns the policy requested with NVFUSER_ENABLE=shape_bucketing, or
+  // shape_bucketing(b_0,b_1,...) for user-provided boundaries, or
+  // std::nullopt if bucketing isn't enabled.
+  NVF_API static std::optional<ShapeBucketing> fromOptions();
+
+  // Returns the upper bound of the bucket `extent` falls into.
+  NVF_API int64_t bucket(int64_t extent) const;
+
+  // Returns the extent that heuristics are computed for in place of
+  // `extent`. See the class comment.
+  NVF_API int64_t representative(int64_t extent) const;
+
+  // Returns `args` with every tensor replaced by a meta tensor of the
+  // representative shape, to be used for computing heuristics. Returns
+  // std::nullopt if `args` can't be bucketed safely, i.e., some tensor isn't
+  // contiguous or its data isn't aligned to the largest vectorization width.
+  NVF_API std::optional<KernelArgumentHolder> bucketArgs(
+      const KernelArgumentHolder& args) const;
+
+ private:
+  // Empty for power-of-two buckets.
+  std::vector<int64_t> boundaries_;
+};
+
+struct ShapeBucketingStats {
+  // Runtime lookups that used bucketed shapes.
+  int64_t bucketed_lookups = 0;
+  // Bucketed lookups that reused an existing FusionKernelRuntime.
+  int64_t reused_runtimes = 0;
+  // Reused runtimes that would have been recompiled without bucketing.
+  // Telling them apart takes another heuristics lookup with the actual
+  // shapes, so this is only counted with NVFUSER_DUMP=shape_bucketing.
+  int64_t compiles_avoided = 0;
+  // Bucketed lookups that had to create a new FusionKernelRuntime.
+  int64_t new_runtimes = 0;
+};
+
+std::ostream& operator<<(std::ostream& os, const ShapeBucketingStats& stats);
+
+} // namespace nvfuser
@@ -0,0 +1,416 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <scheduler/cost_model.h>
+
+#include <expr_evaluator.h>
+#include <fusion.h>
+#include <ir/interface_nodes.h>
+#include <ir/utils.h>
+#include <scheduler/heuristic_plugin.h>
+#include <scheduler/pointwise_heuristic.h>
+#include <scheduler/reduction_heuristic.h>
+#include <scheduler/registry.h>
+#include <scheduler/runtime_info.h>
+#include <utils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+namespace nvfuser {
+
+namespace cost_model {
+
+namespace {
+
+// Registers every thread needs regardless of how much data it keeps live,
+// e.g., for indices and predicates.
+constexpr int64_t kBaseRegistersPerThread = 24;
+constexpr int64_t kMaxRegistersPerThread = 255;
+// Streaming kernels saturate DRAM bandwidth at about half occupancy.
+constexpr double kOccupancyToSaturateBandwidth = 0.5;
+// Used when the target device doesn't specify its bandwidth. Only ratios of
+// predicted times are meaningful then.
+constexpr double kDefaultMemoryBandwidth = 1e12;
+
+int64_t bytesOf(
+    const std::vector<Val*>& vals,
+    SchedulerRuntimeInfo& runtime_info) {
+  int64_t bytes = 0;
+  for (auto* tv : ir_utils::filterByType<TensorView>(vals)) {
+    int64_t numel = 1;
+    for (IterDomain* id : TensorDomain::noReductions(tv->getLogicalDomain())) {
+      // Expanded dimensions have a zero stride and don't add traffic.
+      if (id->isBroadcast()) {
+        continue;
+      }
+      PolymorphicValue extent =
+          runtime_info.expressionEvaluator().evaluate(id->extent());
+      if (extent.hasValue()) {
+        numel *= extent.as<int64_t>();
+      }
+    }
+    bytes += numel *
+        (int64_t)dataTypeSize(tv->dtype(), runtime_info.getIndexType());
+  }
+  return bytes;
+}
+
+int64_t product(const NvfHeuristicProblem& problem) {
+  int64_t numel = 1;
+  for (int32_t i = 0; i < problem.num_dims; i++) {
+    numel *= problem.extents[i];
+  }
+  return numel;
+}
+
+int64_t boundOr(const LaunchParams& lparams, ParallelType pt, int64_t value) {
+  return lparams.hasDim(pt) ? lparams.getDim(pt) : value;
+}
+
+// The overrides rankCandidates tries. Most combinations don't apply to a
+// given scheduler and are rejected by validation.
+std::vector<NvfHeuristicOverrides> enumerateOverrides(
+    const NvfHeuristicProblem& problem) {
+  std::vector<int32_t> vectorization_factors;
+  for (int32_t v = 1; v <= std::max(problem.max_vectorization_factor, 1);
+       v *= 2) {
+    vectorization_factors.push_back(v);
+  }
+  const std::vector<int32_t> unroll_factors = {1, 2, 4, 8};
+
+  std::vector<NvfHeuristicOverrides> all_overrides;
+  const auto add = [&](uint32_t fields,
+                       int32_t vectorization,
+                       int32_t unroll_inner,
+                       int32_t unroll_outer,
+                       int32_t unroll_iter_dom) {
+    NvfHeuristicOverrides overrides = {};
+    overrides.struct_size = sizeof(NvfHeuristicOverrides);
+    overrides.fields = fields;
+    overrides.vectorization_factor = vectorization;
+    overrides.unroll_factor_inner = unroll_inner;
+    overrides.unroll_factor_outer = unroll_outer;
+    overrides.unroll_factor_iter_dom = unroll_iter_dom;
+    all_overrides.push_back(overrides);
+  };
+
+  for (int32_t v : vectorization_factors) {
+    for (int32_t inner : unroll_factors) {
+      for (int32_t outer : unroll_factors) {
+        add(NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR |
+                NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_INNER |
+                NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_OUTER,
+            v,
+            inner,
+            outer,
+            1);
+        add(NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR |
+                NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_INNER,
+            v,
+            inner,
+            1,
+            1);
+        add(NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR |
+                NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_OUTER |
+                NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_ITER_DOM,
+            v,
+            1,
+            outer,
+            inner);
+        add(NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR |
+                NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_ITER_DOM,
+            v,
+            1,
+            1,
+            inner);
+      }
+    }
+  }
+  for (int32_t unroll : unroll_factors) {
+    add(NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_ITER_DOM, 1, 1, 1, unroll);
+  }
+  return all_overrides;
+}
+
+} // namespace
+
+std::optional<SegmentDescription> describeSegment(
+    SchedulerType scheduler_type,
+    Fusion* fusion,
+    SchedulerRuntimeInfo& runtime_info,
+    HeuristicDataCache* data_cache) {
+  switch (scheduler_type) {
+    case SchedulerType::PointWise:
+    case SchedulerType::Reduction:
+    case SchedulerType::InnerPersistent:
+    case SchedulerType::OuterPersistent:
+      break;
+    case SchedulerType::InnerOuterPersistent:
+      // Its heuristics don't consult heuristic plugins, and its kernels, a
+      // persistent inner reduction followed by a grid outer reduction, don't
+      // fit the single-pass model of estimateCost.
+      return std::nullopt;
+    default:
+      return std::nullopt;
+  }
+
+  SegmentDescription segment;
+  bool described = false;
+  {
+    heuristic_plugin::HeuristicPluginGuard recorder(
+        [&](const NvfHeuristicProblem& problem, NvfHeuristicOverrides&) {
+          segment.problem = problem;
+          described = true;
+          return false;
+        });
+    SchedulerEntry::makeSchedulerInstance(scheduler_type)
+        ->computeHeuristics(fusion, runtime_info, data_cache);
+  }
+  if (!described) {
+    return std::nullopt;
+  }
+  segment.bytes_read = bytesOf(fusion->inputs(), runtime_info);
+  segment.bytes_written = bytesOf(fusion->outputs(), runtime_info);
+  return segment;
+}
+
+std::string KernelCostEstimate::toString() const {
+  std::stringstream ss;
+  ss << "threads/block=" << threads_per_block << " blocks=" << blocks
+     << " regs/thread=" << registers_per_thread << (spills ? " (spills)" : "")
+     << " smem/block=" << smem_per_block << " blocks/SM=" << blocks_per_sm
+     << " occupancy=" << occupancy << " waves=" << waves
+     << " bytes=" << bytes_moved
+     << " vectorization_efficiency=" << vectorization_efficiency
+     << " time=" << time_us << "us";
+  return ss.str();
+}
+
+KernelCostEstimate estimateCost(
+    const HeuristicParams& params,
+    const SegmentDescription& segment,
+    const TargetDevice& target) {
+  const NvfHeuristicProblem& problem = segment.problem;
+  const int64_t dtype_size = std::max<int64_t>(problem.max_dtype_size, 1);
+  const int64_t num_tensors =
+      std::max<int64_t>(problem.num_inputs + problem.num_outputs, 1);
+
+  KernelCostEstimate cost;
+  int64_t vectorization = 1;
+  int64_t elements_per_thread = 1;
+  int64_t work = product(problem);
+  int64_t threads = 0;
+  int64_t persistent_registers = 0;
+
+  if (auto* pparams = dynamic_cast<const PointwiseParams*>(&params)) {
+    vectorization = pparams->vectorization_factor;
+    elements_per_thread = pparams->vectorization_factor *
+        pparams->unroll_factor_inner * pparams->unroll_factor_outer;
+    // The pointwise scheduler uses 128 threads unless it binds otherwise.
+    threads = boundOr(pparams->lparams, ParallelType::TIDx, 128) *
+        pparams->lparams.bdimy();
+  } else if (auto* rparams = dynamic_cast<const ReductionParams*>(&params)) {
+    work = problem.total_reduction_numel * problem.total_iteration_numel;
+    vectorization = rparams->vectorize_inner_reduction
+        ? rparams->unroll_factor_inner_reduction
+        : (rparams->vectorize_iter_dom ? rparams->unroll_factor_iter_dom : 1);
+    elements_per_thread = rparams->unroll_factor_inner_reduction *
+        rparams->unroll_factor_top_of_vectorization *
+        rparams->unroll_factor_iter_dom *
+        rparams->unroll_factor_outer_reduction;
+    if (rparams->persistent_kernel) {
+      elements_per_thread *= rparams->batches_per_block_inner_reduction *
+          rparams->batches_per_block_outer_reduction;
+    }
+
+    // Persistent schedules leave TIDx to be inferred from the extent it
+    // parallelizes.
+    const int64_t x_extent = rparams->fastest_dim
+        ? ceilDiv(
+              problem.total_reduction_numel,
+              rparams->unroll_factor_inner_reduction *
+                  rparams->batches_per_block_inner_reduction)
+        : ceilDiv(
+              problem.total_iteration_numel, rparams->unroll_factor_iter_dom);
+    const int64_t bdimx = boundOr(
+        rparams->lparams,
+        ParallelType::TIDx,
+        std::min(
+            roundUpToMultiple(x_extent, target.warp_size),
+            target.max_threads_per_block));
+    threads = bdimx * rparams->lparams.bdimy() * rparams->lparams.bdimz();
+
+    if (rparams->persistent_kernel) {
+      if (!rparams->smem_persistent_buffers.empty()) {
+        cost.smem_per_block =
+            problem.persistent_buffer_bytes * rparams->lparams.bdimy();
+      } else {
+        // The persistent buffer of a reduction is spread over the threads
+        // that cooperate on it.
+        persistent_registers =
+            ceilDiv(problem.persistent_buffer_bytes, bdimx * 4);
+      }
+    }
+  } else {
+    NVF_THROW("The cost model doesn't support ", params.scheduler_type);
+  }
+
+  threads = std::clamp<int64_t>(threads, 1, target.max_threads_per_block);
+  cost.threads_per_block = threads;
+  cost.blocks =
+      std::max<int64_t>(ceilDiv(work, threads * elements_per_thread), 1);
+
+  const int64_t registers = kBaseRegistersPerThread +
+      ceilDiv(elements_per_thread * dtype_size * num_tensors, 4) +
+      persistent_registers;
+  cost.spills = registers > kMaxRegistersPerThread;
+  cost.registers_per_thread = std::min(registers, kMaxRegistersPerThread);
+
+  const int64_t warp_threads = roundUpToMultiple(threads, target.warp_size);
+  int64_t blocks_per_sm = std::min(
+      target.max_blocks_per_multi_processor,
+      target.max_threads_per_multi_processor / warp_threads);
+  blocks_per_sm = std::min(
+      blocks_per_sm,
+      target.regs_per_multiprocessor /
+          (roundUpToMultiple(cost.registers_per_thread, 8) * warp_threads));
+  if (cost.smem_per_block > 0) {
+    blocks_per_sm = std::min(
+        blocks_per_sm,
+        target.shared_mem_per_multiprocessor /
+            (cost.smem_per_block + target.reserved_shared_mem_per_block));
+    if (cost.smem_per_block > target.shared_mem_per_block_optin) {
+      blocks_per_sm = 0;
+    }
+  }
+  cost.blocks_per_sm = blocks_per_sm;
+  cost.occupancy = std::min(
+      1.0,
+      (double)(blocks_per_sm * warp_threads) /
+          (double)target.max_threads_per_multi_processor);
+
+  cost.bytes_moved = segment.bytes_read + segment.bytes_written;
+  if (auto* rparams = dynamic_cast<const ReductionParams*>(&params)) {
+    // Grid reductions write and read back a partial result per thread.
+    if (rparams->cross_grid_inner_reduction ||
+        rparams->cross_grid_outer_reduction) {
+      cost.bytes_moved += 2 * cost.blocks * threads * dtype_size;
+    }
+  }
+  cost.vectorization_efficiency = std::min(
+      1.0, (double)(vectorization * dtype_size) / 16.0);
+
+  if (blocks_per_sm == 0) {
+    cost.waves = std::numeric_limits<double>::infinity();
+    cost.time_us = std::numeric_limits<double>::infinity();
+    return cost;
+  }
+  cost.waves = (double)cost.blocks /
+      (double)(blocks_per_sm * target.multi_processor_count);
+
+  const double bandwidth = target.memory_bandwidth > 0.0
+      ? target.memory_bandwidth
+      : kDefaultMemoryBandwidth;
+  const double latency_hiding =
+      std::min(1.0, cost.occupancy / kOccupancyToSaturateBandwidth);
+  const double access_efficiency = 0.5 + 0.5 * cost.vectorization_efficiency;
+  // A partial last wave, or a grid smaller than one wave, leaves SMs idle.
+  const double tail = std::ceil(cost.waves) / cost.waves;
+  cost.time_us = (double)cost.bytes_moved /
+      (bandwidth * latency_hiding * access_efficiency) * tail * 1e6;
+  if (cost.spills) {
+    cost.time_us *= 2.0;
+  }
+  return cost;
+}
+
+std::vector<Candidate> rankCandidates(
+    const HeuristicParams& baseline,
+    const SegmentDescription& segment,
+    const TargetDevice& target,
+    int64_t k) {
+  std::vector<Candidate> candidates;
+  candidates.push_back(
+      {baseline.clone(), {}, estimateCost(baseline, segment, target)});
+
+  for (const NvfHeuristicOverrides& overrides :
+       enumerateOverrides(segment.problem)) {
+    std::unique_ptr<HeuristicParams> params = baseline.clone();
+    bool applied = false;
+    {
+      heuristic_plugin::HeuristicPluginGuard plugin(
+          [&overrides](const NvfHeuristicProblem&, NvfHeuristicOverrides& out) {
+            out = overrides;
+            return true;
+          });
+      if (auto* pparams = dynamic_cast<PointwiseParams*>(params.get())) {
+        applied = heuristic_plugin::updatePointwiseParams(
+            pparams, segment.problem);
+      } else if (auto* rparams = dynamic_cast<ReductionParams*>(params.get())) {
+        applied = heuristic_plugin::updateReductionParams(
+            rparams, segment.problem);
+      }
+    }
+    if (!applied) {
+      continue;
+    }
+    const bool seen = std::any_of(
+        candidates.begin(), candidates.end(), [&](const Candidate& c) {
+          return c.params->sameAs(params.get());
+        });
+    if (seen) {
+      continue;
+    }
+    KernelCostEstimate cost = estimateCost(*params, segment, target);
+    candidates.push_back({std::move(params), overrides, cost});
+  }
+
+  std::stable_sort(
+      candidates.begin(),
+      candidates.end(),
+      [](const Candidate& a, const Candidate& b) {
+        return a.cost.time_us < b.cost.time_us;
+      });
+  if (std::ssize(candidates) > k) {
+    candidates.resize(k);
+  }
+  return candidates;
+}
+
+void dumpCandidates(
+    std::ostream& os,
+    Fusion* fusion,
+    SchedulerRuntimeInfo& runtime_info,
+    const HeuristicParams& params,
+    int64_t k) {
+  os << "===== Heuristic candidates (" << params.scheduler_type
+     << ") ========\n";
+  std::optional<SegmentDescription> segment =
+      describeSegment(params.scheduler_type, fusion, runtime_info);
+  if (!segment.has_value()) {
+    os << "not supported by the cost model\n";
+    return;
+  }
+  const TargetDevice target = currentTargetDevice();
+  os << "heuristic: " << estimateCost(params, *segment, target).toString()
+     << "\n";
+  int64_t rank = 0;
+  for (const Candidate& candidate :
+       rankCandidates(params, *segment, target, k)) {
+    os << "#" << ++rank << " "
+       << heuristic_plugin::TableHeuristicPlugin::formatEntry(
+              segment->problem, candidate.overrides)
+       << "\n    " << candidate.cost.toString() << "\n";
+  }
+}
+
+} // namespace cost_model
+
+} // namespace nvfuser
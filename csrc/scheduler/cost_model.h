@@ -0,0 +1,118 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <scheduler/heuristic.h>
+#include <scheduler/heuristic_plugin_api.h>
+#include <target_device.h>
+#include <visibility.h>
+
+#include <iosfwd>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace nvfuser {
+
+class Fusion;
+class HeuristicDataCache;
+class SchedulerRuntimeInfo;
+
+// An analytic cost model of the kernels the pointwise, reduction and
+// persistent schedulers generate. Given HeuristicParams, the segment they were
+// computed for and a TargetDevice, it estimates occupancy, waves, bytes moved,
+// vectorization efficiency and register and shared memory pressure, and
+// combines them into a predicted time for a memory-bound kernel.
+//
+// The model is meant to rank alternative parameters for the same segment, not
+// to predict wall-clock time. It runs entirely on the host, so a tuner can
+// enumerate and rank candidates for a device that isn't present and deploy
+// the winners through TableHeuristicPlugin.
+namespace cost_model {
+
+// What the cost model needs to know about a segment. `problem` is what the
+// scheduler describes to heuristic plugins. See heuristic_plugin_api.h.
+struct SegmentDescription {
+  NvfHeuristicProblem problem = {};
+  // Bytes of fusion inputs read and fusion outputs written, each once.
+  int64_t bytes_read = 0;
+  int64_t bytes_written = 0;
+};
+
+// Describes the segment `fusion` for `scheduler_type` by computing its
+// heuristics while recording what they describe to heuristic plugins. Returns
+// std::nullopt for schedulers the cost model doesn't support, i.e., all but
+// the pointwise, reduction, inner persistent and outer persistent ones.
+NVF_API std::optional<SegmentDescription> describeSegment(
+    SchedulerType scheduler_type,
+    Fusion* fusion,
+    SchedulerRuntimeInfo& runtime_info,
+    HeuristicDataCache* data_cache = nullptr);
+
+struct KernelCostEstimate {
+  int64_t threads_per_block = 0;
+  int64_t blocks = 0;
+  // Register usage is estimated from the number of elements each thread keeps
+  // live. Above the hardware limit, the kernel spills.
+  int64_t registers_per_thread = 0;
+  bool spills = false;
+  int64_t smem_per_block = 0;
+  int64_t blocks_per_sm = 0;
+  // Resident warps over the maximum resident warps of an SM.
+  double occupancy = 0.0;
+  double waves = 0.0;
+  int64_t bytes_moved = 0;
+  // Fraction of a 16-byte access each global memory instruction uses.
+  double vectorization_efficiency = 0.0;
+  // Infinite if the kernel can't be launched, e.g., because it needs more
+  // shared memory than an SM has.
+  double time_us = 0.0;
+
+  std::string toString() const;
+};
+
+// Estimates the cost of running `params` on `segment`. `params` must be
+// PointwiseParams or ReductionParams.
+NVF_API KernelCostEstimate estimateCost(
+    const HeuristicParams& params,
+    const SegmentDescription& segment,
+    const TargetDevice& target);
+
+struct Candidate {
+  std::unique_ptr<HeuristicParams> params;
+  // The overrides that turn the heuristic's parameters into `params`. No
+  // fields are set for the heuristic's own choice.
+  NvfHeuristicOverrides overrides = {};
+  KernelCostEstimate cost;
+};
+
+// Enumerates the parameters reachable from `baseline` through the overrides
+// heuristic plugins may return, including `baseline` itself, and returns the
+// `k` with the lowest predicted time, cheapest first. Overrides are validated
+// like a plugin's, so every candidate is legal for `segment`.
+NVF_API std::vector<Candidate> rankCandidates(
+    const HeuristicParams& baseline,
+    const SegmentDescription& segment,
+    const TargetDevice& target,
+    int64_t k);
+
+// Prints the predicted cost of `params` and the top `k` candidates for the
+// segment `fusion`, each with the TableHeuristicPlugin entry that selects it.
+// Used by DebugDumpOption::HeuristicCandidates. For schedulers the cost model
+// doesn't support, e.g., InnerOuterPersistent, prints that instead.
+void dumpCandidates(
+    std::ostream& os,
+    Fusion* fusion,
+    SchedulerRuntimeInfo& runtime_info,
+    const HeuristicParams& params,
+    int64_t k);
+
+} // namespace cost_model
+
+} // namespace nvfuser
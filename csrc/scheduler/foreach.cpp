@@ -0,0 +1,302 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <debug.h>
+#include <instrumentation.h>
+#include <ir/utils.h>
+#include <options.h>
+#include <runtime/executor_kernel_arg.h>
+#include <scheduler/debug_utils.h>
+#include <scheduler/foreach.h>
+#include <scheduler/foreach_heuristic.h>
+#include <scheduler/foreach_utils.h>
+#include <scheduler/mark_aliases.h>
+#include <scheduler/runtime_info.h>
+#include <scheduler/tools/inlining.h>
+#include <scheduler/utils.h>
+#include <scheduler/vectorize_helper.h>
+#include <transform_replay.h>
+
+#include <algorithm>
+#include <memory>
+
+namespace nvfuser {
+
+namespace {
+
+// The bytes the inputs and outputs of `fusion` take as kernel parameters of
+// their own
+int64_t parameterBytes(Fusion* fusion, PrimDataType index_type) {
+  int64_t parameter_bytes = 0;
+  for (Val* val : fusion->inputs()) {
+    parameter_bytes += kernelParameterBytes(val, index_type);
+  }
+  for (Val* val : fusion->outputs()) {
+    parameter_bytes += kernelParameterBytes(val, index_type);
+  }
+  return parameter_bytes;
+}
+
+// A chunk table views every tensor as 1D and contiguous, see
+// foreach_utils::makeChunkFusion. Outputs are allocated contiguous, so only
+// inputs need to be checked.
+bool supportsChunkTable(Fusion* fusion) {
+  return std::ranges::all_of(fusion->allTvs(), [](TensorView* tv) {
+    if (tv->hasAllocation()) {
+      return false;
+    }
+    if (!tv->isFusionInput()) {
+      return true;
+    }
+    return !tv->isFusionOutput() && !tv->isCpuScalar() &&
+        std::ranges::all_of(
+               tv->getContiguity(),
+               [](const std::optional<bool>& contiguity) {
+                 return contiguity.value_or(false);
+               });
+  });
+}
+
+// Splits each group evenly over `num_blocks` blocks. See ForEachScheduler.
+void scheduleGroups(
+    Fusion* fusion,
+    const ForEachParams* params,
+    int64_t num_blocks) {
+  scheduler_utils::clearMemorySpace(fusion);
+
+  scheduler_utils::cacheInputs(fusion, true);
+  scheduler_utils::cacheAndForkOutputs(fusion, true);
+
+  const int64_t vec_factor = params->vectorization_factor;
+
+  // The caches are in the groups of the tensors they cache, so the groups
+  // are the same as before caching.
+  for (const foreach_utils::ForEachGroup& group :
+       foreach_utils::getForEachGroups(fusion)) {
+    TensorView* ref_tv = group.reference;
+
+    ref_tv->flatten();
+    ref_tv->split(0, vec_factor);
+    ref_tv->split(0, params->bdimx);
+    ref_tv->split(0, num_blocks, /*inner_split=*/false);
+    // [num_blocks(BIDx), I/vec/bdimx/num_blocks, bdimx(TIDx), vec]
+    ref_tv->axis(0)->parallelize(ParallelType::BIDx);
+    ref_tv->axis(2)->parallelize(ParallelType::TIDx);
+
+    // The groups aren't connected, so this stays within the group.
+    TransformPropagator propagator(ref_tv);
+    MaxLogicalDomainInfoSpanningTree(ref_tv).traverse(&propagator);
+    scheduler_utils::parallelizeAllLike(ref_tv, group.tvs);
+
+    if (vec_factor > 1) {
+      for (TensorView* tv :
+           scheduler_utils::getInputsOutputsWithInnerDim(ref_tv, true, true)) {
+        if (tv->isFusionInput()) {
+          for (TensorView* consumer_tv : ir_utils::consumerTvsOf(tv)) {
+            consumer_tv->axis(-1)->parallelize(ParallelType::Vectorize);
+          }
+        } else {
+          tv->axis(-1)->parallelize(ParallelType::Vectorize);
+        }
+      }
+    }
+  }
+
+  inlineMost();
+}
+
+} // namespace
+
+bool ForEachScheduler::canScheduleCompileTime(Fusion* fusion) {
+  if (!isOptionEnabled(EnableOption::ForEachScheduler)) {
+    scheduler_debug_utils::canScheduleRejectReason(
+        schedulerType(), "Not enabled");
+    return false;
+  }
+
+  if (scheduler_utils::isResharding(fusion)) {
+    scheduler_debug_utils::canScheduleRejectReason(
+        schedulerType(), "Fusion is resharding.");
+    return false;
+  }
+
+  if (std::any_of(
+          fusion->outputs().begin(), fusion->outputs().end(), [](Val* out) {
+            return !out->isA<TensorView>();
+          })) {
+    scheduler_debug_utils::canScheduleRejectReason(
+        schedulerType(), "Only tensor outputs are supported");
+    return false;
+  }
+
+  // Past the parameter limit, the tensors are read from a chunk table
+  // instead. Without a runtime index type, assume 64-bit indices, which take
+  // the most parameter space.
+  if (parameterBytes(fusion, PrimDataType::Int) > kMaxKernelParameterBytes) {
+    if (isOptionEnabled(EnableOption::HostIrLowering)) {
+      scheduler_debug_utils::canScheduleRejectReason(
+          schedulerType(),
+          "Too many kernel parameters, and chunk tables aren't supported "
+          "with host IR lowering");
+      return false;
+    }
+    if (!supportsChunkTable(fusion)) {
+      scheduler_debug_utils::canScheduleRejectReason(
+          schedulerType(),
+          "Too many kernel parameters, and the tensors can't be read from a "
+          "chunk table");
+      return false;
+    }
+  }
+
+  // Scalar exprs, e.g., computing a step size, can be shared by the groups.
+  for (Expr* expr : fusion->exprs()) {
+    if (!ir_utils::filterByType<TensorView>(expr->outputs()).empty() &&
+        !ir_utils::isPointwiseTvOp(expr)) {
+      scheduler_debug_utils::canScheduleRejectReason(
+          schedulerType(),
+          "Only pointwise ops are supported: ",
+          expr->toString());
+      return false;
+    }
+  }
+
+  // Every group is flattened, so all of its tensors must have the same
+  // elements.
+  for (TensorView* tv : fusion->allTvs()) {
+    if (tv->hasBroadcast() || tv->hasReduction()) {
+      scheduler_debug_utils::canScheduleRejectReason(
+          schedulerType(),
+          "No support for broadcast or reduction: ",
+          tv->toString());
+      return false;
+    }
+  }
+
+  const std::vector<foreach_utils::ForEachGroup> groups =
+      foreach_utils::getForEachGroups(fusion);
+  if (groups.size() < 2) {
+    scheduler_debug_utils::canScheduleRejectReason(
+        schedulerType(), "Needs at least two independent groups of tensors");
+    return false;
+  }
+  for (const foreach_utils::ForEachGroup& group : groups) {
+    if (group.exprs.empty()) {
+      scheduler_debug_utils::canScheduleRejectReason(
+          schedulerType(),
+          "Group without exprs: ",
+          group.reference->toString());
+      return false;
+    }
+    if (!foreach_utils::haveSameStructure(groups.front(), group)) {
+      scheduler_debug_utils::canScheduleRejectReason(
+          schedulerType(),
+          "Groups are not structurally identical: ",
+          groups.front().reference->toString(),
+          " and ",
+          group.reference->toString());
+      return false;
+    }
+  }
+
+  return true;
+}
+
+std::unique_ptr<HeuristicParams> ForEachScheduler::computeHeuristics(
+    Fusion* fusion,
+    SchedulerRuntimeInfo& runtime_info,
+    HeuristicDataCache* data_cache) {
+  FUSER_PERF_SCOPE("ForEachScheduler::computeHeuristics");
+  auto params = std::make_unique<ForEachParams>();
+  params->tag = "ForEach heuristics";
+  params->cparams.index_type = runtime_info.getIndexType();
+
+  // The groups have different references, so the vectorization analysis of
+  // each can't be cached in data_cache, which is keyed by entry type only.
+  std::vector<int64_t> numels;
+  int64_t vectorization_factor =
+      (int64_t)SchedulerRuntimeInfo::max_alignment_size_in_byte;
+  for (const foreach_utils::ForEachGroup& group :
+       foreach_utils::getForEachGroups(fusion)) {
+    int64_t numel = 1;
+    for (IterDomain* logical_id : group.reference->getLogicalDomain()) {
+      auto extent =
+          runtime_info.expressionEvaluator().evaluate(logical_id->extent());
+      NVF_ERROR(
+          extent.hasValue(),
+          "Error inferring extent of: ",
+          logical_id->toString());
+      numel *= extent.as<int64_t>();
+    }
+    numels.push_back(numel);
+    vectorization_factor = std::min(
+        vectorization_factor,
+        vectorize_helper::getVectorizationFactor(
+            runtime_info,
+            group.reference,
+            /*data_cache=*/nullptr,
+            /*break_point=*/0));
+  }
+  params->vectorization_factor = vectorization_factor;
+
+  // Enough blocks to fill the device once, each processing a few units of
+  // bdimx vectors. A larger grid would just repeat the per-block overhead
+  // for every group.
+  constexpr int64_t units_per_block = 4;
+  const cudaDeviceProp* prop = runtime_info.deviceProperties();
+  const int64_t max_blocks = (int64_t)prop->multiProcessorCount *
+      ((int64_t)prop->maxThreadsPerMultiProcessor / params->bdimx);
+  params->gdimx = foreach_utils::getNumBlocks(
+      numels,
+      params->bdimx * params->vectorization_factor,
+      units_per_block,
+      max_blocks);
+
+  params->use_chunk_table =
+      parameterBytes(fusion, runtime_info.getIndexType()) >
+      kMaxKernelParameterBytes;
+
+  if (isDebugDumpEnabled(DebugDumpOption::SchedulerDebug)) {
+    debug() << params->toString() << std::endl;
+  }
+
+  return params;
+}
+
+void ForEachScheduler::schedule(Fusion* fusion, const HeuristicParams* params) {
+  FUSER_PERF_SCOPE("ForEachScheduler::schedule");
+
+  FusionGuard fg(fusion);
+  const auto foreach_params = dynamic_cast<const ForEachParams*>(params);
+  NVF_ERROR(foreach_params != nullptr);
+
+  // ForEachKernelExecutor compiles a fusion of a single chunk instead, see
+  // makeChunkFusion.
+  if (foreach_params->use_chunk_table) {
+    return;
+  }
+
+  scheduleGroups(fusion, foreach_params, foreach_params->gdimx);
+
+  markAliases(fusion);
+}
+
+std::unique_ptr<Fusion> ForEachScheduler::makeChunkFusion(
+    Fusion* fusion,
+    const ForEachParams* params) {
+  FUSER_PERF_SCOPE("ForEachScheduler::makeChunkFusion");
+  std::unique_ptr<Fusion> chunk_fusion =
+      foreach_utils::makeChunkFusion(fusion);
+  FusionGuard fg(chunk_fusion.get());
+  // A block processes a whole chunk. The chunks of a group are multiples of
+  // bdimx vectors, except for the last one, so every chunk keeps the
+  // alignment of its group.
+  scheduleGroups(chunk_fusion.get(), params, /*num_blocks=*/1);
+  return chunk_fusion;
+}
+
+} // namespace nvfuser
@@ -0,0 +1,67 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <scheduler/heuristic.h>
+#include <scheduler/registry.h>
+
+namespace nvfuser {
+
+class Fusion;
+class ForEachParams;
+class SchedulerRuntimeInfo;
+class HeuristicDataCache;
+
+//! Schedules a fusion applying the same pointwise math to a list of tensors
+//! of different shapes, e.g., an optimizer step over many parameters, as one
+//! kernel, in the style of multi-tensor apply. Such a fusion consists of
+//! structurally identical groups of tensors that only share scalars (see
+//! foreach_utils::getForEachGroups). Without this scheduler, each group
+//! would become a segment of its own.
+//!
+//! Each group is flattened and split evenly over the same grid, so every
+//! block processes a contiguous chunk of every group large enough (see
+//! foreach_utils::makeChunkTable). All groups use the vectorization factor
+//! their tensors have in common.
+//!
+//! Every tensor is a kernel parameter of its own, unless the parameters
+//! would exceed kMaxKernelParameterBytes. The tensors are then read from a
+//! chunk table in global memory by ForEachKernelExecutor, which runs a kernel
+//! scheduled by makeChunkFusion on each chunk.
+//!
+//! Enabled with EnableOption::ForEachScheduler.
+class ForEachScheduler : public SchedulerEntry {
+ public:
+  bool canScheduleCompileTime(Fusion* fusion) override;
+  bool canScheduleRunTime(
+      Fusion* fusion,
+      SchedulerRuntimeInfo& runtime_info,
+      HeuristicDataCache* data_cache = nullptr) override {
+    return true;
+  }
+
+  std::unique_ptr<HeuristicParams> computeHeuristics(
+      Fusion* fusion,
+      SchedulerRuntimeInfo& runtime_info,
+      HeuristicDataCache* data_cache) override;
+
+  void schedule(Fusion* fusion, const HeuristicParams* params) override;
+
+  //! Builds and schedules the fusion ForEachKernelExecutor runs on each
+  //! chunk of a chunk table, see foreach_utils::makeChunkFusion. `fusion` is
+  //! left unscheduled when `params` use a chunk table.
+  static std::unique_ptr<Fusion> makeChunkFusion(
+      Fusion* fusion,
+      const ForEachParams* params);
+
+  constexpr static SchedulerType schedulerType() {
+    return SchedulerType::ForEach;
+  }
+};
+
+} // namespace nvfuser
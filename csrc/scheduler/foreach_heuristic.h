@@ -0,0 +1,73 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <c10/util/hash.h>
+#include <scheduler/heuristic.h>
+#include <utils.h>
+
+#include <sstream>
+
+namespace nvfuser {
+
+class ForEachParams : public HeuristicParams {
+ public:
+  ForEachParams() : HeuristicParams(SchedulerType::ForEach) {};
+
+  // Threads per block
+  int64_t bdimx = 128;
+
+  // Blocks in the grid. Each group is split evenly over all of them, see
+  // foreach_utils::makeChunkTable.
+  int64_t gdimx = 1;
+
+  // Vectorization factor common to all the groups
+  int64_t vectorization_factor = 1;
+
+  // Whether the tensors are read from a chunk table instead of being kernel
+  // parameters of their own, see ForEachKernelExecutor. Each chunk of the
+  // table then runs on a block of its own.
+  bool use_chunk_table = false;
+
+  using HeuristicParams::HeuristicParams;
+
+  // Warning: Does not check launch parameters!
+  bool sameAs(const HeuristicParams* other_base) const override {
+    auto other = dynamic_cast<const ForEachParams*>(other_base);
+    if (other == nullptr) {
+      return false;
+    }
+    bool attr_equal = other->cparams == cparams && other->bdimx == bdimx &&
+        other->gdimx == gdimx &&
+        other->vectorization_factor == vectorization_factor &&
+        other->use_chunk_table == use_chunk_table;
+    return attr_equal;
+  }
+
+  std::string toString() const override {
+    std::stringstream ss;
+    ss << "\n===== ForEach Parameters ========\n"
+       << (tag.empty() ? "" : "Tag: ") << tag << " ForEach Characteristics:\n"
+       << " bdimx: " << bdimx << "\n"
+       << " gdimx: " << gdimx << "\n"
+       << " vectorization factor: " << vectorization_factor << "\n"
+       << " use chunk table: " << use_chunk_table << "\n";
+    ss << "====================================\n";
+    return ss.str();
+  }
+
+  size_t hash() const override {
+    return c10::get_hash(bdimx, gdimx, vectorization_factor, use_chunk_table);
+  }
+
+  std::unique_ptr<HeuristicParams> clone() const override {
+    return std::make_unique<ForEachParams>(*this);
+  }
+};
+
+} // namespace nvfuser
@@ -0,0 +1,320 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <scheduler/foreach_utils.h>
+
+#include <disjoint_set.h>
+#include <fusion.h>
+#include <ir/builder.h>
+#include <ir/utils.h>
+#include <utils.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace nvfuser {
+namespace foreach_utils {
+
+std::vector<ForEachGroup> getForEachGroups(Fusion* fusion) {
+  const std::vector<Expr*> exprs = fusion->exprs();
+
+  DisjointSets<TensorView*> sets;
+  for (TensorView* tv : ir_utils::filterByType<TensorView>(fusion->outputs())) {
+    sets.initializeSet(tv);
+  }
+  for (Expr* expr : exprs) {
+    std::vector<TensorView*> tvs =
+        ir_utils::filterByType<TensorView>(expr->inputs()).vector();
+    for (TensorView* tv :
+         ir_utils::filterByType<TensorView>(expr->outputs())) {
+      tvs.push_back(tv);
+    }
+    for (TensorView* tv : tvs) {
+      sets.initializeSet(tv);
+      sets.mapEntries(tvs.front(), tv);
+    }
+  }
+
+  std::vector<ForEachGroup> groups;
+  std::unordered_map<const void*, int64_t> group_of_set;
+  for (TensorView* tv : ir_utils::filterByType<TensorView>(fusion->outputs())) {
+    const void* set = &sets.getDisjointSetOf(tv);
+    if (group_of_set.emplace(set, std::ssize(groups)).second) {
+      groups.emplace_back();
+      groups.back().reference = tv;
+    }
+  }
+
+  auto group_of = [&](TensorView* tv) -> ForEachGroup* {
+    auto it = group_of_set.find(&sets.getDisjointSetOf(tv));
+    return it == group_of_set.end() ? nullptr : &groups.at(it->second);
+  };
+  std::unordered_set<TensorView*> added_tvs;
+  auto add_tv = [&](ForEachGroup* group, TensorView* tv) {
+    if (added_tvs.insert(tv).second) {
+      group->tvs.push_back(tv);
+    }
+  };
+  for (Expr* expr : exprs) {
+    auto out_tvs = ir_utils::filterByType<TensorView>(expr->outputs());
+    if (out_tvs.empty()) {
+      continue;
+    }
+    ForEachGroup* group = group_of(*out_tvs.begin());
+    if (group == nullptr) {
+      continue;
+    }
+    group->exprs.push_back(expr);
+    for (TensorView* tv : ir_utils::filterByType<TensorView>(expr->inputs())) {
+      add_tv(group, tv);
+    }
+    for (TensorView* tv : out_tvs) {
+      add_tv(group, tv);
+    }
+  }
+  // Fusion outputs that are also fusion inputs have no exprs
+  for (ForEachGroup& group : groups) {
+    add_tv(&group, group.reference);
+  }
+
+  return groups;
+}
+
+bool haveSameStructure(const ForEachGroup& a, const ForEachGroup& b) {
+  if (a.exprs.size() != b.exprs.size() || a.tvs.size() != b.tvs.size()) {
+    return false;
+  }
+
+  std::unordered_map<Val*, Val*> a_to_b;
+  auto map_val = [&a_to_b](Val* val_a, Val* val_b) {
+    if (auto it = a_to_b.find(val_a); it != a_to_b.end()) {
+      return it->second == val_b;
+    }
+    if (val_a->isA<TensorView>() != val_b->isA<TensorView>() ||
+        val_a->dtype() != val_b->dtype() ||
+        val_a->isFusionInput() != val_b->isFusionInput() ||
+        val_a->isFusionOutput() != val_b->isFusionOutput()) {
+      return false;
+    }
+    // Scalars must be shared by the groups or be the same constant
+    if (!val_a->isA<TensorView>() && val_a != val_b &&
+        !(val_a->isConstScalar() && val_a->sameAs(val_b))) {
+      return false;
+    }
+    a_to_b.emplace(val_a, val_b);
+    return true;
+  };
+
+  for (auto&& [expr_a, expr_b] : zip(a.exprs, b.exprs)) {
+    if (!expr_a->sameOp(expr_b)) {
+      return false;
+    }
+    for (auto&& [in_a, in_b] : zip(expr_a->inputs(), expr_b->inputs())) {
+      if (!map_val(in_a, in_b)) {
+        return false;
+      }
+    }
+    for (auto&& [out_a, out_b] : zip(expr_a->outputs(), expr_b->outputs())) {
+      if (!map_val(out_a, out_b)) {
+        return false;
+      }
+    }
+  }
+  return map_val(a.reference, b.reference);
+}
+
+std::vector<TensorView*> getTableTensors(const ForEachGroup& group) {
+  std::vector<TensorView*> tvs;
+  std::copy_if(
+      group.tvs.begin(),
+      group.tvs.end(),
+      std::back_inserter(tvs),
+      [](TensorView* tv) { return tv->isFusionInput(); });
+  std::copy_if(
+      group.tvs.begin(),
+      group.tvs.end(),
+      std::back_inserter(tvs),
+      [](TensorView* tv) { return tv->isFusionOutput(); });
+  return tvs;
+}
+
+std::unique_ptr<Fusion> makeChunkFusion(Fusion* fusion) {
+  auto chunk_fusion = std::make_unique<Fusion>(*fusion);
+  FusionGuard fg(chunk_fusion.get());
+  const std::vector<ForEachGroup> groups =
+      getForEachGroups(chunk_fusion.get());
+  NVF_ERROR(!groups.empty(), "No group to make a chunk of.");
+  const ForEachGroup& group = groups.front();
+
+  // Scalars, including the ones computed from scalar inputs, are shared with
+  // the copy of `fusion`. Only the tensors of the group are replaced.
+  Val* numel = IrBuilder::create<Val>(DataType::Index);
+  std::unordered_map<Val*, Val*> chunk_of;
+  auto make_chunk = [&](TensorView* tv) {
+    TensorView* chunk = TensorViewBuilder()
+                            .shape(std::vector<Val*>{numel})
+                            .dtype(tv->dtype())
+                            .contiguity(true)
+                            .build();
+    chunk_of.emplace(tv, chunk);
+    return chunk;
+  };
+
+  std::vector<Val*> inputs;
+  for (Val* in : chunk_fusion->inputs()) {
+    if (!in->isA<TensorView>()) {
+      inputs.push_back(in);
+    }
+  }
+  std::vector<Val*> outputs;
+  for (TensorView* tv : getTableTensors(group)) {
+    if (tv->isFusionInput()) {
+      inputs.push_back(make_chunk(tv));
+    }
+  }
+  for (Expr* expr : group.exprs) {
+    std::vector<Val*> chunk_inputs;
+    for (Val* in : expr->inputs()) {
+      auto it = chunk_of.find(in);
+      chunk_inputs.push_back(it == chunk_of.end() ? in : it->second);
+    }
+    std::vector<Val*> chunk_outputs;
+    for (Val* out : expr->outputs()) {
+      chunk_outputs.push_back(make_chunk(out->as<TensorView>()));
+    }
+    expr->newObjectFunc()(
+        chunk_fusion.get(), chunk_inputs, chunk_outputs, expr->attributes());
+  }
+  for (TensorView* tv : getTableTensors(group)) {
+    if (tv->isFusionOutput()) {
+      outputs.push_back(chunk_of.at(tv));
+    }
+  }
+
+  while (!chunk_fusion->outputs().empty()) {
+    chunk_fusion->removeOutput(chunk_fusion->outputs().back());
+  }
+  while (!chunk_fusion->inputs().empty()) {
+    chunk_fusion->removeInput(chunk_fusion->inputs().back());
+  }
+  for (Val* in : inputs) {
+    chunk_fusion->addInput(in);
+  }
+  for (Val* out : outputs) {
+    chunk_fusion->addOutput(out);
+  }
+  return chunk_fusion;
+}
+
+int64_t getNumBlocks(
+    const std::vector<int64_t>& numels,
+    int64_t unit_size,
+    int64_t units_per_block,
+    int64_t max_blocks) {
+  NVF_ERROR(unit_size > 0 && units_per_block > 0 && max_blocks > 0);
+  int64_t total_units = 0;
+  int64_t max_units = 0;
+  for (int64_t numel : numels) {
+    const int64_t units = ceilDiv(numel, unit_size);
+    total_units += units;
+    max_units = std::max(max_units, units);
+  }
+  const int64_t num_blocks = ceilDiv(total_units, units_per_block);
+  return std::max(std::min({num_blocks, max_units, max_blocks}), (int64_t)1);
+}
+
+std::vector<ForEachChunk> makeChunkTable(
+    const std::vector<int64_t>& numels,
+    int64_t unit_size,
+    int64_t num_blocks) {
+  NVF_ERROR(unit_size > 0 && num_blocks > 0);
+  // The elements of each group a block processes
+  std::vector<int64_t> chunk_sizes;
+  chunk_sizes.reserve(numels.size());
+  for (int64_t numel : numels) {
+    chunk_sizes.push_back(
+        ceilDiv(ceilDiv(numel, unit_size), num_blocks) * unit_size);
+  }
+
+  std::vector<ForEachChunk> chunks;
+  for (int64_t block : arange(num_blocks)) {
+    for (auto&& [group, numel] : enumerate(numels)) {
+      const int64_t offset = block * chunk_sizes.at(group);
+      if (offset >= numel) {
+        continue;
+      }
+      chunks.push_back(
+          {(int64_t)group,
+           block,
+           offset,
+           std::min(chunk_sizes.at(group), numel - offset)});
+    }
+  }
+  return chunks;
+}
+
+ChunkTableLayout getChunkTableLayout(
+    int64_t num_chunks,
+    int64_t num_groups,
+    int64_t num_tensors,
+    PrimDataType index_type) {
+  NVF_ERROR(num_chunks >= 0 && num_groups >= 0 && num_tensors >= 0);
+  const int64_t array_bytes = num_chunks * dataTypeSize(index_type);
+  ChunkTableLayout layout;
+  layout.chunk_groups = 0;
+  layout.chunk_offsets = array_bytes;
+  layout.chunk_numels = 2 * array_bytes;
+  layout.data = roundUpToMultiple(3 * array_bytes, (int64_t)sizeof(void*));
+  layout.size = layout.data + num_groups * num_tensors * (int64_t)sizeof(void*);
+  return layout;
+}
+
+std::vector<std::byte> packChunkTable(
+    const std::vector<ForEachChunk>& chunks,
+    const std::vector<std::vector<void*>>& data,
+    PrimDataType index_type) {
+  const int64_t num_tensors = data.empty() ? 0 : std::ssize(data.front());
+  const ChunkTableLayout layout = getChunkTableLayout(
+      std::ssize(chunks), std::ssize(data), num_tensors, index_type);
+  std::vector<std::byte> table(layout.size);
+
+  auto write_index = [&](int64_t array, int64_t i, int64_t value) {
+    std::byte* dst = table.data() + array + i * dataTypeSize(index_type);
+    if (index_type == PrimDataType::Int32) {
+      NVF_ERROR(
+          value <= std::numeric_limits<int32_t>::max(),
+          "Chunk table entry overflows 32-bit indexing: ",
+          value);
+      const auto value32 = (int32_t)value;
+      std::memcpy(dst, &value32, sizeof(value32));
+    } else {
+      NVF_ERROR_EQ(index_type, PrimDataType::Int);
+      std::memcpy(dst, &value, sizeof(value));
+    }
+  };
+  for (auto&& [i, chunk] : enumerate(chunks)) {
+    NVF_ERROR(chunk.group >= 0 && chunk.group < std::ssize(data));
+    write_index(layout.chunk_groups, (int64_t)i, chunk.group);
+    write_index(layout.chunk_offsets, (int64_t)i, chunk.offset);
+    write_index(layout.chunk_numels, (int64_t)i, chunk.numel);
+  }
+
+  std::byte* dst = table.data() + layout.data;
+  for (const std::vector<void*>& group_data : data) {
+    NVF_ERROR_EQ(std::ssize(group_data), num_tensors);
+    std::memcpy(dst, group_data.data(), group_data.size() * sizeof(void*));
+    dst += group_data.size() * sizeof(void*);
+  }
+  return table;
+}
+
+} // namespace foreach_utils
+} // namespace nvfuser
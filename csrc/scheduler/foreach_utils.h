@@ -0,0 +1,124 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <exceptions.h>
+#include <ir/all_nodes.h>
+#include <type.h>
+#include <visibility.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace nvfuser {
+namespace foreach_utils {
+
+//! The tensors of a fusion that are connected to each other through exprs.
+//! A fusion applying the same math to a list of tensors, e.g., an optimizer
+//! step over many parameters, has one group per tensor of the list. Scalars
+//! don't connect groups, so groups can share scalar inputs like a learning
+//! rate.
+struct ForEachGroup {
+  //! The tensors of the group in topological order
+  std::vector<TensorView*> tvs;
+  //! The exprs of the group in topological order
+  std::vector<Expr*> exprs;
+  //! The first fusion output of the group, used as the reference to
+  //! schedule the group
+  TensorView* reference = nullptr;
+};
+
+//! Partitions the tensors of `fusion` into groups. The groups are ordered as
+//! their references in the fusion outputs. Tensors not reachable from a
+//! fusion output aren't in any group.
+NVF_API std::vector<ForEachGroup> getForEachGroups(Fusion* fusion);
+
+//! Whether two groups apply the same exprs in the same order to tensors of
+//! the same data types, reading the same scalars. The shapes of their
+//! tensors may differ.
+NVF_API bool haveSameStructure(const ForEachGroup& a, const ForEachGroup& b);
+
+//! The tensors of `group` a chunk table holds the data pointers of: the
+//! fusion inputs of the group followed by its fusion outputs, each in the
+//! order of ForEachGroup::tvs. Structurally identical groups have
+//! corresponding tensors at the same positions.
+NVF_API std::vector<TensorView*> getTableTensors(const ForEachGroup& group);
+
+//! A fusion applying the exprs of the first group of `fusion` to one chunk,
+//! i.e., to 1D contiguous tensors of the same symbolic size. Its inputs are
+//! the scalar inputs of `fusion` in their order, followed by the chunks of
+//! the inputs among getTableTensors. Its outputs are the chunks of the rest.
+//! Running it on every chunk of every group computes `fusion`.
+NVF_API std::unique_ptr<Fusion> makeChunkFusion(Fusion* fusion);
+
+//! A contiguous range of the elements of a group processed by one block
+struct ForEachChunk {
+  int64_t group = 0;
+  int64_t block = 0;
+  int64_t offset = 0;
+  int64_t numel = 0;
+
+  bool operator==(const ForEachChunk& other) const = default;
+};
+
+//! The number of blocks to launch for groups of `numels` elements. Elements
+//! are processed in units of `unit_size` elements, i.e., threads per block
+//! times the vectorization factor, and each block is given about
+//! `units_per_block` units in total. It is at most `max_blocks` and at most
+//! the number of units of the largest group, as more blocks would have
+//! nothing to do.
+NVF_API int64_t getNumBlocks(
+    const std::vector<int64_t>& numels,
+    int64_t unit_size,
+    int64_t units_per_block,
+    int64_t max_blocks);
+
+//! The chunks processed by each of `num_blocks` blocks, ordered by block.
+//! Each group is split evenly in units of `unit_size` elements over all the
+//! blocks, so every block handles a slice of every group large enough. This
+//! is how the ForEach scheduler distributes the groups over the grid. Empty
+//! chunks are omitted.
+NVF_API std::vector<ForEachChunk> makeChunkTable(
+    const std::vector<int64_t>& numels,
+    int64_t unit_size,
+    int64_t num_blocks);
+
+//! Byte offsets of the arrays of a chunk table as the ForEach kernel reads it
+//! from global memory. The group, offset and numel of each chunk come first,
+//! as three arrays of `index_type`, followed by the data pointers of the
+//! tensors of each group, aligned to the size of a pointer. The kernel takes
+//! only the address of the table and finds the number of chunks in gridDim.x,
+//! so any number of tensors takes a single kernel parameter.
+struct ChunkTableLayout {
+  int64_t chunk_groups = 0;
+  int64_t chunk_offsets = 0;
+  int64_t chunk_numels = 0;
+  int64_t data = 0;
+  int64_t size = 0;
+
+  bool operator==(const ChunkTableLayout& other) const = default;
+};
+
+NVF_API ChunkTableLayout getChunkTableLayout(
+    int64_t num_chunks,
+    int64_t num_groups,
+    int64_t num_tensors,
+    PrimDataType index_type);
+
+//! Packs `chunks` and the data pointers of the tensors of each group, i.e.,
+//! `data[group][tensor]`, as laid out by getChunkTableLayout. Every group
+//! has the same number of tensors. The block of a chunk isn't stored, as the
+//! kernel runs chunk `i` on block `i`.
+NVF_API std::vector<std::byte> packChunkTable(
+    const std::vector<ForEachChunk>& chunks,
+    const std::vector<std::vector<void*>>& data,
+    PrimDataType index_type);
+
+} // namespace foreach_utils
+} // namespace nvfuser
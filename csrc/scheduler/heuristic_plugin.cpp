@@ -0,0 +1,590 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <scheduler/heuristic_plugin.h>
+
+#include <debug.h>
+#include <expr_evaluator.h>
+#include <fusion.h>
+#include <ir/interface_nodes.h>
+#include <ir/utils.h>
+#include <options.h>
+#include <scheduler/runtime_info.h>
+#include <sys_utils.h>
+#include <utils.h>
+
+#include <array>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+
+namespace nvfuser {
+
+namespace heuristic_plugin {
+
+namespace {
+
+// Overrides beyond this are almost certainly a mistake in the plugin and
+// would blow up register usage and compile time.
+constexpr int32_t kMaxUnrollFactor = 32;
+
+std::mutex plugin_mutex;
+
+// Loads the shared library named by NVFUSER_HEURISTIC_PLUGIN and checks it
+// was built against the same version of the ABI.
+class LibraryPlugin : LibraryLoader {
+ public:
+  LibraryPlugin() {
+    const char* envvar = getNvFuserEnv("HEURISTIC_PLUGIN");
+    if (envvar != nullptr) {
+      setFilename(envvar);
+    }
+  }
+
+  bool available() const {
+    return !filename().empty();
+  }
+
+  bool query(const NvfHeuristicProblem& problem, NvfHeuristicOverrides& out) {
+    NVF_ERROR(available());
+    {
+      std::lock_guard<std::mutex> lock(plugin_mutex);
+      if (query_fn_ == nullptr) {
+        auto version_fn = (NvfHeuristicPluginVersionFn)getSymbol(
+            "nvfuser_heuristic_plugin_api_version");
+        const uint32_t version = version_fn();
+        NVF_CHECK(
+            version == NVFUSER_HEURISTIC_PLUGIN_API_VERSION,
+            "Heuristic plugin ",
+            filename(),
+            " implements version ",
+            version,
+            " of the plugin API but nvFuser expects version ",
+            NVFUSER_HEURISTIC_PLUGIN_API_VERSION);
+        query_fn_ = (NvfHeuristicPluginQueryFn)getSymbol(
+            "nvfuser_heuristic_plugin_query");
+      }
+    }
+    return query_fn_(&problem, &out) != 0;
+  }
+
+ private:
+  NvfHeuristicPluginQueryFn query_fn_ = nullptr;
+};
+
+LibraryPlugin& libraryPlugin() {
+  static LibraryPlugin plugin;
+  return plugin;
+}
+
+// Returns the table named by NVFUSER_HEURISTIC_TABLE, or nullptr if the
+// variable isn't set. The table is read once.
+const TableHeuristicPlugin* tablePlugin() {
+  static const std::unique_ptr<TableHeuristicPlugin> table =
+      []() -> std::unique_ptr<TableHeuristicPlugin> {
+    const char* path = getNvFuserEnv("HEURISTIC_TABLE");
+    if (path == nullptr) {
+      return nullptr;
+    }
+    return std::make_unique<TableHeuristicPlugin>(
+        TableHeuristicPlugin::fromFile(path));
+  }();
+  return table.get();
+}
+
+// Set by HeuristicPluginGuard. Like matmul_heuristic_plugin's config factory,
+// this is thread-local because heuristics are computed on the thread that
+// creates the FusionKernelRuntime.
+thread_local QueryFunction guarded_query = nullptr;
+
+bool queryPlugin(
+    const NvfHeuristicProblem& problem,
+    NvfHeuristicOverrides& out) {
+  out = {};
+  out.struct_size = sizeof(NvfHeuristicOverrides);
+  if (guarded_query) {
+    return guarded_query(problem, out);
+  }
+  if (libraryPlugin().available()) {
+    return libraryPlugin().query(problem, out);
+  }
+  if (const TableHeuristicPlugin* table = tablePlugin()) {
+    return table->query(problem, out);
+  }
+  return false;
+}
+
+int32_t toAbiSchedulerType(SchedulerType scheduler_type) {
+  switch (scheduler_type) {
+    case SchedulerType::PointWise:
+      return NVFUSER_HEURISTIC_PLUGIN_POINTWISE;
+    case SchedulerType::Reduction:
+      return NVFUSER_HEURISTIC_PLUGIN_REDUCTION;
+    case SchedulerType::InnerPersistent:
+      return NVFUSER_HEURISTIC_PLUGIN_INNER_PERSISTENT;
+    case SchedulerType::OuterPersistent:
+      return NVFUSER_HEURISTIC_PLUGIN_OUTER_PERSISTENT;
+    default:
+      NVF_THROW("Heuristic plugins don't support ", scheduler_type);
+  }
+}
+
+char dtypeToChar(const DataType& dtype) {
+  if (dtype == DataType::Half) {
+    return 'H';
+  } else if (dtype == DataType::BFloat16) {
+    return 'T';
+  } else if (dtype == DataType::Float) {
+    return 'S';
+  } else if (dtype == DataType::Double) {
+    return 'D';
+  } else if (dtype == DataType::Float8_e4m3fn) {
+    return 'Q';
+  } else if (dtype == DataType::Float8_e5m2) {
+    return 'R';
+  } else if (dtype == DataType::Int32) {
+    return 'I';
+  } else if (dtype == DataType::Int) {
+    return 'L';
+  } else if (dtype == DataType::Bool) {
+    return 'b';
+  } else if (dtype == DataType::ComplexFloat) {
+    return 'C';
+  } else if (dtype == DataType::ComplexDouble) {
+    return 'Z';
+  }
+  return '?';
+}
+
+void describeTensors(
+    const std::vector<Val*>& vals,
+    int32_t& num_tensors,
+    char* dtypes) {
+  num_tensors = 0;
+  for (auto* tv : ir_utils::filterByType<TensorView>(vals)) {
+    if (num_tensors == NVFUSER_HEURISTIC_PLUGIN_MAX_TENSORS) {
+      break;
+    }
+    dtypes[num_tensors++] = dtypeToChar(tv->dtype());
+  }
+}
+
+bool isPowerOf2(int64_t x) {
+  return x > 0 && (x & (x - 1)) == 0;
+}
+
+// Checks the fields every scheduler interprets the same way. Returns an empty
+// string if they are valid.
+std::string checkCommonOverrides(
+    const NvfHeuristicProblem& problem,
+    const NvfHeuristicOverrides& overrides,
+    uint32_t supported_fields) {
+  std::stringstream error;
+  if (overrides.fields & ~supported_fields) {
+    error << "unsupported fields 0x" << std::hex
+          << (overrides.fields & ~supported_fields) << std::dec << ". ";
+  }
+  if ((overrides.fields & NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR) &&
+      (!isPowerOf2(overrides.vectorization_factor) ||
+       overrides.vectorization_factor > problem.max_vectorization_factor)) {
+    error << "vectorization_factor " << overrides.vectorization_factor
+          << " isn't a power of 2 no larger than "
+          << problem.max_vectorization_factor << ". ";
+  }
+  const auto check_unroll = [&](uint32_t field,
+                                int32_t value,
+                                const char* name) {
+    if ((overrides.fields & field) &&
+        (value < 1 || value > kMaxUnrollFactor)) {
+      error << name << " " << value << " isn't in [1, " << kMaxUnrollFactor
+            << "]. ";
+    }
+  };
+  check_unroll(
+      NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_INNER,
+      overrides.unroll_factor_inner,
+      "unroll_factor_inner");
+  check_unroll(
+      NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_OUTER,
+      overrides.unroll_factor_outer,
+      "unroll_factor_outer");
+  check_unroll(
+      NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_ITER_DOM,
+      overrides.unroll_factor_iter_dom,
+      "unroll_factor_iter_dom");
+  return error.str();
+}
+
+void reportRejected(
+    const NvfHeuristicProblem& problem,
+    const std::string& why) {
+  if (isDebugDumpEnabled(DebugDumpOption::SchedulerDebug)) {
+    debug() << "Ignoring heuristic plugin overrides for scheduler type "
+            << problem.scheduler_type << ": " << why << std::endl;
+  }
+}
+
+} // namespace
+
+bool hasPlugin() {
+  return guarded_query != nullptr || libraryPlugin().available() ||
+      tablePlugin() != nullptr;
+}
+
+std::optional<NvfHeuristicProblem> describeProblem(
+    SchedulerType scheduler_type,
+    Fusion* fusion,
+    SchedulerRuntimeInfo& runtime_info,
+    TensorView* reference) {
+  NvfHeuristicProblem problem = {};
+  problem.struct_size = sizeof(NvfHeuristicProblem);
+  problem.scheduler_type = toAbiSchedulerType(scheduler_type);
+
+  const std::vector<IterDomain*>& logical = reference->getLogicalDomain();
+  if (std::ssize(logical) > NVFUSER_HEURISTIC_PLUGIN_MAX_DIMS) {
+    return std::nullopt;
+  }
+  for (IterDomain* id : logical) {
+    PolymorphicValue extent = runtime_info.expressionEvaluator().evaluate(
+        id->getMaybeExpandedExtent());
+    if (!extent.hasValue()) {
+      return std::nullopt;
+    }
+    problem.extents[problem.num_dims++] = extent.as<int64_t>();
+  }
+
+  describeTensors(fusion->inputs(), problem.num_inputs, problem.input_dtypes);
+  describeTensors(
+      fusion->outputs(), problem.num_outputs, problem.output_dtypes);
+
+  const cudaDeviceProp* prop = runtime_info.deviceProperties();
+  problem.device_major = prop->major;
+  problem.device_minor = prop->minor;
+  problem.device_multi_processor_count = prop->multiProcessorCount;
+  return problem;
+}
+
+bool updatePointwiseParams(
+    PointwiseParams* params,
+    NvfHeuristicProblem problem) {
+  NVF_ERROR(params != nullptr);
+  problem.default_vectorization_factor =
+      (int32_t)params->vectorization_factor;
+  problem.default_unroll_factor_inner = (int32_t)params->unroll_factor_inner;
+  problem.default_unroll_factor_outer = (int32_t)params->unroll_factor_outer;
+  problem.default_unroll_factor_iter_dom = 1;
+
+  NvfHeuristicOverrides overrides;
+  if (!queryPlugin(problem, overrides) || overrides.fields == 0) {
+    return false;
+  }
+
+  std::string error = checkCommonOverrides(
+      problem,
+      overrides,
+      NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR |
+          NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_INNER |
+          NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_OUTER);
+  if ((overrides.fields & NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_OUTER) &&
+      overrides.unroll_factor_outer > 1 && params->break_point == 0) {
+    error += "unroll_factor_outer requires a 2D schedule. ";
+  }
+  if (!error.empty()) {
+    reportRejected(problem, error);
+    return false;
+  }
+
+  if (overrides.fields & NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR) {
+    params->vectorization_factor = overrides.vectorization_factor;
+  }
+  if (overrides.fields & NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_INNER) {
+    params->unroll_factor_inner = overrides.unroll_factor_inner;
+  }
+  if (overrides.fields & NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_OUTER) {
+    params->unroll_factor_outer = overrides.unroll_factor_outer;
+  }
+  params->tag += " (heuristic plugin)";
+  return true;
+}
+
+bool updateReductionParams(
+    ReductionParams* params,
+    NvfHeuristicProblem problem) {
+  NVF_ERROR(params != nullptr);
+  const bool vectorized =
+      params->vectorize_inner_reduction || params->vectorize_iter_dom;
+  problem.default_vectorization_factor = params->vectorize_inner_reduction
+      ? (int32_t)params->unroll_factor_inner_reduction
+      : (params->vectorize_iter_dom ? (int32_t)params->unroll_factor_iter_dom
+                                    : 1);
+  problem.default_unroll_factor_inner = 1;
+  problem.default_unroll_factor_outer =
+      (int32_t)params->unroll_factor_outer_reduction;
+  problem.default_unroll_factor_iter_dom =
+      params->vectorize_iter_dom ? 1 : (int32_t)params->unroll_factor_iter_dom;
+
+  NvfHeuristicOverrides overrides;
+  if (!queryPlugin(problem, overrides) || overrides.fields == 0) {
+    return false;
+  }
+
+  // Persistent kernels size their persistent batches from the vectorization
+  // and reduction unroll factors, so only the iteration domain can be
+  // unrolled differently.
+  uint32_t supported_fields = NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_ITER_DOM;
+  if (!params->persistent_kernel) {
+    supported_fields |= NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR |
+        NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_OUTER;
+  }
+  std::string error =
+      checkCommonOverrides(problem, overrides, supported_fields);
+  if ((overrides.fields & NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR) &&
+      !vectorized) {
+    error += "the heuristic didn't vectorize any dimension. ";
+  }
+  if ((overrides.fields & NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_ITER_DOM) &&
+      params->vectorize_iter_dom) {
+    error += "the iteration domain is vectorized; "
+             "override vectorization_factor instead. ";
+  }
+  if ((overrides.fields & NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_OUTER) &&
+      !params->schedule_3D) {
+    error += "unroll_factor_outer requires an outer reduction dimension. ";
+  }
+  // Grid dimensions split at a fixed size are baked into the schedule.
+  if (params->split_grid_dim_iter_dom_inner ||
+      params->split_grid_dim_iter_dom_outer ||
+      params->split_grid_dim_inner_reduction ||
+      params->split_grid_dim_outer_reduction) {
+    error += "the schedule splits a grid dimension. ";
+  }
+  if (!error.empty()) {
+    reportRejected(problem, error);
+    return false;
+  }
+
+  if (overrides.fields & NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR) {
+    if (params->vectorize_inner_reduction) {
+      params->unroll_factor_inner_reduction = overrides.vectorization_factor;
+    } else {
+      params->unroll_factor_iter_dom = overrides.vectorization_factor;
+    }
+  }
+  if (overrides.fields & NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_OUTER) {
+    params->unroll_factor_outer_reduction = overrides.unroll_factor_outer;
+  }
+  if (overrides.fields & NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_ITER_DOM) {
+    params->unroll_factor_iter_dom = overrides.unroll_factor_iter_dom;
+  }
+
+  // The heuristic bound grid dimensions for the factors it chose. Let them be
+  // inferred from the new schedule instead. Block dimensions are split
+  // factors, which the overrides above don't change.
+  params->lparams = LaunchParams(
+      LaunchParams::UNINITIALIZED_VAL,
+      LaunchParams::UNINITIALIZED_VAL,
+      LaunchParams::UNINITIALIZED_VAL,
+      params->lparams.getRawVal(ParallelType::TIDx),
+      params->lparams.getRawVal(ParallelType::TIDy),
+      params->lparams.getRawVal(ParallelType::TIDz));
+  params->tag += " (heuristic plugin)";
+  return true;
+}
+
+HeuristicPluginGuard::HeuristicPluginGuard(QueryFunction query)
+    : prev_query_(guarded_query) {
+  guarded_query = std::move(query);
+}
+
+HeuristicPluginGuard::~HeuristicPluginGuard() {
+  guarded_query = prev_query_;
+}
+
+namespace {
+
+std::string trim(const std::string& s) {
+  const auto begin = s.find_first_not_of(" \t\r");
+  if (begin == std::string::npos) {
+    return "";
+  }
+  const auto end = s.find_last_not_of(" \t\r");
+  return s.substr(begin, end - begin + 1);
+}
+
+int64_t parseInt(const std::string& token, const std::string& value) {
+  try {
+    size_t pos = 0;
+    const int64_t result = std::stoll(value, &pos);
+    NVF_CHECK(pos == value.size());
+    return result;
+  } catch (const std::exception&) {
+    NVF_THROW("Invalid integer in heuristic table entry ", token);
+  }
+}
+
+constexpr std::array<std::pair<const char*, int32_t>, 4> kSchedulerNames = {{
+    {"pointwise", NVFUSER_HEURISTIC_PLUGIN_POINTWISE},
+    {"reduction", NVFUSER_HEURISTIC_PLUGIN_REDUCTION},
+    {"inner_persistent", NVFUSER_HEURISTIC_PLUGIN_INNER_PERSISTENT},
+    {"outer_persistent", NVFUSER_HEURISTIC_PLUGIN_OUTER_PERSISTENT},
+}};
+
+int32_t parseSchedulerType(const std::string& name) {
+  for (const auto& [scheduler_name, scheduler_type] : kSchedulerNames) {
+    if (name == scheduler_name) {
+      return scheduler_type;
+    }
+  }
+  NVF_THROW("Unknown scheduler in heuristic table: ", name);
+}
+
+const char* schedulerTypeName(int32_t scheduler_type) {
+  for (const auto& [scheduler_name, type] : kSchedulerNames) {
+    if (type == scheduler_type) {
+      return scheduler_name;
+    }
+  }
+  NVF_THROW("Unknown heuristic plugin scheduler type: ", scheduler_type);
+}
+
+} // namespace
+
+TableHeuristicPlugin TableHeuristicPlugin::parse(std::istream& is) {
+  TableHeuristicPlugin table;
+  std::string line;
+  while (std::getline(is, line)) {
+    if (auto comment = line.find('#'); comment != std::string::npos) {
+      line.resize(comment);
+    }
+    line = trim(line);
+    if (line.empty()) {
+      continue;
+    }
+
+    std::istringstream tokens(line);
+    std::string scheduler;
+    std::string extents;
+    tokens >> scheduler >> extents;
+    NVF_CHECK(
+        !extents.empty(),
+        "Expected `<scheduler> <extents> <field>=<value>...` in heuristic "
+        "table: ",
+        line);
+
+    Entry entry;
+    entry.scheduler_type = parseSchedulerType(scheduler);
+    if (extents != "*") {
+      std::istringstream extent_tokens(extents);
+      std::string extent;
+      while (std::getline(extent_tokens, extent, ',')) {
+        entry.extents.push_back(extent == "*" ? -1 : parseInt(extents, extent));
+      }
+    }
+    entry.overrides.struct_size = sizeof(NvfHeuristicOverrides);
+
+    std::string token;
+    while (tokens >> token) {
+      const auto eq = token.find('=');
+      NVF_CHECK(
+          eq != std::string::npos,
+          "Expected `<field>=<value>` in heuristic table: ",
+          token);
+      const std::string key = token.substr(0, eq);
+      const int64_t value = parseInt(token, token.substr(eq + 1));
+      if (key == "sm") {
+        entry.sm = (int32_t)value;
+      } else if (key == "vectorization_factor") {
+        entry.overrides.fields |=
+            NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR;
+        entry.overrides.vectorization_factor = (int32_t)value;
+      } else if (key == "unroll_factor_inner") {
+        entry.overrides.fields |= NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_INNER;
+        entry.overrides.unroll_factor_inner = (int32_t)value;
+      } else if (key == "unroll_factor_outer") {
+        entry.overrides.fields |= NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_OUTER;
+        entry.overrides.unroll_factor_outer = (int32_t)value;
+      } else if (key == "unroll_factor_iter_dom") {
+        entry.overrides.fields |=
+            NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_ITER_DOM;
+        entry.overrides.unroll_factor_iter_dom = (int32_t)value;
+      } else {
+        NVF_THROW("Unknown field in heuristic table: ", key);
+      }
+    }
+    table.entries_.push_back(std::move(entry));
+  }
+  return table;
+}
+
+TableHeuristicPlugin TableHeuristicPlugin::fromFile(const std::string& path) {
+  std::ifstream is(path);
+  NVF_CHECK(is.good(), "Cannot open heuristic table: ", path);
+  return parse(is);
+}
+
+std::string TableHeuristicPlugin::formatEntry(
+    const NvfHeuristicProblem& problem,
+    const NvfHeuristicOverrides& overrides) {
+  std::stringstream ss;
+  ss << schedulerTypeName(problem.scheduler_type) << " ";
+  for (int32_t i = 0; i < problem.num_dims; i++) {
+    ss << (i > 0 ? "," : "") << problem.extents[i];
+  }
+  if (problem.num_dims == 0) {
+    ss << "*";
+  }
+  ss << " sm=" << problem.device_major * 10 + problem.device_minor;
+  if (overrides.fields & NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR) {
+    ss << " vectorization_factor=" << overrides.vectorization_factor;
+  }
+  if (overrides.fields & NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_INNER) {
+    ss << " unroll_factor_inner=" << overrides.unroll_factor_inner;
+  }
+  if (overrides.fields & NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_OUTER) {
+    ss << " unroll_factor_outer=" << overrides.unroll_factor_outer;
+  }
+  if (overrides.fields & NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_ITER_DOM) {
+    ss << " unroll_factor_iter_dom=" << overrides.unroll_factor_iter_dom;
+  }
+  return ss.str();
+}
+
+bool TableHeuristicPlugin::query(
+    const NvfHeuristicProblem& problem,
+    NvfHeuristicOverrides& out) const {
+  const int32_t sm = problem.device_major * 10 + problem.device_minor;
+  for (const Entry& entry : entries_) {
+    if (entry.scheduler_type != problem.scheduler_type) {
+      continue;
+    }
+    if (entry.sm != -1 && entry.sm != sm) {
+      continue;
+    }
+    if (!entry.extents.empty()) {
+      if (std::ssize(entry.extents) != problem.num_dims) {
+        continue;
+      }
+      bool matches = true;
+      for (int32_t i = 0; i < problem.num_dims; i++) {
+        if (entry.extents[i] != -1 && entry.extents[i] != problem.extents[i]) {
+          matches = false;
+          break;
+        }
+      }
+      if (!matches) {
+        continue;
+      }
+    }
+    out = entry.overrides;
+    return true;
+  }
+  return false;
+}
+
+} // namespace heuristic_plugin
+
+} // namespace nvfuser
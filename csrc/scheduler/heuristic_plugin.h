@@ -0,0 +1,136 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <scheduler/heuristic_plugin_api.h>
+#include <scheduler/pointwise_heuristic.h>
+#include <scheduler/reduction_heuristic.h>
+#include <scheduler/scheduler_types.h>
+#include <visibility.h>
+
+#include <functional>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace nvfuser {
+
+class Fusion;
+class SchedulerRuntimeInfo;
+class TensorView;
+
+namespace heuristic_plugin {
+
+//! Generalizes matmul_heuristic_plugin to the other schedulers through the C
+//! ABI in heuristic_plugin_api.h. Pointwise, reduction, inner persistent and
+//! outer persistent heuristics describe their problem with an
+//! NvfHeuristicProblem and merge the overrides a plugin returns into their
+//! PointwiseParams or ReductionParams.
+//!
+//! The overrides come from, in order of precedence,
+//!   1. the innermost HeuristicPluginGuard,
+//!   2. the shared library named by NVFUSER_HEURISTIC_PLUGIN, and
+//!   3. the table of tuned entries named by NVFUSER_HEURISTIC_TABLE. See
+//!      TableHeuristicPlugin.
+
+using QueryFunction = std::function<
+    bool(const NvfHeuristicProblem& problem, NvfHeuristicOverrides& overrides)>;
+
+//! Returns true if any source of overrides is active.
+NVF_API bool hasPlugin();
+
+//! Fills in the fields of an NvfHeuristicProblem that are common to all
+//! schedulers: extents of `reference`, data types of fusion inputs and
+//! outputs, and the target device. Returns std::nullopt if `reference` has
+//! more dimensions than the ABI can describe.
+std::optional<NvfHeuristicProblem> describeProblem(
+    SchedulerType scheduler_type,
+    Fusion* fusion,
+    SchedulerRuntimeInfo& runtime_info,
+    TensorView* reference);
+
+//! Queries the active plugin and merges valid overrides into `params`.
+//! Returns true if `params` was modified. Invalid overrides are ignored as a
+//! whole and reported with DebugDumpOption::SchedulerDebug.
+NVF_API bool updatePointwiseParams(
+    PointwiseParams* params,
+    NvfHeuristicProblem problem);
+
+//! Same as updatePointwiseParams for schedulers using ReductionParams.
+//! Persistent kernels only accept overrides that don't change how the
+//! persistent buffers are partitioned.
+NVF_API bool updateReductionParams(
+    ReductionParams* params,
+    NvfHeuristicProblem problem);
+
+//! Imitates a plugin while in scope, like
+//! matmul_heuristic_plugin::KernelConfigFactoryGuard. This is mostly for
+//! tests.
+class NVF_API HeuristicPluginGuard {
+ public:
+  explicit HeuristicPluginGuard(QueryFunction query);
+  ~HeuristicPluginGuard();
+
+  HeuristicPluginGuard(const HeuristicPluginGuard&) = delete;
+  HeuristicPluginGuard& operator=(const HeuristicPluginGuard&) = delete;
+
+ private:
+  QueryFunction prev_query_;
+};
+
+//! A built-in plugin that looks problems up in a table of tuned entries, so
+//! offline-tuned configurations can be deployed by shipping a text file. Each
+//! non-empty line is
+//!
+//!   <scheduler> <extents> [sm=<major><minor>] <field>=<value>...
+//!
+//! where <scheduler> is pointwise, reduction, inner_persistent or
+//! outer_persistent, and <extents> is a comma-separated list of extents of
+//! the reference tensor with `*` matching any extent, or a single `*`
+//! matching any rank. <field> is one of vectorization_factor,
+//! unroll_factor_inner, unroll_factor_outer and unroll_factor_iter_dom. `#`
+//! starts a comment. The first matching entry wins, e.g.,
+//!
+//!   # LayerNorm forward on H100
+//!   inner_persistent *,4096 sm=90 unroll_factor_iter_dom=2
+//!   pointwise * vectorization_factor=4 unroll_factor_inner=2
+class NVF_API TableHeuristicPlugin {
+ public:
+  static TableHeuristicPlugin parse(std::istream& is);
+  static TableHeuristicPlugin fromFile(const std::string& path);
+
+  //! Returns the entry that applies `overrides` to problems with the same
+  //! scheduler, extents and device as `problem`.
+  static std::string formatEntry(
+      const NvfHeuristicProblem& problem,
+      const NvfHeuristicOverrides& overrides);
+
+  bool query(const NvfHeuristicProblem& problem, NvfHeuristicOverrides& out)
+      const;
+
+  int64_t size() const {
+    return std::ssize(entries_);
+  }
+
+ private:
+  struct Entry {
+    int32_t scheduler_type = 0;
+    // Empty matches any rank. -1 matches any extent.
+    std::vector<int64_t> extents;
+    // -1 matches any device.
+    int32_t sm = -1;
+    NvfHeuristicOverrides overrides = {};
+  };
+
+  std::vector<Entry> entries_;
+};
+
+} // namespace heuristic_plugin
+
+} // namespace nvfuser
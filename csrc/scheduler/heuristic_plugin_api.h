@@ -0,0 +1,133 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+// This header is the C ABI between nvFuser and heuristic plugins. It must stay
+// includable from C and must not depend on any other nvFuser header, so that a
+// plugin can be built without nvFuser or PyTorch headers.
+//
+// A plugin is a shared library exporting
+//
+//   uint32_t nvfuser_heuristic_plugin_api_version(void);
+//   int32_t nvfuser_heuristic_plugin_query(
+//       const NvfHeuristicProblem* problem,
+//       NvfHeuristicOverrides* overrides);
+//
+// Set NVFUSER_HEURISTIC_PLUGIN=/path/to/libfoo.so to load it. For every
+// fusion segment scheduled by a supported scheduler, nvFuser fills in
+// `problem`, zero-initializes `overrides` except for `struct_size`, and calls
+// nvfuser_heuristic_plugin_query. The plugin returns nonzero if it set any
+// override. An override takes effect only if its bit is set in
+// `overrides->fields`. nvFuser validates the overrides against the problem and
+// ignores all of them if any is invalid, so a plugin can't make nvFuser
+// generate an incorrect kernel.
+//
+// Both structs start with `struct_size`. New fields are only ever appended
+// and NVFUSER_HEURISTIC_PLUGIN_API_VERSION is bumped whenever the layout or
+// the meaning of a field changes. A plugin built against a different version
+// is rejected when loaded.
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NVFUSER_HEURISTIC_PLUGIN_API_VERSION 1
+
+#define NVFUSER_HEURISTIC_PLUGIN_MAX_DIMS 8
+#define NVFUSER_HEURISTIC_PLUGIN_MAX_TENSORS 16
+
+// Values of NvfHeuristicProblem::scheduler_type. These are fixed by the ABI
+// and independent of nvfuser::SchedulerType.
+#define NVFUSER_HEURISTIC_PLUGIN_POINTWISE 1
+#define NVFUSER_HEURISTIC_PLUGIN_REDUCTION 2
+#define NVFUSER_HEURISTIC_PLUGIN_INNER_PERSISTENT 3
+#define NVFUSER_HEURISTIC_PLUGIN_OUTER_PERSISTENT 4
+
+// Bits of NvfHeuristicOverrides::fields.
+#define NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR (1u << 0)
+#define NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_INNER (1u << 1)
+#define NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_OUTER (1u << 2)
+#define NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_ITER_DOM (1u << 3)
+
+typedef struct NvfHeuristicProblem {
+  uint32_t struct_size;
+  int32_t scheduler_type;
+
+  // Extents of the reference tensor's logical domain, outermost first,
+  // including reduction dimensions. Only the first `num_dims` are valid.
+  // Fusions with more dimensions are not sent to the plugin.
+  int32_t num_dims;
+  int64_t extents[NVFUSER_HEURISTIC_PLUGIN_MAX_DIMS];
+
+  // Data types of fusion inputs and outputs using the letters of the matmul
+  // plugin's precision string, e.g., 'H' for Half and 'S' for Float. Other
+  // types are 'b' for Bool, 'L' for Int (64-bit) and '?' for anything else.
+  // Only the first NVFUSER_HEURISTIC_PLUGIN_MAX_TENSORS are listed.
+  int32_t num_inputs;
+  char input_dtypes[NVFUSER_HEURISTIC_PLUGIN_MAX_TENSORS];
+  int32_t num_outputs;
+  char output_dtypes[NVFUSER_HEURISTIC_PLUGIN_MAX_TENSORS];
+
+  // Largest vectorization factor that is legal for this problem. Overrides
+  // must not exceed it.
+  int32_t max_vectorization_factor;
+  // Largest size in bytes of a vectorized tensor's data type.
+  int32_t max_dtype_size;
+
+  // Reduction problems only. The problem is viewed as an iteration domain
+  // of `total_iteration_numel` elements times a reduction domain of
+  // `total_reduction_numel` elements.
+  int64_t total_reduction_numel;
+  int64_t total_iteration_numel;
+  int64_t inner_most_dimension_numel;
+  int32_t fastest_dim_reduction;
+
+  // Persistent problems only. Bytes of the largest persistent buffer per
+  // reduction, i.e., what has to stay in registers or shared memory.
+  int64_t persistent_buffer_bytes;
+
+  // The target device. See nvfuser::TargetDevice.
+  int32_t device_major;
+  int32_t device_minor;
+  int32_t device_multi_processor_count;
+
+  // The parameters nvFuser's own heuristic chose. Plugins can use these as a
+  // starting point.
+  int32_t default_vectorization_factor;
+  int32_t default_unroll_factor_inner;
+  int32_t default_unroll_factor_outer;
+  int32_t default_unroll_factor_iter_dom;
+} NvfHeuristicProblem;
+
+typedef struct NvfHeuristicOverrides {
+  uint32_t struct_size;
+  // A bitmask of NVFUSER_HEURISTIC_PLUGIN_* fields that are set.
+  uint32_t fields;
+  // Pointwise: PointwiseParams::vectorization_factor. Reduction: the factor
+  // of whichever dimension the heuristic vectorized.
+  int32_t vectorization_factor;
+  // Pointwise only: PointwiseParams::unroll_factor_inner.
+  int32_t unroll_factor_inner;
+  // Pointwise: PointwiseParams::unroll_factor_outer, which requires a 2D
+  // schedule. Reduction: ReductionParams::unroll_factor_outer_reduction.
+  int32_t unroll_factor_outer;
+  // Reduction only: ReductionParams::unroll_factor_iter_dom of a
+  // non-vectorized iteration domain.
+  int32_t unroll_factor_iter_dom;
+} NvfHeuristicOverrides;
+
+typedef uint32_t (*NvfHeuristicPluginVersionFn)(void);
+typedef int32_t (*NvfHeuristicPluginQueryFn)(
+    const NvfHeuristicProblem*,
+    NvfHeuristicOverrides*);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -25,6 +25,7 @@
 // NOTE: included to avoid compilation error caused by missing destructor in
 // 'SchedulerRuntimeInfo'
 #include <runtime/executor_utils.h>
+#include <target_device.h>
 #include "mma_type.h"
 
 namespace nvfuser {
@@ -447,7 +448,7 @@ AbstractTensor swizzleSharedMemory(TensorView* shared_mem_tv) {
 
 namespace schedule_matmul {
 void AmpereMinus::validate() const {
-  const auto device_prop = at::cuda::getCurrentDeviceProperties();
+  const auto device_prop = getTargetDeviceProperties();
   const int cc = device_prop->major * 10 + device_prop->minor;
   NVF_ERROR(
       cc >= 75 && cc < 90,
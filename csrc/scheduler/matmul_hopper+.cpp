@@ -26,6 +26,7 @@
 // NOTE: included to avoid compilation error caused by missing destructor in
 // 'SchedulerRuntimeInfo'
 #include <runtime/executor_utils.h>
+#include <target_device.h>
 #include "mma_type.h"
 
 namespace nvfuser {
@@ -129,7 +130,7 @@ MatmulDimRole HopperPlus::findMatmulDimRole(IterDomain* id) {
 }
 
 void HopperPlus::validate() const {
-  const auto device_prop = at::cuda::getCurrentDeviceProperties();
+  const auto device_prop = getTargetDeviceProperties();
   const int cc = device_prop->major * 10 + device_prop->minor;
   NVF_ERROR(
       cc >= 90, "This matmul scheduler is restricted to Hopper & Blackwell.");
@@ -601,8 +602,7 @@ std::vector<std::vector<MatmulDimRole>> HopperPlus::blockTileTensors(
 }
 
 int64_t HopperPlus::numCGAs() const {
-  const int64_t num_sms =
-      at::cuda::getCurrentDeviceProperties()->multiProcessorCount;
+  const int64_t num_sms = getTargetDeviceProperties()->multiProcessorCount;
   return num_sms /
       (params_->cluster_dims.x * params_->cluster_dims.y *
        params_->cluster_dims.z);
@@ -24,6 +24,7 @@
 #include <options.h>
 #include <runtime/executor_utils.h>
 #include <scheduler/mma_utils.h>
+#include <target_device.h>
 #include <type.h>
 #include <utils.h>
 #include <val_graph.h>
@@ -134,8 +135,7 @@ void limitCircularBufferingSmemOperands(
     const int64_t tiles_n = ceilDiv(
         problem_shape[(size_t)MatmulDimRole::N],
         mparams->tile_sizes.cta_tile.n);
-    const int64_t num_sms =
-        at::cuda::getCurrentDeviceProperties()->multiProcessorCount;
+    const int64_t num_sms = getTargetDeviceProperties()->multiProcessorCount;
     // NOTE: we don't account for swizzle here which might increase this number
     // in rare cases
     num_tiles_per_cta = ceilDiv(tiles_m * tiles_n, num_sms);
@@ -292,8 +292,7 @@ void fillOptimalHopperTileSizes(
     // is how we model it. Note that we also do not model L2 locality here at
     // all, so this number is meant as a very rough estimate of compute time for
     // memory-bound problems.
-    const int64_t num_sms =
-        at::cuda::getCurrentDeviceProperties()->multiProcessorCount;
+    const int64_t num_sms = getTargetDeviceProperties()->multiProcessorCount;
     const int64_t num_waves = ceilDiv(tiles_m * tiles_n, num_sms);
     return num_waves * num_sms * bytes_per_output_tile;
   };
@@ -321,7 +320,7 @@ void fillOptimalHopperTileSizes(
         // Don't consider cases where we would need fewer than 3 load stages due
         // to smem constraint
         const int64_t smem_bytes =
-            at::cuda::getCurrentDeviceProperties()->sharedMemPerBlockOptin;
+            getTargetDeviceProperties()->sharedMemPerBlockOptin;
         if (bytes_per_stage * 3L > smem_bytes - reserved_mbarrier_bytes) {
           continue;
         }
@@ -373,7 +372,7 @@ void maximizeHopperOperandStages(
 
   // We leave a bit of space for semaphores.
   int64_t max_operand_smem =
-      (int64_t)at::cuda::getCurrentDeviceProperties()->sharedMemPerBlockOptin;
+      (int64_t)getTargetDeviceProperties()->sharedMemPerBlockOptin;
   // TODO: subtract additional space such as mbarriers used to synchronize the
   // epilogue in ping-pong
   if (mparams->tiling_strategy != MatmulParams::TilingStrategy::OneTilePerCTA) {
@@ -1057,7 +1056,7 @@ std::unique_ptr<MatmulParams> getMatmulHeuristics(
 
   const auto problem_shape = getProblemShape(id_roles, runtime_info);
 
-  const auto device_prop = at::cuda::getCurrentDeviceProperties();
+  const auto device_prop = runtime_info.deviceProperties();
   const auto mma_op =
       getMmaOp(device_prop->major * 10 + device_prop->minor, problem_shape);
   NVF_ERROR(
@@ -1229,7 +1228,7 @@ std::string getMatmulCompileTimeRejectReason(Fusion* fusion) {
   // scheduler.
   // 6. Check if the fusion is resharding.
 
-  const auto device_prop = at::cuda::getCurrentDeviceProperties();
+  const auto device_prop = getTargetDeviceProperties();
 
   // #0
   {
@@ -1358,7 +1357,7 @@ std::string getMatmulRunTimeRejectReason(
   // On Hopper, we use TMA to load operands. Since TMA requires each coordinate
   // of the input to be represented with a 32-bit signed int, we will encounter
   // overflow if any dimension of an operand is larger than that.
-  const auto device_prop = at::cuda::getCurrentDeviceProperties();
+  const auto device_prop = runtime_info.deviceProperties();
   if (device_prop->major == 9) {
     for (Val* inp : fusion->inputs()) {
       if (auto* tv = dynamic_cast<TensorView*>(inp)) {
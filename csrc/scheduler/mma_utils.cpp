@@ -21,6 +21,7 @@
 #include <scheduler/mma_utils.h>
 #include <scheduler/tools/abstract_tensor.h>
 #include <scheduler/utils.h>
+#include <target_device.h>
 #include <type.h>
 #include <val_graph.h>
 #include <variant>
@@ -51,7 +52,7 @@ std::tuple<int64_t, int64_t, int64_t> computeSharedMemorySizes(
     const MatMulTileOptions& gemm_tile,
     const MatmulParams::CircularBufferOptions& circular_buffer_options,
     const MmaDataTypes& data_types) {
-  const auto properties = at::cuda::getCurrentDeviceProperties();
+  const auto properties = getTargetDeviceProperties();
 
   auto warp_dims = gemm_tile.cta_tile / gemm_tile.warp_tile;
 
@@ -156,7 +157,7 @@ std::pair<bool, bool> generateSharedMemoryEpilogueHeuristics(
   // use additional shared memory for epilogue if occupancy is not changed.
   // occupancy is estimated using register and shared memory usage.
   auto warp_dims = gemm_tile.cta_tile / gemm_tile.warp_tile;
-  const auto warp_size = at::cuda::getCurrentDeviceProperties()->warpSize;
+  const auto warp_size = getTargetDeviceProperties()->warpSize;
   const auto threads_per_block =
       warp_dims.m * warp_dims.n * warp_dims.k * warp_size;
   const auto threads_per_sm = getThreadsPerSMGivenRegPerThread(255);
@@ -79,12 +79,12 @@ std::pair<int64_t, int64_t> getPersistentBufferSize(
 // Para [target_warps_per_sm]: required occupancy to saturate memory bandwidth.
 // Para [register_overhead]: registers except those for persistent buffers.
 std::pair<int64_t, int64_t> getMaxRegisterCountPerThreadAndOccupancy(
+    const cudaDeviceProp* dev_prop,
     const int64_t buffer_size_per_thread,
     const int64_t threads_per_block,
     const int64_t target_warps_per_sm,
     const int64_t register_overhead) {
   // convert [target_warps_per_sm] to [target_blocks_per_sm]
-  const auto dev_prop = at::cuda::getCurrentDeviceProperties();
   const int64_t threads_per_warp = dev_prop->warpSize;
   const int64_t max_threads_per_sm = dev_prop->maxThreadsPerMultiProcessor;
   // ensure higher than target by round up
@@ -183,6 +183,7 @@ struct NormInnerParams {
 };
 
 NormInnerParams getNormInnerParamsGivenPerisisentBatchSize(
+    const cudaDeviceProp* dev_prop,
     const int64_t reduction_count_after_vectorize,
     const int64_t total_iteration_numel,
     const int64_t max_multi_reduction_factor,
@@ -191,7 +192,6 @@ NormInnerParams getNormInnerParamsGivenPerisisentBatchSize(
     const int64_t target_warps_per_sm,
     const int64_t register_overhead,
     const int64_t persistent_batch_size) {
-  const auto dev_prop = at::cuda::getCurrentDeviceProperties();
   auto device_warp_size = dev_prop->warpSize;
   auto max_threads_per_block = dev_prop->maxThreadsPerBlock;
   auto sm_count = dev_prop->multiProcessorCount;
@@ -223,6 +223,7 @@ NormInnerParams getNormInnerParamsGivenPerisisentBatchSize(
   int64_t persistent_buffer_size =
       buffer_bytes_per_batch * persistent_batch_size;
   auto reg_occ = getMaxRegisterCountPerThreadAndOccupancy(
+      dev_prop,
       persistent_buffer_size,
       threads_per_block,
       target_warps_per_sm,
@@ -347,6 +348,7 @@ bool compareTwoHeuristics(
 // This sequence ensures meeting target occupancy, promotes even workload
 // distribution, enhances register optimization, and prefers higher occupancy.
 void innerPersistentHeuristic2D(
+    const cudaDeviceProp* dev_prop,
     const PersistentKernelProperties& properties,
     ReductionParams* rparams) {
   bool is_high_bandwidth_flops_ratio =
@@ -381,8 +383,6 @@ void innerPersistentHeuristic2D(
       is_high_bandwidth_flops_ratio && disable_project_to_avoid_recompute ? 16l
                                                                           : 28l;
 
-  // device properties
-  const auto dev_prop = at::cuda::getCurrentDeviceProperties();
   const int64_t threads_per_warp = (int64_t)dev_prop->warpSize;
   const int64_t max_threads_in_block = (int64_t)dev_prop->maxThreadsPerBlock;
   const int64_t max_threads_per_sm =
@@ -441,6 +441,7 @@ void innerPersistentHeuristic2D(
        pbs <= batches_per_block_inner_reduction_max;
        pbs++) {
     all_heuristics.push_back(getNormInnerParamsGivenPerisisentBatchSize(
+        dev_prop,
         parallel_after_vectorize,
         properties.total_iteration_numel,
         max_multi_reduction_factor,
@@ -527,9 +528,9 @@ void innerPersistentHeuristic2D(
 }
 
 void innerPersistentHeuristicSharedMemory(
+    const cudaDeviceProp* dev_prop,
     const PersistentKernelProperties& properties,
     ReductionParams* rparams) {
-  const auto dev_prop = at::cuda::getCurrentDeviceProperties();
   // Inner reduction domain
   // This heuristic is only used for cases with large total_reduction_numel.
   // e.g. layer_norm with hidden size larger than 64K for fp16 or 32K for fp32.
@@ -570,6 +571,7 @@ void innerPersistentHeuristicSharedMemory(
 
 // TODO: clean and revise the heuristics
 void innerPersistentHeuristic3D(
+    const cudaDeviceProp* dev_prop,
     const PersistentKernelProperties& properties,
     ReductionParams* rparams) {
   // Define two free parameters used in this heuristic.
@@ -593,9 +595,6 @@ void innerPersistentHeuristic3D(
   const int64_t outer_reduction_numel =
       properties.total_reduction_numel / properties.inner_most_dimension_numel;
 
-  const auto dev_prop = at::cuda::getCurrentDeviceProperties();
-  // WARNING: At some point we may want to generate heuristics for another
-  // device that is not the current device.
   const int64_t device_max_threads_per_multiprocessor =
       (int64_t)dev_prop->maxThreadsPerMultiProcessor;
 
@@ -988,6 +987,7 @@ void innerPersistentHeuristic3D(
 
     // Calculate the max register count each thread can use.
     nvrtc_register_per_thread = getMaxRegisterCountPerThreadAndOccupancy(
+                                    dev_prop,
                                     persistent_buffer_size,
                                     threads_per_block,
                                     target_warps_per_sm,
@@ -1066,6 +1066,8 @@ std::unique_ptr<ReductionParams> getInnerPersistentHeuristics(
           data_cache,
           InnerPersistentKernelScheduler::schedulerType());
 
+  const cudaDeviceProp* dev_prop = runtime_info.deviceProperties();
+
   std::unique_ptr<ReductionParams> rparams = std::make_unique<ReductionParams>(
       InnerPersistentKernelScheduler::schedulerType());
 
@@ -1081,15 +1083,18 @@ std::unique_ptr<ReductionParams> getInnerPersistentHeuristics(
     // all persistent buffers are moved to shared memory
     // TODO: allow only part of the buffers to be moved to shared memory
     rparams->smem_persistent_buffers = prop.persistent_buffers;
-    innerPersistentHeuristicSharedMemory(prop, rparams.get());
+    innerPersistentHeuristicSharedMemory(dev_prop, prop, rparams.get());
   } else if (prop.total_reduction_numel == prop.inner_most_dimension_numel) {
     rparams->tag = "2D Register Inner Persistent Heuristic.\n";
-    innerPersistentHeuristic2D(prop, rparams.get());
+    innerPersistentHeuristic2D(dev_prop, prop, rparams.get());
   } else {
     rparams->tag = "3D Register Inner Persistent Heuristic.\n";
-    innerPersistentHeuristic3D(prop, rparams.get());
+    innerPersistentHeuristic3D(dev_prop, prop, rparams.get());
   }
 
+  normalization_scheduler_utils::applyHeuristicPlugin(
+      fusion, runtime_info, data_cache, prop, rparams.get());
+
   // debug print
   if (isDebugDumpEnabled(DebugDumpOption::SchedulerDebug)) {
     debug() << prop.toString() << std::endl;
@@ -1125,7 +1130,7 @@ bool InnerPersistentKernelScheduler::canScheduleRunTime(
   auto properties = scheduler_utils::getReductionProperties(
       fusion, runtime_info, reference_tv);
 
-  const int64_t warp_size = at::cuda::getCurrentDeviceProperties()->warpSize;
+  const int64_t warp_size = runtime_info.deviceProperties()->warpSize;
 
   // check reduction properties, don't use shared memory persistent if 3D
   // reduction
@@ -1139,7 +1144,7 @@ bool InnerPersistentKernelScheduler::canScheduleRunTime(
   const int64_t available_persistent_buffer_size = buffer_size.second;
 
   const int64_t device_multiprocessor_count =
-      (int64_t)at::cuda::getCurrentDeviceProperties()->multiProcessorCount;
+      (int64_t)runtime_info.deviceProperties()->multiProcessorCount;
 
   if (persistent_buffer_size > available_persistent_buffer_size) {
     scheduler_debug_utils::canScheduleRejectReason(
@@ -1152,8 +1157,7 @@ bool InnerPersistentKernelScheduler::canScheduleRunTime(
   }
 
   const int64_t device_max_threads_per_multiprocessor =
-      (int64_t)at::cuda::getCurrentDeviceProperties()
-          ->maxThreadsPerMultiProcessor;
+      (int64_t)runtime_info.deviceProperties()->maxThreadsPerMultiProcessor;
 
   const int64_t required_sm_per_norm =
       ceilDiv(persistent_buffer_size, scheduler_utils::register_file_size);
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 // clang-format on
+#include <id_graph_cache.h>
 #include <instrumentation.h>
 #include <options.h>
 #include <scheduler/debug_utils.h>
@@ -224,8 +225,8 @@ bool InnerOuterPersistentKernelScheduler::canScheduleCompileTime(
   }
 
   if (!ir_utils::getViewOps(fusion).empty()) {
-    ComputeAtMap ca_map(fusion);
-    if (registry_utils::requiresForwardViewReplay(fusion, ca_map)) {
+    std::shared_ptr<ComputeAtMap> ca_map = cachedComputeAtMap(fusion);
+    if (registry_utils::requiresForwardViewReplay(fusion, *ca_map)) {
       scheduler_debug_utils::canScheduleRejectReason(
           schedulerType(), "Fusion requires view being reversible.");
       return false;
@@ -340,7 +341,7 @@ bool InnerOuterPersistentKernelScheduler::canScheduleRunTime(
   auto properties = scheduler_utils::getReductionProperties(
       fusion, runtime_info, reference_tv);
 
-  const int64_t warp_size = at::cuda::getCurrentDeviceProperties()->warpSize;
+  const int64_t warp_size = runtime_info.deviceProperties()->warpSize;
 
   auto reduced_tv = ir_utils::getSoleProducerTv(reference_tv);
   const auto vectorize_factor = vectorize_helper::getVectorizationFactor(
@@ -378,7 +379,7 @@ bool InnerOuterPersistentKernelScheduler::canScheduleRunTime(
           hp.is_warp_specialized);
 
   const int64_t device_multiprocessor_count =
-      (int64_t)at::cuda::getCurrentDeviceProperties()->multiProcessorCount;
+      (int64_t)runtime_info.deviceProperties()->multiProcessorCount;
 
   if (!buffer_params.has_enough_regs_and_smem) {
     scheduler_debug_utils::canScheduleRejectReason(
@@ -388,8 +389,7 @@ bool InnerOuterPersistentKernelScheduler::canScheduleRunTime(
   }
 
   const int64_t device_max_threads_per_multiprocessor =
-      (int64_t)at::cuda::getCurrentDeviceProperties()
-          ->maxThreadsPerMultiProcessor;
+      (int64_t)runtime_info.deviceProperties()->maxThreadsPerMultiProcessor;
 
   const int64_t required_sm_per_norm = ceilDiv(
       buffer_params.regs_buffer_size, scheduler_utils::register_file_size);
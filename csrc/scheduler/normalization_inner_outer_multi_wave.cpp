@@ -9,6 +9,7 @@
 #include <scheduler/normalization_utils.h>
 #include <scheduler/runtime_info.h>
 #include <scheduler/tools/inlining.h>
+#include <target_device.h>
 
 #include <ATen/cuda/CUDAContext.h>
 
@@ -49,7 +50,7 @@ void getHeuristics(
     const PrimDataType index_type) {
   rparams->project_persistent_buffers = project_to_input;
   rparams->cparams.index_type = index_type;
-  const auto dev_prop = at::cuda::getCurrentDeviceProperties();
+  const auto dev_prop = getTargetDeviceProperties();
   const int64_t device_multiprocessor_count =
       (int64_t)dev_prop->multiProcessorCount;
   // Parameters for inner reduction:
@@ -10,6 +10,7 @@
 #include <scheduler/normalization_utils.h>
 #include <scheduler/runtime_info.h>
 #include <scheduler/tools/inlining.h>
+#include <target_device.h>
 
 #include <ATen/cuda/CUDAContext.h>
 namespace nvfuser {
@@ -30,7 +31,7 @@ void getHeuristics(
   rparams->tma_warp_specialized = true;
   rparams->project_persistent_buffers = project_to_input;
   rparams->cparams.index_type = index_type;
-  const auto dev_prop = at::cuda::getCurrentDeviceProperties();
+  const auto dev_prop = getTargetDeviceProperties();
   const int64_t sm_count = (int64_t)dev_prop->multiProcessorCount;
 
   // Params for 1st stage, inner reduction and partial outer reduction.
@@ -181,7 +181,7 @@ PersistentBufferStorageParams getPersistentBufferStorageParams(
        normalization_scheduler_utils::BufferProjectionStrategy::
            ProjectToInputs);
 
-  const auto dev_prop = at::cuda::getCurrentDeviceProperties();
+  const auto dev_prop = runtime_info.deviceProperties();
   int64_t smem_overhead = scheduler_utils::getReductionSmemWorkspace(
       fusion, reduction_tvs, threads_per_block_max);
   int64_t available_smem =
@@ -14,6 +14,7 @@
 #include <scheduler/registry_utils.h>
 #include <scheduler/runtime_info.h>
 #include <scheduler/utils.h>
+#include <target_device.h>
 
 #include <ATen/cuda/CUDAContext.h>
 
@@ -148,7 +149,7 @@ std::unique_ptr<ReductionParams> outerPersistentHeuristic(
     const PrimDataType index_type) {
   // Set some targets for parallelization
   const int64_t n_elems = total_reduction_numel * total_iteration_numel;
-  const auto dev_prop = at::cuda::getCurrentDeviceProperties();
+  const auto dev_prop = getTargetDeviceProperties();
 
   const int64_t device_multiprocessor_count =
       (int64_t)dev_prop->multiProcessorCount;
@@ -432,6 +433,8 @@ std::unique_ptr<ReductionParams> getOuterPersistentHeuristics(
       prop.vectorize_factor,
       prop.project_persistent_buffers,
       prop.index_type);
+  normalization_scheduler_utils::applyHeuristicPlugin(
+      fusion, runtime_info, data_cache, prop, rparams.get());
   return rparams;
 }
 
@@ -469,7 +472,7 @@ bool OuterPersistentKernelScheduler::canScheduleRunTime(
   auto properties = scheduler_utils::getReductionProperties(
       fusion, runtime_info, reduction_tvs[0]);
 
-  const auto device_prop = at::cuda::getCurrentDeviceProperties();
+  const auto device_prop = runtime_info.deviceProperties();
 
   const int64_t sm_register_file_size =
       static_cast<int64_t>(device_prop->regsPerBlock * sizeof(int));
@@ -7,11 +7,13 @@
 // clang-format on
 #include <expr_evaluator.h>
 #include <grouped_reduction.h>
+#include <id_graph_cache.h>
 #include <id_model/id_model.h>
 #include <instrumentation.h>
 #include <iter_visitor.h>
 #include <scheduler/cache_policy_refiner.h>
 #include <scheduler/debug_utils.h>
+#include <scheduler/heuristic_plugin.h>
 #include <scheduler/normalization_utils.h>
 #include <scheduler/reduction_utils.h>
 #include <scheduler/registry_utils.h>
@@ -19,6 +21,7 @@
 #include <scheduler/tools/domain_map.h>
 #include <scheduler/tools/inlining.h>
 #include <scheduler/utils.h>
+#include <target_device.h>
 #include <utils.h>
 #include <val_graph_visitor.h>
 
@@ -70,8 +73,7 @@ bool PreferredLaunchConfig::setBdimx(int bdimx, bool dry_run) {
 // 36), (2, 54)].
 void PreferredLaunchConfig::initValidGdims() {
   std::vector<std::pair<int, int>> grid_dims;
-  const int num_sms =
-      at::cuda::getCurrentDeviceProperties()->multiProcessorCount;
+  const int num_sms = getTargetDeviceProperties()->multiProcessorCount;
   const int max_first_half =
       static_cast<int>(std::sqrt(static_cast<float>(num_sms)));
   for (int gdimy = 2; gdimy <= max_first_half; ++gdimy) {
@@ -464,8 +466,8 @@ std::optional<GridOuterNormalizationParams> getGridOuterNormalizationParams(
     int64_t adjusted_gdimy = -1;
     int64_t adjusted_buffer_size = -1;
     bool last_block_work_reduced = false;
-    const auto major_ver = at::cuda::getCurrentDeviceProperties()->major;
-    const auto minor_ver = at::cuda::getCurrentDeviceProperties()->minor;
+    const auto major_ver = getTargetDeviceProperties()->major;
+    const auto minor_ver = getTargetDeviceProperties()->minor;
     if (major_ver == 7 && minor_ver == 5) {
       adjusted_gdimy = launch_cfg.gdimy();
       adjusted_buffer_size = getMinPersistentBufferSize(
@@ -706,6 +708,40 @@ SchedulerType getPersistentHeuristicFor(ReductionType reduction_type) {
   }
 }
 
+void applyHeuristicPlugin(
+    Fusion* fusion,
+    SchedulerRuntimeInfo& runtime_info,
+    HeuristicDataCache* data_cache,
+    const PersistentKernelProperties& properties,
+    ReductionParams* rparams) {
+  if (!heuristic_plugin::hasPlugin()) {
+    return;
+  }
+  auto reduction_tv_entry =
+      HeuristicDataCacheEntry<HeuristicCompileTime::ReductionTVs>(
+          data_cache, [&fusion]() {
+            return std::make_unique<std::vector<TensorView*>>(
+                scheduler_utils::getReductionTvs(fusion));
+          });
+  auto problem = heuristic_plugin::describeProblem(
+      rparams->scheduler_type,
+      fusion,
+      runtime_info,
+      reduction_tv_entry.get().at(0));
+  if (!problem.has_value()) {
+    return;
+  }
+  problem->max_vectorization_factor = (int32_t)std::min(
+      properties.vectorize_factor, 16 / properties.max_dtype_size);
+  problem->max_dtype_size = (int32_t)properties.max_dtype_size;
+  problem->total_reduction_numel = properties.total_reduction_numel;
+  problem->total_iteration_numel = properties.total_iteration_numel;
+  problem->inner_most_dimension_numel = properties.inner_most_dimension_numel;
+  problem->fastest_dim_reduction = rparams->fastest_dim;
+  problem->persistent_buffer_bytes = properties.max_persistent_buffer_size;
+  heuristic_plugin::updateReductionParams(rparams, *problem);
+}
+
 void checkReductionTvForScheduling(Fusion* fusion, TensorView* ref_red_tv) {
   NVF_ERROR(ref_red_tv != nullptr, "Reduction TensorView wasn't found.");
   NVF_ERROR(ref_red_tv->hasReduction(), "TensorView doesn't have a reduction.");
@@ -728,7 +764,7 @@ namespace {
 // counted as roundup overhead. This function estimates the maximum possible
 // shared memory size due to this round up.
 int64_t roundUpSharedMemory(int64_t tv_buffer_size, int64_t data_type_size) {
-  auto dev_prop = at::cuda::getCurrentDeviceProperties();
+  auto dev_prop = getTargetDeviceProperties();
   int64_t max_threads_per_block = (int64_t)dev_prop->maxThreadsPerBlock;
   int64_t max_smem = 0;
   int64_t max_vectorize_factor =
@@ -791,7 +827,7 @@ int64_t getMaxRegOrSharedMemorySizeForPersistentBuffer(
   if (!can_use_smem_persistent) {
     return available_persistent_buffer_size;
   }
-  const auto dev_prop = at::cuda::getCurrentDeviceProperties();
+  const auto dev_prop = runtime_info.deviceProperties();
   int64_t smem_overhead =
       scheduler_utils::getReductionSmemWorkspace(fusion, reduction_tvs);
 
@@ -1192,8 +1228,8 @@ bool compileTimeCheck(Fusion* fusion, SchedulerType scheduler_type) {
   }
 
   if (!ir_utils::getViewOps(fusion).empty()) {
-    ComputeAtMap ca_map(fusion);
-    if (registry_utils::requiresForwardViewReplay(fusion, ca_map)) {
+    std::shared_ptr<ComputeAtMap> ca_map = cachedComputeAtMap(fusion);
+    if (registry_utils::requiresForwardViewReplay(fusion, *ca_map)) {
       scheduler_debug_utils::canScheduleRejectReason(
           scheduler_type, "Fusion requires view being reversible.");
       return false;
@@ -1296,7 +1332,7 @@ std::vector<TensorView*> movePersistentBufferToSmem(
   };
   auto supportCpAsync = [rparams](const TensorView* smem_tv) {
     // Only supported after device 8.0
-    int hw_major = at::cuda::getCurrentDeviceProperties()->major;
+    int hw_major = getTargetDeviceProperties()->major;
     if (hw_major < 8) {
       return false;
     }
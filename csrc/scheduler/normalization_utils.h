@@ -238,6 +238,15 @@ PersistentKernelProperties getPersistentKernelProperties(
     HeuristicDataCache* data_cache,
     SchedulerType heuristic);
 
+// Lets the heuristic plugin, if any, override `rparams`, which were computed
+// from `properties`. See scheduler/heuristic_plugin.h.
+void applyHeuristicPlugin(
+    Fusion* fusion,
+    SchedulerRuntimeInfo& runtime_info,
+    HeuristicDataCache* data_cache,
+    const PersistentKernelProperties& properties,
+    ReductionParams* rparams);
+
 // Verify the presence of a reduction TensorView connected to a Fusion input
 void checkReductionTvForScheduling(Fusion* fusion, TensorView* ref_red_tv);
 
@@ -8,11 +8,13 @@
 
 #include <ATen/cuda/CUDAContext.h>
 #include <debug.h>
+#include <id_graph_cache.h>
 #include <instrumentation.h>
 #include <ir/printer.h>
 #include <multidevice/utils.h>
 #include <scheduler/cache_policy_refiner.h>
 #include <scheduler/debug_utils.h>
+#include <scheduler/heuristic_plugin.h>
 #include <scheduler/mark_aliases.h>
 #include <scheduler/pointwise.h>
 #include <scheduler/reduction_utils.h>
@@ -21,6 +23,7 @@
 #include <scheduler/tools/inlining.h>
 #include <scheduler/utils.h>
 #include <scheduler/vectorize_helper.h>
+#include <target_device.h>
 
 namespace nvfuser {
 
@@ -92,7 +95,7 @@ int64_t getEmpiricalUnrollFactor(
   if (vectorizable_inputs.empty()) {
     return 1;
   }
-  const auto dev_prop = at::cuda::getCurrentDeviceProperties();
+  const auto dev_prop = getTargetDeviceProperties();
   // calculate the required bytes in flight to cover the latency.
   // assuming 100% occupancy.
   int64_t required_bytes_per_thread =
@@ -116,7 +119,7 @@ int64_t getEmpiricalUnrollFactor(
 // calculate unroll factor based on total blocks to ensure we still
 // have 8 waves after unroll.
 int64_t getElementBasedUnrollFactor(int64_t total_blocks) {
-  const auto dev_prop = at::cuda::getCurrentDeviceProperties();
+  const auto dev_prop = getTargetDeviceProperties();
   const int64_t target_waves = 8L;
   int64_t max_block_per_sm =
       (int64_t)dev_prop->maxThreadsPerMultiProcessor / kThreadX;
@@ -206,7 +209,7 @@ std::unique_ptr<PointwiseParams> getPointwiseHeuristics(
   NVF_ERROR(largest_out != nullptr);
 
   const auto device_multiprocessor_count = static_cast<int64_t>(
-      at::cuda::getCurrentDeviceProperties()->multiProcessorCount);
+      runtime_info.deviceProperties()->multiProcessorCount);
 
   auto reorder_map_entry =
       HeuristicDataCacheEntry<HeuristicCompileTime::LogicalReorderMap>(
@@ -373,7 +376,7 @@ std::unique_ptr<PointwiseParams> getPointwiseHeuristics(
     if (n_elems * 2 > device_multiprocessor_count * kThreadX) {
       int64_t min_total_transfer = std::numeric_limits<int64_t>::max();
       int64_t threads_per_warp =
-          (int64_t)at::cuda::getCurrentDeviceProperties()->warpSize;
+          (int64_t)runtime_info.deviceProperties()->warpSize;
       // Don't check the inner most dimension, scheduler assumes there's always
       // an rhs
       for (const auto break_point_i : arange((int64_t)ref_loop.size())) {
@@ -425,14 +428,14 @@ std::unique_ptr<PointwiseParams> getPointwiseHeuristics(
         // Need to be able to parallelize, don't use break if there's not
         // at least an unrolled warp.
         if (ceilDiv(cur_right_elem_count, max_vect_factor) <=
-            at::cuda::getCurrentDeviceProperties()->warpSize) {
+            runtime_info.deviceProperties()->warpSize) {
           continue;
         }
 
         // If outer broadcast, or balanced broadcast:
         if (lhs_byte_multiple <= rhs_byte_multiple &&
             // If right transfer size is bigger than half of L2
-            at::cuda::getCurrentDeviceProperties()->l2CacheSize <
+            runtime_info.deviceProperties()->l2CacheSize <
                 right_transfer_size * 2) {
           // flip BIDx and BIDy bindings
           flip_grid_binding = true;
@@ -466,10 +469,9 @@ std::unique_ptr<PointwiseParams> getPointwiseHeuristics(
     }
   }
 
-  params->vectorization_factor = std::min(
-      max_vect_factor,
-      vectorize_helper::getVectorizationFactor(
-          runtime_info, largest_out, data_cache, break_point, reorder_map));
+  const int64_t legal_vect_factor = vectorize_helper::getVectorizationFactor(
+      runtime_info, largest_out, data_cache, break_point, reorder_map);
+  params->vectorization_factor = std::min(max_vect_factor, legal_vect_factor);
 
   // get unroll factor:
 
@@ -492,12 +494,23 @@ std::unique_ptr<PointwiseParams> getPointwiseHeuristics(
   } else {
     params->unroll_factor_inner = unroll_factor;
   }
+  params->break_point = break_point;
+
+  if (heuristic_plugin::hasPlugin()) {
+    if (auto problem = heuristic_plugin::describeProblem(
+            SchedulerType::PointWise, fusion, runtime_info, largest_out)) {
+      problem->max_vectorization_factor = (int32_t)std::min(
+          legal_vect_factor, kSixteen / max_dtype_size_for_vectorization);
+      problem->max_dtype_size = (int32_t)max_dtype_size_for_vectorization;
+      heuristic_plugin::updatePointwiseParams(params.get(), *problem);
+    }
+  }
+
   gdim_left = ceilDiv(gdim_left, params->unroll_factor_outer);
   gdim_right = ceilDiv(gdim_right, params->unroll_factor_inner);
 
   NVF_ERROR(right_elem_count > 0 || break_point == 0);
 
-  params->break_point = break_point;
   params->flip_grid_binding = flip_grid_binding;
   params->split_block = bdimy > 1;
 
@@ -572,8 +585,8 @@ bool PointWiseScheduler::canScheduleCompileTime(Fusion* fusion) {
   }
 
   if (!ir_utils::getViewOps(fusion).empty()) {
-    ComputeAtMap ca_map(fusion);
-    if (registry_utils::requiresForwardViewReplay(fusion, ca_map)) {
+    std::shared_ptr<ComputeAtMap> ca_map = cachedComputeAtMap(fusion);
+    if (registry_utils::requiresForwardViewReplay(fusion, *ca_map)) {
       scheduler_debug_utils::canScheduleRejectReason(
           schedulerType(), "Fusion requires view being reversible.");
       return false;
@@ -7,9 +7,11 @@
 // clang-format on
 #include <ATen/cuda/CUDAContext.h>
 #include <debug.h>
+#include <id_graph_cache.h>
 #include <instrumentation.h>
 #include <multidevice/utils.h>
 #include <scheduler/debug_utils.h>
+#include <scheduler/heuristic_plugin.h>
 #include <scheduler/mark_aliases.h>
 #include <scheduler/reduction.h>
 #include <scheduler/reduction_utils.h>
@@ -112,6 +114,7 @@ int64_t getVectUnroll(
 }
 
 int64_t getL1L2WarpSize(
+    const cudaDeviceProp* dev_prop,
     const int64_t total_reduction_numel,
     const int64_t total_iteration_numel,
     const int64_t n_tensor_inputs,
@@ -128,7 +131,7 @@ int64_t getL1L2WarpSize(
   // reduction dim is really small, we can use <32 threads per warp.
   const bool fits_in_l2 =
       n_elems * max_dtype_size_for_vectorization * n_tensor_inputs <
-      at::cuda::getCurrentDeviceProperties()->l2CacheSize;
+      dev_prop->l2CacheSize;
 
   // If it fits in l2, we just want to make sure each warp uses 32Bytes. Set
   // minimum warp as 16 threads instead of 32 as if we have a small reduction
@@ -155,14 +158,13 @@ int64_t getL1L2WarpSize(
 // Reduction dim: Serial, [BIDx or unroll], TIDx, Vect
 // Iteration dim: Serial, BIDy, [TIDy], [unroll]
 std::unique_ptr<ReductionParams> inner2dReductionHeuristic(
+    const cudaDeviceProp* dev_prop,
     const int64_t total_reduction_numel,
     const int64_t total_iteration_numel,
     const int64_t n_tensor_inputs,
     const int64_t max_dtype_size_for_vectorization,
     const int64_t max_vectorize_factor,
     const bool has_mufu_computation) {
-  // Get device properties
-  auto dev_prop = at::cuda::getCurrentDeviceProperties();
   const int64_t threads_per_warp = dev_prop->warpSize;
   const int64_t max_threads_per_block = dev_prop->maxThreadsPerBlock;
   const int64_t max_threads_per_sm = dev_prop->maxThreadsPerMultiProcessor;
@@ -170,6 +172,7 @@ std::unique_ptr<ReductionParams> inner2dReductionHeuristic(
   const int64_t target_threads_per_sm = max_threads_per_sm / 2;
 
   const int64_t min_warp_size = getL1L2WarpSize(
+      dev_prop,
       total_reduction_numel,
       total_iteration_numel,
       n_tensor_inputs,
@@ -317,8 +320,7 @@ std::unique_ptr<ReductionParams> inner2dReductionHeuristic(
 
   if (rparams->pad_inner_reduction_to_warp) {
     // Adjust bdimx based on padding
-    auto min_warp_size =
-        (int64_t)at::cuda::getCurrentDeviceProperties()->warpSize;
+    auto min_warp_size = (int64_t)dev_prop->warpSize;
     bdimx = bdimx % min_warp_size == 0
         ? bdimx
         : bdimx + min_warp_size - bdimx % min_warp_size;
@@ -391,6 +393,7 @@ std::unique_ptr<ReductionParams> inner2dReductionHeuristic(
 }
 
 std::unique_ptr<ReductionParams> inner3dReductionHeuristic(
+    const cudaDeviceProp* dev_prop,
     const int64_t total_reduction_numel,
     const int64_t total_iteration_numel,
     const int64_t inner_most_dimension_numel,
@@ -402,14 +405,11 @@ std::unique_ptr<ReductionParams> inner3dReductionHeuristic(
 
   const int64_t n_elems = total_reduction_numel * total_iteration_numel;
 
-  // WARNING: At some point we may want to generate heuristics for another
-  // device that is not the current device.
   const int64_t max_threads_per_sm =
-      (int64_t)at::cuda::getCurrentDeviceProperties()
-          ->maxThreadsPerMultiProcessor;
+      (int64_t)dev_prop->maxThreadsPerMultiProcessor;
 
   const int64_t device_multiprocessor_count =
-      (int64_t)at::cuda::getCurrentDeviceProperties()->multiProcessorCount;
+      (int64_t)dev_prop->multiProcessorCount;
 
   auto const max_unroll = ceilDiv(
       // Available unrolling based on size of data type
@@ -420,6 +420,7 @@ std::unique_ptr<ReductionParams> inner3dReductionHeuristic(
 
   // Take the smaller
   const int64_t min_warp_size = getL1L2WarpSize(
+      dev_prop,
       total_reduction_numel,
       total_iteration_numel,
       n_tensor_inputs,
@@ -687,15 +688,13 @@ std::unique_ptr<ReductionParams> inner3dReductionHeuristic(
   rparams->block_dim_inner_reduction = ParallelType::TIDx;
   rparams->cross_grid_inner_reduction = gridim > 1;
   rparams->multiple_reds_per_blk = bdimy > 1;
-  bool pad_bdimx = bdimx > 16 &&
-      bdimx * bdimy <
-          (int64_t)at::cuda::getCurrentDeviceProperties()->maxThreadsPerBlock;
+  bool pad_bdimx =
+      bdimx > 16 && bdimx * bdimy < (int64_t)dev_prop->maxThreadsPerBlock;
   rparams->pad_inner_reduction_to_warp = pad_bdimx;
 
   if (rparams->pad_inner_reduction_to_warp) {
     // Adjust bdimx based on padding
-    auto min_warp_size =
-        (int64_t)at::cuda::getCurrentDeviceProperties()->warpSize;
+    auto min_warp_size = (int64_t)dev_prop->warpSize;
     bdimx = bdimx % min_warp_size == 0
         ? bdimx
         : bdimx + min_warp_size - bdimx % min_warp_size;
@@ -796,6 +795,7 @@ std::unique_ptr<ReductionParams> inner3dReductionHeuristic(
                 << rparams->cross_grid_inner_reduction << std::endl;
       }
       return inner2dReductionHeuristic(
+          dev_prop,
           total_reduction_numel,
           total_iteration_numel,
           (int64_t)n_tensor_inputs,
@@ -895,6 +895,7 @@ bool isBetterThan(
 }
 
 std::unique_ptr<ReductionParams> heuristicParaToSchedulerPara(
+    const cudaDeviceProp* dev_prop,
     const OuterReductionParams& params) {
   int64_t gdimx = LaunchParams::UNINITIALIZED_VAL;
   int64_t gdimy = LaunchParams::UNINITIALIZED_VAL;
@@ -913,9 +914,7 @@ std::unique_ptr<ReductionParams> heuristicParaToSchedulerPara(
   // registers, preventing compilers from allocating more registers per thread,
   // which could reduce occupancy and degrade performance.
   int64_t target_threads_per_sm =
-      (int64_t)at::cuda::getCurrentDeviceProperties()
-          ->maxThreadsPerMultiProcessor /
-      2;
+      (int64_t)dev_prop->maxThreadsPerMultiProcessor / 2;
   int64_t threads_per_block = params.bdimx * params.bdimy;
   int64_t threads_per_sm =
       scheduler_utils::safeDiv(target_threads_per_sm, threads_per_block) *
@@ -1073,6 +1072,7 @@ OuterReductionParams getBlockOuterReduction(
 }
 
 OuterReductionParams getGridOuterReduction(
+    const cudaDeviceProp* dev_prop,
     const int64_t total_reduction_numel,
     const int64_t total_iteration_numel,
     const int64_t n_tensor_inputs,
@@ -1096,7 +1096,7 @@ OuterReductionParams getGridOuterReduction(
   // L2
   const bool fits_in_l2 =
       n_elems * max_dtype_size_for_vectorization * n_tensor_inputs <
-      at::cuda::getCurrentDeviceProperties()->l2CacheSize;
+      dev_prop->l2CacheSize;
 
   const int64_t min_warp_size = fits_in_l2 ? 16 : 32;
 
@@ -1306,14 +1306,13 @@ OuterReductionParams getGridOuterReduction(
 }
 
 std::unique_ptr<ReductionParams> outerReductionHeuristic(
+    const cudaDeviceProp* dev_prop,
     const int64_t total_reduction_numel,
     const int64_t total_iteration_numel,
     const int64_t n_tensor_inputs,
     const int64_t max_dtype_size_for_vectorization,
     const size_t vectorize_factor,
     const bool has_mufu_computation) {
-  // WARNING: Current device for codegen may not be the target device
-  auto dev_prop = at::cuda::getCurrentDeviceProperties();
   const int64_t sm_count = (int64_t)dev_prop->multiProcessorCount;
   const int64_t max_threads_per_block = (int64_t)dev_prop->maxThreadsPerBlock;
   const int64_t max_threads_per_sm =
@@ -1354,6 +1353,7 @@ std::unique_ptr<ReductionParams> outerReductionHeuristic(
 
   // block or grid reduction heuristic
   auto grid_params = getGridOuterReduction(
+      dev_prop,
       total_reduction_numel,
       total_iteration_numel,
       n_tensor_inputs,
@@ -1374,13 +1374,14 @@ std::unique_ptr<ReductionParams> outerReductionHeuristic(
 
   // pick the better heuristic
   if (isBetterThan(block_params, grid_params, sm_count)) {
-    return heuristicParaToSchedulerPara(block_params);
+    return heuristicParaToSchedulerPara(dev_prop, block_params);
   } else {
-    return heuristicParaToSchedulerPara(grid_params);
+    return heuristicParaToSchedulerPara(dev_prop, grid_params);
   }
 }
 
 std::unique_ptr<ReductionParams> reductionHeuristic(
+    const cudaDeviceProp* dev_prop,
     const int64_t total_reduction_numel,
     const int64_t total_iteration_numel,
     const int64_t inner_most_dimension_numel,
@@ -1392,6 +1393,7 @@ std::unique_ptr<ReductionParams> reductionHeuristic(
   if (fastest_dim_reduction) {
     if (total_reduction_numel == inner_most_dimension_numel) {
       return inner2dReductionHeuristic(
+          dev_prop,
           total_reduction_numel,
           total_iteration_numel,
           (int64_t)n_tensor_inputs,
@@ -1400,6 +1402,7 @@ std::unique_ptr<ReductionParams> reductionHeuristic(
           has_mufu_computation);
     } else {
       return inner3dReductionHeuristic(
+          dev_prop,
           total_reduction_numel,
           total_iteration_numel,
           inner_most_dimension_numel,
@@ -1412,6 +1415,7 @@ std::unique_ptr<ReductionParams> reductionHeuristic(
   } else {
     // 3D schedules not enabled for outer reductions
     return outerReductionHeuristic(
+        dev_prop,
         total_reduction_numel,
         total_iteration_numel,
         (int64_t)n_tensor_inputs,
@@ -1510,6 +1514,7 @@ std::unique_ptr<ReductionParams> getReductionHeuristics(
   bool has_mufu_computation = scheduler_utils::hasExpensiveMUFUops(fusion);
 
   auto heuristic = reductionHeuristic(
+      runtime_info.deviceProperties(),
       properties.total_reduction_numel,
       properties.total_iteration_numel,
       properties.inner_most_dimension_numel,
@@ -1519,6 +1524,21 @@ std::unique_ptr<ReductionParams> getReductionHeuristics(
       vectorize_factor,
       has_mufu_computation);
   heuristic->cparams.index_type = runtime_info.getIndexType();
+
+  if (heuristic_plugin::hasPlugin()) {
+    if (auto problem = heuristic_plugin::describeProblem(
+            SchedulerType::Reduction, fusion, runtime_info, reduction_tv)) {
+      problem->max_vectorization_factor = (int32_t)std::min(
+          vectorize_factor, 16 / max_dtype_size_for_vectorization);
+      problem->max_dtype_size = (int32_t)max_dtype_size_for_vectorization;
+      problem->total_reduction_numel = properties.total_reduction_numel;
+      problem->total_iteration_numel = properties.total_iteration_numel;
+      problem->inner_most_dimension_numel =
+          properties.inner_most_dimension_numel;
+      problem->fastest_dim_reduction = properties.fastest_dim_reduction;
+      heuristic_plugin::updateReductionParams(heuristic.get(), *problem);
+    }
+  }
   return heuristic;
 }
 
@@ -1695,8 +1715,8 @@ bool ReductionScheduler::canScheduleCompileTime(Fusion* fusion) {
   }
 
   if (!ir_utils::getViewOps(fusion).empty()) {
-    ComputeAtMap ca_map(fusion);
-    if (registry_utils::requiresForwardViewReplay(fusion, ca_map)) {
+    std::shared_ptr<ComputeAtMap> ca_map = cachedComputeAtMap(fusion);
+    if (registry_utils::requiresForwardViewReplay(fusion, *ca_map)) {
       scheduler_debug_utils::canScheduleRejectReason(
           schedulerType(), "Fusion requires view being reversible.");
       return false;
@@ -6,9 +6,11 @@
  */
 // clang-format on
 #include <ATen/cuda/CUDAContext.h>
+#include <fusion_view.h>
 #include <instrumentation.h>
 #include <scheduler/all_schedulers.h>
 #include <scheduler/debug_utils.h>
+#include <scheduler/foreach.h>
 #include <scheduler/heuristic.h>
 #include <scheduler/matmul_utils.h>
 #include <scheduler/registry.h>
@@ -57,7 +59,9 @@ bool checkCanSchedule(Fusion* fusion, SchedulerType scheduler_type) {
     return false;
   }
 
-  if (!registry_utils::isConnectedFusionGraph(fusion)) {
+  // The ForEach scheduler takes independent groups of tensors by design.
+  if (scheduler_type != SchedulerType::ForEach &&
+      !registry_utils::isConnectedFusionGraph(fusion)) {
     scheduler_debug_utils::canScheduleRejectReason(
         scheduler_type, "Connected fusion graph check failed!");
     return false;
@@ -112,6 +116,8 @@ std::unique_ptr<SchedulerEntry> SchedulerEntry::makeSchedulerInstance(
       return std::make_unique<ExprEvalScheduler>();
     case SchedulerType::Resize:
       return std::make_unique<ResizeScheduler>();
+    case SchedulerType::ForEach:
+      return std::make_unique<ForEachScheduler>();
     case SchedulerType::Communication:
       return std::make_unique<CommunicationScheduler>();
     default:
@@ -175,6 +181,30 @@ SchedulerType proposeHeuristics(
   }
   return SchedulerType::None;
 }
+
+bool canScheduleCompileTime(const FusionView& view) {
+  FUSER_PERF_SCOPE("Schedule::canScheduleCompileTime(FusionView)");
+  // checkCanSchedule rejects these ops in every scheduler but ExprEval, which
+  // only takes them as the single expr of a fusion. ExprEval also takes
+  // fusions whose outputs are all aliases of inputs, but only meta ops are
+  // between such outputs and inputs.
+  const bool has_expr_eval_only_ops =
+      std::ranges::any_of(view.exprs(), [](Expr* expr) {
+        return expr->isOneOf<
+            ScatterOp,
+            SdpaFwdOp,
+            SdpaBwdOp,
+            EmbeddingFwdOp,
+            IndexPutAccumulateOp,
+            ArgsortOp>();
+      });
+  if (has_expr_eval_only_ops && view.exprs().size() > 1) {
+    scheduler_debug_utils::canScheduleMessage(
+        "Rejected on view: ops only ExprEval takes in a multi-expr segment");
+    return false;
+  }
+  return true;
+}
 } // namespace Schedule
 
 namespace {
@@ -14,6 +14,7 @@
 
 namespace nvfuser {
 
+class FusionView;
 class HeuristicDataCache;
 class HeuristicParams;
 class SchedulerRuntimeInfo;
@@ -92,6 +93,13 @@ bool canSchedule(
 SchedulerType proposeHeuristics(
     Fusion* fusion,
     SchedulerRuntimeInfo& runtime_info);
+
+//! Fusion segmenter facing API,
+//!   checks a view of a segment candidate with the compile-time checks that
+//!   don't need the narrowed fusion. Returns false only if proposeHeuristics
+//!   would return SchedulerType::None for the candidate, so the segmenter can
+//!   reject a merge without narrowing the complete fusion.
+NVF_API bool canScheduleCompileTime(const FusionView& view);
 } // namespace Schedule
 
 } // namespace nvfuser
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 // clang-format on
+#include <id_graph_cache.h>
 #include <ir/utils.h>
 #include <logical_domain_map.h>
 #include <runtime/executor_kernel_arg.h>
@@ -988,8 +989,7 @@ bool SchedulerTopologyChecker::hasGatherToBroadcastBeforeReduction(
   // may be concretized. ExactLogicalDomainMap may be enough as
   // broadcasts should not be removed by rfactor exprs.
 
-  // Consider reusing a CA map
-  ComputeAtMap ca_map(fusion);
+  std::shared_ptr<ComputeAtMap> ca_map = cachedComputeAtMap(fusion);
   // All of reduction TVs are mapped, so doesn't matter which
   // reduction tv to use
   auto ref_tv = reduction_tvs.at(0);
@@ -1003,7 +1003,7 @@ bool SchedulerTopologyChecker::hasGatherToBroadcastBeforeReduction(
             ref_tv->getMaybeRootDomain().begin(),
             ref_tv->getMaybeRootDomain().end(),
             [&](IterDomain* red_tv_root_id) {
-              return ca_map.areMapped(
+              return ca_map->areMapped(
                   broadcast_consumer_id,
                   red_tv_root_id,
                   IdMappingMode::PERMISSIVE);
@@ -1087,9 +1087,8 @@ bool SchedulerTopologyChecker::hasCyclicReshape(Fusion* fusion) {
     return false;
   }
 
-  // TODO: Reuse IdModel when possible
-  IdModel id_model(fusion);
-  const auto& exact_graph = id_model.buildExactGraph();
+  std::shared_ptr<IdModel> id_model = cachedIdModel(fusion);
+  const auto& exact_graph = id_model->maybeBuildGraph(IdMappingMode::EXACT);
 
   std::unordered_map<
       TensorView*,
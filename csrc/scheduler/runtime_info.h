@@ -12,6 +12,7 @@
 #include <expr_evaluator.h>
 #include <fusion.h>
 #include <runtime/executor_kernel_arg.h>
+#include <target_device.h>
 #include <utils.h>
 #include <visibility.h>
 
@@ -109,6 +110,12 @@ class SchedulerRuntimeInfo : public NonCopyable {
     return *expression_evaluator_;
   }
 
+  //! Properties of the device heuristics are computed for, captured when
+  //! this object is created. See TargetDevice.
+  const cudaDeviceProp* deviceProperties() const {
+    return device_properties_;
+  }
+
  private:
   // Build and bind full fusion inputs to an expression evaluator
   std::unique_ptr<ExpressionEvaluator> getExpressionEvaluator(
@@ -133,6 +140,11 @@ class SchedulerRuntimeInfo : public NonCopyable {
   // Fusion reference that this runtime info is associated with
   Fusion* complete_fusion_ = nullptr;
 
+  // Keeps the properties of a guarded target alive after the guard is gone.
+  const std::shared_ptr<const TargetDeviceProperties> guarded_target_ =
+      guardedTargetDevice();
+  const cudaDeviceProp* device_properties_ = getTargetDeviceProperties();
+
   // Copy of aten input pointer addresses
   // TODO: Support output tensor pointers
   std::unordered_map<Val*, size_t> input_ptrs_;
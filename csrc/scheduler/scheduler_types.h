@@ -58,11 +58,12 @@ enum class SchedulerType {
   Transpose,
   ExprEval,
   Resize,
-  Communication
+  Communication,
+  ForEach
 };
 
 //! Define a schedule table to loop over all the heuristics in priority order.
-constexpr std::array<SchedulerType, 11> all_heuristics_in_priority_order = {
+constexpr std::array<SchedulerType, 12> all_heuristics_in_priority_order = {
     SchedulerType::ExprEval,
     SchedulerType::Communication,
     SchedulerType::NoOp,
@@ -71,6 +72,7 @@ constexpr std::array<SchedulerType, 11> all_heuristics_in_priority_order = {
     SchedulerType::Resize,
     SchedulerType::Transpose,
     SchedulerType::PointWise,
+    SchedulerType::ForEach,
     SchedulerType::InnerPersistent,
     SchedulerType::OuterPersistent,
     SchedulerType::InnerOuterPersistent};
@@ -473,7 +473,7 @@ std::string getTransposeRuntimeRejectReason(
 
   // don't schedule with transpose scheduler if less than a full wave
   const int64_t device_multiprocessor_count =
-      (int64_t)at::cuda::getCurrentDeviceProperties()->multiProcessorCount;
+      (int64_t)runtime_info.deviceProperties()->multiProcessorCount;
   auto elements_per_wave = device_multiprocessor_count * default_tile_elements;
   if ((int64_t)elements_per_wave > n_elems) {
     return "Transpose scheduler does not perform well on small problem sizes.";
@@ -606,7 +606,7 @@ std::unique_ptr<TransposeParams> getTransposeHeuristics(
       getLoopDomainSizes(data_cache, runtime_info, reference1, domain_map);
 
   const int64_t device_multiprocessor_count =
-      (int64_t)at::cuda::getCurrentDeviceProperties()->multiProcessorCount;
+      (int64_t)runtime_info.deviceProperties()->multiProcessorCount;
 
   auto innermost_info_entry = getInnerMostDimInfoInReference(
       data_cache, reference_tensors, reference1, domain_map);
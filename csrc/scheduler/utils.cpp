@@ -13,6 +13,7 @@
 #include <bfs.h>
 #include <contiguity.h>
 #include <expr_evaluator.h>
+#include <id_graph_cache.h>
 #include <id_model/id_model.h>
 #include <id_model/schedule.h>
 #include <instrumentation.h>
@@ -23,6 +24,7 @@
 #include <ops/all_ops.h>
 #include <scheduler/mma_utils.h>
 #include <scheduler/runtime_info.h>
+#include <target_device.h>
 #include <transform_iter.h>
 #include <transform_replay.h>
 #include <val_graph_visitor.h>
@@ -309,13 +311,14 @@ void parallelizeAllLike(
 
   std::unordered_map<IterDomain*, IterDomain*> concrete_to_reference_map;
 
-  auto ca_map = ComputeAtMap(FusionGuard::getCurFusion());
+  std::shared_ptr<ComputeAtMap> ca_map =
+      cachedComputeAtMap(FusionGuard::getCurFusion());
 
   const auto& reference_dom = reference_tv->getLoopDomain();
   for (auto it = reference_dom.begin(); it != reference_dom.begin() + pos;
        it++) {
     auto ca_id =
-        ca_map.getConcreteMappedID(*it, IdMappingMode::PERMISSIVE_RESIZE);
+        ca_map->getConcreteMappedID(*it, IdMappingMode::PERMISSIVE_RESIZE);
     concrete_to_reference_map[ca_id] = *it;
   }
 
@@ -328,7 +331,7 @@ void parallelizeAllLike(
     }
     bool is_fusion_input = tv->isFusionInput();
     for (const auto i : arange((int64_t)tv->getLoopDomain().size())) {
-      auto ca_id = ca_map.getConcreteMappedID(
+      auto ca_id = ca_map->getConcreteMappedID(
           tv->axis(i), IdMappingMode::PERMISSIVE_RESIZE);
       if (concrete_to_reference_map.count(ca_id) == 0) {
         continue;
@@ -597,7 +600,7 @@ PersistentBufferInfo persistentBuffers(Fusion* fusion) {
   auto reduction_tvs = getReductionTvs(fusion);
 
   // TODO: Reuse this id_model in getResolutionPointsOf
-  IdModel id_model(fusion);
+  std::shared_ptr<IdModel> id_model = cachedIdModel(fusion);
   std::vector<TensorView*> persistent_buffer_candidates;
 
   for (auto producer : all_tvs) {
@@ -640,7 +643,7 @@ PersistentBufferInfo persistentBuffers(Fusion* fusion) {
     if (normalization_scheduler_utils::isCacheableUnmappableTv(
             producer,
             reduction_tvs,
-            id_model.maybeBuildGraph(IdMappingMode::ALMOSTEXACT))) {
+            id_model->maybeBuildGraph(IdMappingMode::ALMOSTEXACT))) {
       persistent_buffer_candidates.emplace_back(producer);
     } else {
       persistent_buffer_info.non_persistent_buffers.emplace_back(producer);
@@ -665,7 +668,7 @@ PersistentBufferInfo persistentBuffers(Fusion* fusion) {
         PersistentBufferResolution::getResolutionPointsOf(fusion, buffer);
     if (resolution_points.empty()) {
       resolution_points = normalization_scheduler_utils::getResolutionPointsOf(
-          buffer, id_model);
+          buffer, *id_model);
     }
     if (resolution_points.empty()) {
       continue;
@@ -702,7 +705,7 @@ PersistentBufferInfo persistentBuffers(Fusion* fusion) {
               return normalization_scheduler_utils::isCacheableUnmappableTv(
                   input,
                   reduction_tvs,
-                  id_model.maybeBuildGraph(IdMappingMode::ALMOSTEXACT));
+                  id_model->maybeBuildGraph(IdMappingMode::ALMOSTEXACT));
             })) {
       persistent_buffer_info.projectable_persistent_buffers.push_back(
           persistent_buffer);
@@ -719,19 +722,19 @@ PersistentBufferInfo persistentBuffers(Fusion* fusion) {
       persistent_buffer_info.projectable_persistent_buffers);
 
   // Map unmappable dims to inputs, doesn't matter which compute at map used
-  auto ca_map = ComputeAtMap(fusion);
+  std::shared_ptr<ComputeAtMap> ca_map = cachedComputeAtMap(fusion);
 
   std::unordered_set<IterDomain*> unmappable_concrete_ids;
   for (auto id : persistent_buffer_info.unmappable_dims) {
     unmappable_concrete_ids.emplace(
-        ca_map.getConcreteMappedID(id, IdMappingMode::EXACT));
+        ca_map->getConcreteMappedID(id, IdMappingMode::EXACT));
   }
 
   for (auto input : all_inputs) {
     bool has_unmappable_dim = false;
     for (auto input_id : input->getLogicalDomain()) {
       auto concrete_input_id =
-          ca_map.getConcreteMappedID(input_id, IdMappingMode::EXACT);
+          ca_map->getConcreteMappedID(input_id, IdMappingMode::EXACT);
       if (unmappable_concrete_ids.find(concrete_input_id) !=
           unmappable_concrete_ids.end()) {
         persistent_buffer_info.unamppable_dims_projected_to_inputs.emplace(
@@ -1755,7 +1758,7 @@ BroadcastMultipleInformation getBroadcastMultiples(
 
   // Shouldn't matter if we use EXACT or PERMISSIVE mapping mode for compute
   // at map as we're just looking at the root mappings.
-  auto ca_map = ComputeAtMap(fusion);
+  std::shared_ptr<ComputeAtMap> ca_map = cachedComputeAtMap(fusion);
 
   // Map all inputs and output domains to reference tv domains
   for (auto in_out_tv : in_out_tvs) {
@@ -1785,7 +1788,7 @@ BroadcastMultipleInformation getBroadcastMultiples(
             in_out_tv_domain_list.begin(),
             in_out_tv_domain_list.end(),
             [&ref_id, &ca_map](IterDomain* in_out_tv_id) {
-              return ca_map.areMapped(
+              return ca_map->areMapped(
                   in_out_tv_id, ref_id, IdMappingMode::EXACT);
             });
         if (mapped_it != in_out_tv_domain_list.end()) {
@@ -2655,7 +2658,7 @@ int64_t getReductionSmemWorkspace(
     Fusion* fusion,
     const std::vector<TensorView*>& reduction_tvs,
     int64_t threads_per_block) {
-  const auto& dev_prop = at::cuda::getCurrentDeviceProperties();
+  const auto& dev_prop = getTargetDeviceProperties();
   // use device max threads per block if threads_per_block is not provided
   threads_per_block =
       threads_per_block > 0 ? threads_per_block : dev_prop->maxThreadsPerBlock;
@@ -2939,13 +2942,8 @@ int64_t getComputationCostFactor(Fusion* fusion) {
 int64_t getRequiredBytesInFlight() {
   // H100, 32KB in flight @ 3352 GB/s = 9.5e-9 seconds
   constexpr float empirical_gmem_latency = 9.5e-9;
-  const auto dev_idx = at::cuda::current_device();
-  int gpu_mem_clock_khz;
-  cudaDeviceGetAttribute(
-      &gpu_mem_clock_khz, cudaDevAttrMemoryClockRate, dev_idx);
-  const auto dev_prop = at::cuda::getCurrentDeviceProperties();
-  float hardware_bandwidth = 2.f * (float)dev_prop->memoryBusWidth / 8.f *
-      (float)gpu_mem_clock_khz * 1000.f;
+  const float hardware_bandwidth =
+      (float)currentTargetDevice().memory_bandwidth;
   return (int64_t)(empirical_gmem_latency * hardware_bandwidth);
 }
 
@@ -2979,21 +2977,15 @@ bool isHighBandwidthFlopsRatio() {
   // A100-SXM4-40GB, 1.555e12 B/s, 1.95e13 flops, ratio = 0.0798
   // H100-HBM3-80GB, 3.352e12 B/s, 6.69e13 flops, ratio = 0.0501
   constexpr float reference_ratio = 0.07f;
-  const auto dev_idx = at::cuda::current_device();
-  const auto dev_prop = at::cuda::getCurrentDeviceProperties();
+  const TargetDevice target = currentTargetDevice();
   // bandwidth
-  int gpu_mem_clock_khz;
-  cudaDeviceGetAttribute(
-      &gpu_mem_clock_khz, cudaDevAttrMemoryClockRate, dev_idx);
-  float hardware_bandwidth = 2.f * (float)dev_prop->memoryBusWidth / 8.f *
-      (float)gpu_mem_clock_khz * 1000.f;
+  float hardware_bandwidth = (float)target.memory_bandwidth;
   // fp32 cuda core flops
-  const int cuda_core_per_sm = getCoresPerSM(dev_prop->major, dev_prop->minor);
+  const int cuda_core_per_sm =
+      getCoresPerSM((int)target.major, (int)target.minor);
   const int flops_per_cycle = 2;
-  int gpu_clock_khz;
-  cudaDeviceGetAttribute(&gpu_clock_khz, cudaDevAttrClockRate, dev_idx);
-  float flops = (float)gpu_clock_khz * 1000.f *
-      (float)dev_prop->multiProcessorCount * (float)cuda_core_per_sm *
+  float flops = (float)target.clock_rate_khz * 1000.f *
+      (float)target.multi_processor_count * (float)cuda_core_per_sm *
       (float)flops_per_cycle;
 
   float bandwidth_flops_ratio = hardware_bandwidth / flops;
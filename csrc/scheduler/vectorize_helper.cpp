@@ -12,6 +12,7 @@
 #include <device_lower/analysis/divisible_split.h>
 #include <expr_evaluator.h>
 #include <expr_simplifier.h>
+#include <id_graph_cache.h>
 #include <id_model/id_model.h>
 #include <instrumentation.h>
 #include <ir/builder.h>
@@ -912,8 +913,8 @@ std::unordered_set<Val*> getResizeVectorizationFactors(
     return {};
   }
 
-  IdModel id_model(fusion);
-  const auto& graph = id_model.buildExactGraph();
+  std::shared_ptr<IdModel> id_model = cachedIdModel(fusion);
+  const auto& graph = id_model->maybeBuildGraph(IdMappingMode::EXACT);
 
   std::unordered_set<Val*> resize_factors;
 
@@ -0,0 +1,274 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <target_device.h>
+
+#include <ATen/cuda/CUDAContext.h>
+
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+
+#include <exceptions.h>
+#include <utils.h>
+
+namespace nvfuser {
+
+namespace {
+
+std::string trim(const std::string& s) {
+  const auto begin = s.find_first_not_of(" \t\r");
+  if (begin == std::string::npos) {
+    return "";
+  }
+  const auto end = s.find_last_not_of(" \t\r");
+  return s.substr(begin, end - begin + 1);
+}
+
+int64_t parseInt(const std::string& key, const std::string& value) {
+  try {
+    size_t pos = 0;
+    const int64_t result = std::stoll(value, &pos);
+    NVF_CHECK(pos == value.size());
+    return result;
+  } catch (const std::exception&) {
+    NVF_THROW("Invalid integer for target device key ", key, ": ", value);
+  }
+}
+
+double parseDouble(const std::string& key, const std::string& value) {
+  try {
+    size_t pos = 0;
+    const double result = std::stod(value, &pos);
+    NVF_CHECK(pos == value.size());
+    return result;
+  } catch (const std::exception&) {
+    NVF_THROW("Invalid number for target device key ", key, ": ", value);
+  }
+}
+
+// The target of the innermost TargetDeviceGuard on this thread, or the one
+// inherited from another thread, if any.
+thread_local std::shared_ptr<const TargetDeviceProperties> guarded_target;
+
+// The target described by NVFUSER_TARGET_DEVICE, loaded once.
+const TargetDeviceProperties* getTargetFromEnv() {
+  static const std::unique_ptr<TargetDeviceProperties> env_target =
+      []() -> std::unique_ptr<TargetDeviceProperties> {
+    const char* path = getNvFuserEnv("TARGET_DEVICE");
+    if (path == nullptr) {
+      return nullptr;
+    }
+    TargetDevice target = TargetDevice::fromFile(path);
+    cudaDeviceProp properties = target.toCudaDeviceProp();
+    return std::make_unique<TargetDeviceProperties>(
+        TargetDeviceProperties{std::move(target), properties});
+  }();
+  return env_target.get();
+}
+
+} // namespace
+
+TargetDevice TargetDevice::fromCudaDeviceProp(const cudaDeviceProp& prop) {
+  TargetDevice target;
+  target.name = prop.name;
+  target.major = prop.major;
+  target.minor = prop.minor;
+  target.multi_processor_count = prop.multiProcessorCount;
+  target.warp_size = prop.warpSize;
+  target.max_threads_per_block = prop.maxThreadsPerBlock;
+  target.max_threads_per_multi_processor = prop.maxThreadsPerMultiProcessor;
+  target.max_blocks_per_multi_processor = prop.maxBlocksPerMultiProcessor;
+  target.regs_per_block = prop.regsPerBlock;
+  target.regs_per_multiprocessor = prop.regsPerMultiprocessor;
+  target.shared_mem_per_block = (int64_t)prop.sharedMemPerBlock;
+  target.shared_mem_per_block_optin = (int64_t)prop.sharedMemPerBlockOptin;
+  target.shared_mem_per_multiprocessor =
+      (int64_t)prop.sharedMemPerMultiprocessor;
+  target.reserved_shared_mem_per_block =
+      (int64_t)prop.reservedSharedMemPerBlock;
+  target.l2_cache_size = prop.l2CacheSize;
+  target.memory_bandwidth = 0.0;
+  target.clock_rate_khz = 0;
+  return target;
+}
+
+TargetDevice TargetDevice::fromDevice(int device) {
+  TargetDevice target = fromCudaDeviceProp(
+      *at::cuda::getDeviceProperties((c10::DeviceIndex)device));
+  int memory_clock_khz = 0;
+  cudaDeviceGetAttribute(&memory_clock_khz, cudaDevAttrMemoryClockRate, device);
+  int memory_bus_width = 0;
+  cudaDeviceGetAttribute(
+      &memory_bus_width, cudaDevAttrGlobalMemoryBusWidth, device);
+  // Double data rate.
+  target.memory_bandwidth =
+      2.0 * memory_bus_width / 8.0 * memory_clock_khz * 1000.0;
+  int clock_khz = 0;
+  cudaDeviceGetAttribute(&clock_khz, cudaDevAttrClockRate, device);
+  target.clock_rate_khz = clock_khz;
+  return target;
+}
+
+TargetDevice TargetDevice::parse(std::istream& is) {
+  TargetDevice target;
+  const std::unordered_map<std::string, int64_t*> int_fields = {
+      {"major", &target.major},
+      {"minor", &target.minor},
+      {"multi_processor_count", &target.multi_processor_count},
+      {"warp_size", &target.warp_size},
+      {"max_threads_per_block", &target.max_threads_per_block},
+      {"max_threads_per_multi_processor",
+       &target.max_threads_per_multi_processor},
+      {"max_blocks_per_multi_processor",
+       &target.max_blocks_per_multi_processor},
+      {"regs_per_block", &target.regs_per_block},
+      {"regs_per_multiprocessor", &target.regs_per_multiprocessor},
+      {"shared_mem_per_block", &target.shared_mem_per_block},
+      {"shared_mem_per_block_optin", &target.shared_mem_per_block_optin},
+      {"shared_mem_per_multiprocessor",
+       &target.shared_mem_per_multiprocessor},
+      {"reserved_shared_mem_per_block",
+       &target.reserved_shared_mem_per_block},
+      {"l2_cache_size", &target.l2_cache_size},
+      {"clock_rate_khz", &target.clock_rate_khz},
+  };
+
+  std::string line;
+  while (std::getline(is, line)) {
+    if (auto comment = line.find('#'); comment != std::string::npos) {
+      line.resize(comment);
+    }
+    line = trim(line);
+    if (line.empty()) {
+      continue;
+    }
+    const auto eq = line.find('=');
+    NVF_CHECK(
+        eq != std::string::npos,
+        "Expected `key = value` in target device descriptor: ",
+        line);
+    const std::string key = trim(line.substr(0, eq));
+    const std::string value = trim(line.substr(eq + 1));
+
+    if (key == "name") {
+      target.name = value;
+    } else if (key == "compute_capability") {
+      const auto dot = value.find('.');
+      NVF_CHECK(
+          dot != std::string::npos,
+          "Expected compute_capability as major.minor: ",
+          value);
+      target.major = parseInt(key, value.substr(0, dot));
+      target.minor = parseInt(key, value.substr(dot + 1));
+    } else if (key == "memory_bandwidth") {
+      target.memory_bandwidth = parseDouble(key, value);
+    } else if (auto it = int_fields.find(key); it != int_fields.end()) {
+      *it->second = parseInt(key, value);
+    } else {
+      NVF_THROW("Unknown target device key: ", key);
+    }
+  }
+  return target;
+}
+
+TargetDevice TargetDevice::fromFile(const std::string& path) {
+  std::ifstream is(path);
+  NVF_CHECK(is.good(), "Cannot open target device descriptor: ", path);
+  return parse(is);
+}
+
+cudaDeviceProp TargetDevice::toCudaDeviceProp() const {
+  cudaDeviceProp prop{};
+  name.copy(prop.name, sizeof(prop.name) - 1);
+  prop.major = (int)major;
+  prop.minor = (int)minor;
+  prop.multiProcessorCount = (int)multi_processor_count;
+  prop.warpSize = (int)warp_size;
+  prop.maxThreadsPerBlock = (int)max_threads_per_block;
+  prop.maxThreadsPerMultiProcessor = (int)max_threads_per_multi_processor;
+  prop.maxBlocksPerMultiProcessor = (int)max_blocks_per_multi_processor;
+  prop.regsPerBlock = (int)regs_per_block;
+  prop.regsPerMultiprocessor = (int)regs_per_multiprocessor;
+  prop.sharedMemPerBlock = (size_t)shared_mem_per_block;
+  prop.sharedMemPerBlockOptin = (size_t)shared_mem_per_block_optin;
+  prop.sharedMemPerMultiprocessor = (size_t)shared_mem_per_multiprocessor;
+  prop.reservedSharedMemPerBlock = (size_t)reserved_shared_mem_per_block;
+  prop.l2CacheSize = (int)l2_cache_size;
+  return prop;
+}
+
+bool TargetDevice::operator==(const TargetDevice& other) const {
+  return name == other.name && major == other.major && minor == other.minor &&
+      multi_processor_count == other.multi_processor_count &&
+      warp_size == other.warp_size &&
+      max_threads_per_block == other.max_threads_per_block &&
+      max_threads_per_multi_processor ==
+      other.max_threads_per_multi_processor &&
+      max_blocks_per_multi_processor == other.max_blocks_per_multi_processor &&
+      regs_per_block == other.regs_per_block &&
+      regs_per_multiprocessor == other.regs_per_multiprocessor &&
+      shared_mem_per_block == other.shared_mem_per_block &&
+      shared_mem_per_block_optin == other.shared_mem_per_block_optin &&
+      shared_mem_per_multiprocessor == other.shared_mem_per_multiprocessor &&
+      reserved_shared_mem_per_block == other.reserved_shared_mem_per_block &&
+      l2_cache_size == other.l2_cache_size &&
+      memory_bandwidth == other.memory_bandwidth &&
+      clock_rate_khz == other.clock_rate_khz;
+}
+
+std::ostream& operator<<(std::ostream& os, const TargetDevice& target) {
+  os << "TargetDevice{" << target.name << ", sm_" << target.major
+     << target.minor << ", " << target.multi_processor_count << " SMs, "
+     << target.shared_mem_per_block_optin << " B smem per block, "
+     << target.l2_cache_size << " B L2}";
+  return os;
+}
+
+std::shared_ptr<const TargetDeviceProperties> guardedTargetDevice() {
+  return guarded_target;
+}
+
+std::shared_ptr<const TargetDeviceProperties> exchangeGuardedTargetDevice(
+    std::shared_ptr<const TargetDeviceProperties> target) {
+  std::swap(guarded_target, target);
+  return target;
+}
+
+const cudaDeviceProp* getTargetDeviceProperties() {
+  if (guarded_target != nullptr) {
+    return &guarded_target->properties;
+  }
+  if (const TargetDeviceProperties* env_target = getTargetFromEnv()) {
+    return &env_target->properties;
+  }
+  return at::cuda::getCurrentDeviceProperties();
+}
+
+TargetDevice currentTargetDevice() {
+  if (guarded_target != nullptr) {
+    return guarded_target->target;
+  }
+  if (const TargetDeviceProperties* env_target = getTargetFromEnv()) {
+    return env_target->target;
+  }
+  return TargetDevice::fromDevice(at::cuda::current_device());
+}
+
+TargetDeviceGuard::TargetDeviceGuard(TargetDevice target)
+    : target_(std::make_shared<const TargetDeviceProperties>(
+          TargetDeviceProperties{target, target.toCudaDeviceProp()})),
+      prev_target_(exchangeGuardedTargetDevice(target_)) {}
+
+TargetDeviceGuard::~TargetDeviceGuard() {
+  exchangeGuardedTargetDevice(prev_target_);
+}
+
+} // namespace nvfuser
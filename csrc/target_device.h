@@ -0,0 +1,134 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+#include <visibility.h>
+
+namespace nvfuser {
+
+// The properties of the GPU that heuristics and lowering target. By default,
+// this is the current CUDA device. A TargetDevice can also be loaded from a
+// descriptor so that kernels are scheduled and lowered for a GPU that isn't
+// present, e.g., to build a kernel cache for sm_80 and sm_90 on a machine
+// without GPUs, or to test schedulers against several device profiles.
+//
+// A descriptor is a text file of `key = value` lines. `#` starts a comment.
+// For example,
+//
+//   name = H100
+//   compute_capability = 9.0
+//   multi_processor_count = 132
+//   shared_mem_per_block_optin = 232448
+//   l2_cache_size = 52428800
+//
+// Keys left out keep the defaults below. See TargetDevice::parse for the
+// recognized keys.
+struct TargetDevice {
+  std::string name = "unknown";
+  int64_t major = 8;
+  int64_t minor = 0;
+  int64_t multi_processor_count = 108;
+  int64_t warp_size = 32;
+  int64_t max_threads_per_block = 1024;
+  int64_t max_threads_per_multi_processor = 2048;
+  int64_t max_blocks_per_multi_processor = 32;
+  int64_t regs_per_block = 65536;
+  int64_t regs_per_multiprocessor = 65536;
+  int64_t shared_mem_per_block = 49152;
+  int64_t shared_mem_per_block_optin = 166912;
+  int64_t shared_mem_per_multiprocessor = 167936;
+  int64_t reserved_shared_mem_per_block = 1024;
+  int64_t l2_cache_size = 41943040;
+  // Bytes per second of DRAM bandwidth. Zero if unknown. Normalization
+  // heuristics use this and clock_rate_khz to estimate the bytes in flight
+  // needed to saturate memory, so descriptors should give both.
+  double memory_bandwidth = 0.0;
+  // SM clock rate. Zero if unknown.
+  int64_t clock_rate_khz = 0;
+
+  // Leaves memory_bandwidth and clock_rate_khz unknown, because recent CUDA
+  // versions no longer report clocks in cudaDeviceProp.
+  NVF_API static TargetDevice fromCudaDeviceProp(const cudaDeviceProp& prop);
+
+  // Describes CUDA device `device`, including clocks.
+  NVF_API static TargetDevice fromDevice(int device);
+
+  NVF_API static TargetDevice parse(std::istream& is);
+
+  NVF_API static TargetDevice fromFile(const std::string& path);
+
+  // Returns a cudaDeviceProp with the fields above filled in, so existing
+  // code, e.g., the CUDA occupancy calculator, can consume a TargetDevice.
+  // Other fields are zero.
+  NVF_API cudaDeviceProp toCudaDeviceProp() const;
+
+  bool operator==(const TargetDevice& other) const;
+};
+
+std::ostream& operator<<(std::ostream& os, const TargetDevice& target);
+
+// Returns the properties heuristics and lowering should use instead of
+// at::cuda::getCurrentDeviceProperties(). These come from the innermost
+// TargetDeviceGuard, or else the descriptor file named by
+// NVFUSER_TARGET_DEVICE, or else the current CUDA device. Executing kernels
+// still queries the actual device.
+NVF_API const cudaDeviceProp* getTargetDeviceProperties();
+
+// Returns the TargetDevice getTargetDeviceProperties describes.
+NVF_API TargetDevice currentTargetDevice();
+
+// A TargetDevice along with the cudaDeviceProp it converts to, so the latter
+// can be handed out by pointer.
+struct TargetDeviceProperties {
+  TargetDevice target;
+  cudaDeviceProp properties;
+};
+
+// Returns the target installed on the calling thread by a TargetDeviceGuard
+// or an InheritedOptionsGuard, or nullptr if there's none.
+NVF_API std::shared_ptr<const TargetDeviceProperties> guardedTargetDevice();
+
+// Installs `target` on the calling thread, or uninstalls the current one if
+// nullptr, and returns what was installed before.
+NVF_API std::shared_ptr<const TargetDeviceProperties>
+exchangeGuardedTargetDevice(
+    std::shared_ptr<const TargetDeviceProperties> target);
+
+// Makes `target` the target device of the calling thread while in scope.
+// Like options, the target is captured by InheritedOptions, so it's also
+// seen by the threads that compile segments in parallel or in the
+// background on behalf of this one.
+class NVF_API TargetDeviceGuard {
+ public:
+  explicit TargetDeviceGuard(TargetDevice target);
+  ~TargetDeviceGuard();
+
+  TargetDeviceGuard(const TargetDeviceGuard&) = delete;
+  TargetDeviceGuard& operator=(const TargetDeviceGuard&) = delete;
+
+  const TargetDevice& target() const {
+    return target_->target;
+  }
+
+  const cudaDeviceProp* properties() const {
+    return &target_->properties;
+  }
+
+ private:
+  const std::shared_ptr<const TargetDeviceProperties> target_;
+  const std::shared_ptr<const TargetDeviceProperties> prev_target_;
+};
+
+} // namespace nvfuser
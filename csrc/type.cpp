@@ -14,6 +14,7 @@
 #include <unordered_map>
 
 #include <ir/all_nodes.h>
+#include <target_device.h>
 #include <tensor_metadata.h>
 
 namespace nvfuser {
@@ -166,7 +167,7 @@ DataType getComplexTypeFromType(DataType dtype) {
 }
 
 bool isSupportedTypeByDevice(DataType dtype) {
-  auto prop = at::cuda::getCurrentDeviceProperties();
+  auto prop = getTargetDeviceProperties();
   auto major_ver = prop->major;
   if (dtype == DataType::BFloat16) {
     return major_ver >= 8;
@@ -158,11 +158,16 @@ struct OpaqueType {
   std::string name;
   std::reference_wrapper<const std::type_info> type_info;
   size_t size;
+  // 0 if unknown, e.g., for types inferred from an Opaque value.
+  size_t alignment = 0;
 
   template <typename T>
   static OpaqueType make(std::string name = "") {
     return OpaqueType{
-        .name = std::move(name), .type_info = typeid(T), .size = sizeof(T)};
+        .name = std::move(name),
+        .type_info = typeid(T),
+        .size = sizeof(T),
+        .alignment = alignof(T)};
   }
 
   inline bool operator==(const OpaqueType& other) const {
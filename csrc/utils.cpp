@@ -12,6 +12,7 @@
 #include <debug.h>
 #include <options.h>
 #include <runtime/executor_kernel_arg.h>
+#include <target_device.h>
 #include <utils.h>
 
 #include <cstdlib>
@@ -116,7 +117,7 @@ std::vector<int64_t> getTensorSizes(at::TensorTypePtr const& tensor_type) {
 int64_t getRegPerThreadGivenThreadsPerSM(int64_t threads_per_sm) {
   int num_partition = 0;
   int reg_allocation_granularity = 0;
-  const auto prop = at::cuda::getCurrentDeviceProperties();
+  const auto prop = getTargetDeviceProperties();
   cudaOccDeviceProp occ_prop(*prop);
   cudaOccSubPartitionsPerMultiprocessor(&num_partition, &occ_prop);
   cudaOccRegAllocationGranularity(&reg_allocation_granularity, &occ_prop);
@@ -139,7 +140,7 @@ int64_t getRegPerThreadGivenThreadsPerSM(int64_t threads_per_sm) {
 int64_t getThreadsPerSMGivenRegPerThread(int64_t reg_per_thread) {
   int num_partition = 0;
   int reg_allocation_granularity = 0;
-  const auto prop = at::cuda::getCurrentDeviceProperties();
+  const auto prop = getTargetDeviceProperties();
   cudaOccDeviceProp occ_prop(*prop);
   cudaOccSubPartitionsPerMultiprocessor(&num_partition, &occ_prop);
   cudaOccRegAllocationGranularity(&reg_allocation_granularity, &occ_prop);
@@ -182,7 +183,7 @@ const char* getNvFuserEnv(const char* env_name, const char* default_value) {
 }
 
 size_t deviceAvailableSharedMemoryBytes() {
-  const auto properties = at::cuda::getCurrentDeviceProperties();
+  const auto properties = getTargetDeviceProperties();
   const size_t device_smem_limit = properties->sharedMemPerBlockOptin;
   return device_smem_limit;
 }
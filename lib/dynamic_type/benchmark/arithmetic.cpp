@@ -0,0 +1,144 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+
+#include <benchmark/benchmark.h>
+
+#include <dynamic_type/dynamic_type.h>
+
+#include <complex>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace dynamic_type;
+
+// Scalar arithmetic on dynamic types, which is what the expression evaluator
+// does most of the time. Each benchmark computes a * b + c over arrays of
+// random operands. The Dispatch variants call the generic dispatch directly,
+// which is what binary operators did before they got a fast path for scalars.
+
+struct SomeType {};
+
+using Scalars = DynamicType<NoContainers, int64_t, double, bool>;
+
+// Roughly the member types of nvFuser's PolymorphicValue.
+using ManyTypes = DynamicType<
+    Containers<std::vector>,
+    std::complex<double>,
+    double,
+    int64_t,
+    bool,
+    float*,
+    std::string,
+    SomeType>;
+
+constexpr int64_t kSize = 4096;
+
+template <typename T>
+static std::vector<T> getRandomOperands(bool floating_point) {
+  std::default_random_engine generator;
+  std::uniform_int_distribution<int64_t> distribution(1, 1000);
+  std::vector<T> result;
+  result.reserve(kSize);
+  for (int64_t i = 0; i < kSize; i++) {
+    if (floating_point && i % 2 == 1) {
+      result.emplace_back((double)distribution(generator) / 7.0);
+    } else {
+      result.emplace_back(distribution(generator));
+    }
+  }
+  return result;
+}
+
+static void Arithmetic_Native(benchmark::State& state) {
+  auto a = getRandomOperands<int64_t>(false);
+  auto b = getRandomOperands<int64_t>(false);
+  auto c = getRandomOperands<int64_t>(false);
+  for (auto _ : state) {
+    for (int64_t i = 0; i < kSize; i++) {
+      benchmark::DoNotOptimize(a[i] * b[i] + c[i]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+
+template <typename DT>
+static void BenchmarkOperators(benchmark::State& state) {
+  const bool floating_point = state.range(0);
+  auto a = getRandomOperands<DT>(floating_point);
+  auto b = getRandomOperands<DT>(false);
+  auto c = getRandomOperands<DT>(floating_point);
+  for (auto _ : state) {
+    for (int64_t i = 0; i < kSize; i++) {
+      benchmark::DoNotOptimize(a[i] * b[i] + c[i]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+
+template <typename DT>
+static void BenchmarkDispatch(benchmark::State& state) {
+  const bool floating_point = state.range(0);
+  auto a = getRandomOperands<DT>(floating_point);
+  auto b = getRandomOperands<DT>(false);
+  auto c = getRandomOperands<DT>(floating_point);
+  auto mul = [](const auto& x, const auto& y) -> decltype(auto) {
+    using X = decltype(x);
+    using Y = decltype(y);
+    if constexpr (opcheck<X> * opcheck<Y>) {
+      if constexpr (std::is_convertible_v<decltype(x * y), DT>) {
+        return x * y;
+      }
+    }
+  };
+  auto add = [](const auto& x, const auto& y) -> decltype(auto) {
+    using X = decltype(x);
+    using Y = decltype(y);
+    if constexpr (opcheck<X> + opcheck<Y>) {
+      if constexpr (std::is_convertible_v<decltype(x + y), DT>) {
+        return x + y;
+      }
+    }
+  };
+  for (auto _ : state) {
+    for (int64_t i = 0; i < kSize; i++) {
+      DT product = DT::dispatch(mul, a[i], b[i]);
+      benchmark::DoNotOptimize(DT(DT::dispatch(add, product, c[i])));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+
+static void Arithmetic_Scalars(benchmark::State& state) {
+  BenchmarkOperators<Scalars>(state);
+}
+
+static void Arithmetic_Scalars_Dispatch(benchmark::State& state) {
+  BenchmarkDispatch<Scalars>(state);
+}
+
+static void Arithmetic_ManyTypes(benchmark::State& state) {
+  BenchmarkOperators<ManyTypes>(state);
+}
+
+static void Arithmetic_ManyTypes_Dispatch(benchmark::State& state) {
+  BenchmarkDispatch<ManyTypes>(state);
+}
+
+// The argument is whether half of the operands are doubles.
+BENCHMARK(Arithmetic_Native)->Unit(benchmark::kMicrosecond);
+BENCHMARK(Arithmetic_Scalars)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+BENCHMARK(Arithmetic_Scalars_Dispatch)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(Arithmetic_ManyTypes)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+BENCHMARK(Arithmetic_ManyTypes_Dispatch)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond);
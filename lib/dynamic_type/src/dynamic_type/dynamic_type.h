@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <optional>
 #include <ostream>
@@ -568,6 +569,64 @@ struct is_dynamic_type<DynamicType<Ts...>> : std::true_type {};
 template <typename T>
 constexpr bool is_dynamic_type_v = is_dynamic_type<T>::value;
 
+// Fast path of binary operators for the common case of two scalars, for
+// example, when the expression evaluator computes extents. The generic
+// DynamicType::dispatch visits the member types of both operands one after
+// another, so the cost of int64_t + int64_t grows with the number of member
+// types. Here we first check the operands against a few scalar types directly,
+// and only fall back to the generic dispatch if they don't match. `f` is the
+// same function that the generic dispatch calls, so the result is the same.
+template <typename RetT, typename DT, typename FuncT, typename A, typename B>
+constexpr bool scalar_fast_path_applicable =
+    DT::template is_candidate_type<A> && DT::template is_candidate_type<B> &&
+    std::is_invocable_r_v<RetT, FuncT&, const A&, const B&>;
+
+template <typename RetT, typename DT, typename FuncT, typename A>
+inline constexpr std::optional<RetT> scalarDispatchRhs(
+    FuncT& f,
+    const A& a,
+    const DT& y) {
+  if constexpr (scalar_fast_path_applicable<RetT, DT, FuncT, A, int64_t>) {
+    if (const int64_t* b = std::get_if<int64_t>(&y.value)) {
+      return f(a, *b);
+    }
+  }
+  if constexpr (scalar_fast_path_applicable<RetT, DT, FuncT, A, double>) {
+    if (const double* b = std::get_if<double>(&y.value)) {
+      return f(a, *b);
+    }
+  }
+  if constexpr (scalar_fast_path_applicable<RetT, DT, FuncT, A, bool>) {
+    if (const bool* b = std::get_if<bool>(&y.value)) {
+      return f(a, *b);
+    }
+  }
+  return std::nullopt;
+}
+
+template <typename RetT, typename DT, typename FuncT>
+inline constexpr std::optional<RetT> scalarDispatch(
+    FuncT& f,
+    const DT& x,
+    const DT& y) {
+  if constexpr (DT::template is_candidate_type<int64_t>) {
+    if (const int64_t* a = std::get_if<int64_t>(&x.value)) {
+      return scalarDispatchRhs<RetT>(f, *a, y);
+    }
+  }
+  if constexpr (DT::template is_candidate_type<double>) {
+    if (const double* a = std::get_if<double>(&x.value)) {
+      return scalarDispatchRhs<RetT>(f, *a, y);
+    }
+  }
+  if constexpr (DT::template is_candidate_type<bool>) {
+    if (const bool* a = std::get_if<bool>(&x.value)) {
+      return scalarDispatchRhs<RetT>(f, *a, y);
+    }
+  }
+  return std::nullopt;
+}
+
 #define DEFINE_BINARY_OP(opname, op, func_name, return_type, check_existence)  \
   template <typename X, typename Y, typename RetT>                             \
   constexpr bool opname##_type_compatible() {                                  \
@@ -638,30 +697,34 @@ constexpr bool is_dynamic_type_v = is_dynamic_type<T>::value;
             opcheck<std::decay_t<RHS>>)) {                                     \
       return (DT)x op y;                                                       \
     } else {                                                                   \
-      return DT::dispatch(                                                     \
-          [](auto&& x, auto&& y) -> decltype(auto) {                           \
-            using X = decltype(x);                                             \
-            using Y = decltype(y);                                             \
-            if constexpr (false) {                                             \
-              /* TODO: This doesn't work on gcc 11.4 with C++20, temporarily   \
-               * disabled and use the more verbose implementation below. We    \
-               * should reenable this when we upgrade our compilers. */        \
-              if constexpr (opname##_type_compatible<X, Y, return_type>()) {   \
-                return std::forward<X>(x) op std::forward<Y>(y);               \
-              }                                                                \
-            } else {                                                           \
-              if constexpr (opcheck<X> op opcheck<Y>) {                        \
-                if constexpr (std::is_convertible_v<                           \
-                                  decltype(std::declval<X>()                   \
-                                               op std::declval<Y>()),          \
-                                  return_type>) {                              \
-                  return std::forward<X>(x) op std::forward<Y>(y);             \
-                }                                                              \
-              }                                                                \
+      auto f = [](auto&& x, auto&& y) -> decltype(auto) {                      \
+        using X = decltype(x);                                                 \
+        using Y = decltype(y);                                                 \
+        if constexpr (false) {                                                 \
+          /* TODO: This doesn't work on gcc 11.4 with C++20, temporarily       \
+           * disabled and use the more verbose implementation below. We        \
+           * should reenable this when we upgrade our compilers. */            \
+          if constexpr (opname##_type_compatible<X, Y, return_type>()) {       \
+            return std::forward<X>(x) op std::forward<Y>(y);                   \
+          }                                                                    \
+        } else {                                                               \
+          if constexpr (opcheck<X> op opcheck<Y>) {                            \
+            if constexpr (std::is_convertible_v<                               \
+                              decltype(std::declval<X>()                       \
+                                           op std::declval<Y>()),              \
+                              return_type>) {                                  \
+              return std::forward<X>(x) op std::forward<Y>(y);                 \
             }                                                                  \
-          },                                                                   \
-          std::forward<LHS>(x),                                                \
-          std::forward<RHS>(y));                                               \
+          }                                                                    \
+        }                                                                      \
+      };                                                                       \
+      if constexpr (std::is_same_v<std::decay_t<LHS>, std::decay_t<RHS>>) {    \
+        if (std::optional<return_type> ret =                                   \
+                scalarDispatch<return_type>(f, x, y)) {                        \
+          return *std::move(ret);                                              \
+        }                                                                      \
+      }                                                                        \
+      return DT::dispatch(f, std::forward<LHS>(x), std::forward<RHS>(y));      \
     }                                                                          \
   }
 
@@ -360,6 +360,49 @@ TEST_F(DynamicTypeTest, BinaryOpAdvancedTyping) {
   static_assert((Int(2) && Int(3)) == 1);
 }
 
+// Binary operators on two scalars don't go through the generic dispatch. Check
+// that they still promote and compute exactly like it does.
+TEST_F(DynamicTypeTest, ScalarFastPathMatchesDispatch) {
+  static_assert((DoubleInt64Bool(true) + DoubleInt64Bool(true)).is<int64_t>());
+  static_assert((DoubleInt64Bool(true) + DoubleInt64Bool(true)) == 2L);
+  static_assert((DoubleInt64Bool(3L) / DoubleInt64Bool(2L)) == 1L);
+  static_assert((DoubleInt64Bool(3L) / DoubleInt64Bool(2.0)) == 1.5);
+  static_assert((DoubleInt64Bool(3L) < DoubleInt64Bool(3.5)));
+
+  std::vector<DoubleInt64BoolVec> operands{
+      3L, -7L, 2.5, -0.5, true, false, std::vector<DoubleInt64BoolVec>{1L}};
+  auto add = [](const auto& x, const auto& y) -> decltype(auto) {
+    if constexpr (opcheck<decltype(x)> + opcheck<decltype(y)>) {
+      using Sum = decltype(x + y);
+      if constexpr (std::is_convertible_v<Sum, DoubleInt64BoolVec>) {
+        return x + y;
+      }
+    }
+  };
+  auto lt = [](const auto& x, const auto& y) -> decltype(auto) {
+    if constexpr (opcheck<decltype(x)> < opcheck<decltype(y)>) {
+      if constexpr (std::is_convertible_v<decltype(x < y), bool>) {
+        return x < y;
+      }
+    }
+  };
+  for (const auto& x : operands) {
+    for (const auto& y : operands) {
+      if (x.is<std::vector>() || y.is<std::vector>()) {
+        continue;
+      }
+      DoubleInt64BoolVec sum = x + y;
+      DoubleInt64BoolVec expected_sum = DoubleInt64BoolVec::dispatch(add, x, y);
+      EXPECT_EQ(sum.type(), expected_sum.type());
+      EXPECT_EQ(sum, expected_sum);
+      EXPECT_EQ(x < y, (bool)DoubleInt64BoolVec::dispatch(lt, x, y));
+    }
+  }
+  // Operands that are not both scalars still go through the generic dispatch.
+  EXPECT_EQ(operands.back(), DoubleInt64BoolVec(std::vector<int64_t>{1L}));
+  EXPECT_NE(operands.back(), DoubleInt64BoolVec(std::vector<int64_t>{2L}));
+}
+
 #if defined(__clang__)
 #pragma clang diagnostic pop
 #endif
@@ -17,6 +17,7 @@
 #include <utils.h>
 
 #include <filesystem>
+#include <map>
 namespace fs = std::filesystem;
 
 #ifdef _WIN32
@@ -183,6 +184,68 @@ void serialize() {
   }
 }
 
+std::vector<std::unique_ptr<Fusion>> deserializeFusionDefinitions(
+    const std::string& filename) {
+  FUSER_PERF_SCOPE("FusionCache::deserializeFusionDefinitions");
+  const BinaryBuffer& buffer = openFusionCache(filename);
+  const serde::FusionCache* fusion_cache_buffer =
+      serde::GetFusionCache(buffer.data());
+  flatbuffers::Verifier v(buffer.data(), buffer.size());
+  NVF_CHECK(
+      fusion_cache_buffer->Verify(v),
+      "Failed to verify the integrity of FusionCache buffer.");
+  NVF_CHECK(
+      serde::FusionCacheBufferHasIdentifier(buffer.data()),
+      "Failed to verify the schema version of the FusionCache buffer");
+
+  serde::RecordFunctorFactory record_functor_factory;
+  std::map<size_t, std::unique_ptr<Fusion>> fusions;
+
+  // Walk the Trie depth-first from the root, so only the FusionStates along
+  // one path are alive at a time.
+  using DfsState = std::pair<size_t, std::unique_ptr<FusionState>>;
+  std::vector<DfsState> stack;
+  stack.emplace_back(0, std::make_unique<FusionState>());
+  while (!stack.empty()) {
+    auto [structure_idx, state] = std::move(stack.back());
+    stack.pop_back();
+
+    auto fb_trie_node = fusion_cache_buffer->structure()->Get(structure_idx);
+    auto serde_buffer = fb_trie_node->record();
+    state->addRecord(
+        record_functor_factory.parse(serde_buffer->type(), serde_buffer));
+
+    if (fb_trie_node->is_terminal()) {
+      auto fusion = std::make_unique<Fusion>();
+      try {
+        state->buildFusionIr(fusion.get());
+      } catch (const nvfError& e) {
+        // Like FusionCache::deserialize, which records the error on the
+        // terminal node instead of failing.
+        TORCH_WARN(
+            "Skipping fusion ",
+            fb_trie_node->fusion_id(),
+            " whose definition failed to build: ",
+            e.what());
+        continue;
+      }
+      fusions.emplace(fb_trie_node->fusion_id(), std::move(fusion));
+      continue;
+    }
+
+    for (auto child_bfs_idx : *fb_trie_node->children()) {
+      stack.emplace_back(child_bfs_idx, state->clone());
+    }
+  }
+
+  std::vector<std::unique_ptr<Fusion>> ordered_fusions;
+  ordered_fusions.reserve(fusions.size());
+  for (auto&& [fusion_id, fusion] : fusions) {
+    ordered_fusions.push_back(std::move(fusion));
+  }
+  return ordered_fusions;
+}
+
 // FusionCache static data member definitions for singleton usage
 std::mutex FusionCache::singleton_lock_;
 FusionCache* FusionCache::singleton_ = nullptr;
@@ -876,6 +939,7 @@ void FusionCache::deserialize(std::string filename) {
   }
 
   std::atomic<bool> detect_exception_in_thread_pool{false};
+  const InheritedOptions inherited_options = InheritedOptions::capture();
   // Deserialize terminal_nodes field in the FusionCache table
   for (auto idx : arange(fusion_cache_buffer->terminal_nodes()->size())) {
     auto node_idx = fusion_cache_buffer->terminal_nodes()->Get(idx);
@@ -892,6 +956,7 @@ void FusionCache::deserialize(std::string filename) {
       // Parallelize the deserialization of each FusionExecutorCache.
       getThreadPool()->run([=, &detect_exception_in_thread_pool]() {
         FUSER_PERF_SCOPE("FusionCache::deserializeFusionParallel");
+        InheritedOptionsGuard options_guard(inherited_options);
         try {
           fusion_schedule->auto_gen_schedules->deserialize(
               fb_fec_node, (int64_t)trie_node->fusion_id);
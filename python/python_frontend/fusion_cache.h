@@ -313,4 +313,13 @@ class FusionCache {
 //! '''
 NVF_API void serialize();
 
+//! Rebuild the unscheduled Fusion of every definition in a serialized
+//! FusionCache, in the order of their fusion ids. Unlike
+//! FusionCache::deserialize, this neither restores compiled kernels nor
+//! requires the device the cache was serialized on, so the definitions can
+//! be scheduled and lowered elsewhere. Definitions that fail to build, like
+//! ones that failed when they were recorded, are skipped with a warning.
+NVF_API std::vector<std::unique_ptr<Fusion>> deserializeFusionDefinitions(
+    const std::string& filename);
+
 } // namespace nvfuser::python_frontend
@@ -726,7 +726,8 @@ void initNvFuserPythonBindings(PyObject* module) {
       .value("outer_persistent", SchedulerType::OuterPersistent)
       .value("transpose", SchedulerType::Transpose)
       .value("expr_eval", SchedulerType::ExprEval)
-      .value("resize", SchedulerType::Resize);
+      .value("resize", SchedulerType::Resize)
+      .value("foreach", SchedulerType::ForEach);
 
   py::enum_<CommunicatorBackend>(nvfuser, "CommunicatorBackend")
       .value("nccl", CommunicatorBackend::kNccl)
@@ -38,6 +38,16 @@ __device__ nvfuser_index_t offset(const _dim3& idx, const _dim3_2& dim) {
   return offset;
 }
 
+// Inverse of offset. Returns the index whose linearized offset in dim is
+// the provided offset.
+template <typename _dim3>
+__device__ uint3 unlinearize(nvfuser_index_t offset, const _dim3& dim) {
+  return uint3{
+      (unsigned)(offset % dim.x),
+      (unsigned)(offset / dim.x % dim.y),
+      (unsigned)(offset / ((nvfuser_index_t)dim.x * dim.y))};
+}
+
 // Masks the provided dim3, those == false get truncated to 1
 template <bool X, bool Y, bool Z, typename _dim3>
 __device__ dim3 maskedDims(const _dim3& dim) {
@@ -0,0 +1,185 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <gtest/gtest.h>
+
+#include <fusion.h>
+#include <ops/all_ops.h>
+#include <options.h>
+#include <runtime/executor.h>
+#include <runtime/fusion_executor_cache.h>
+#include <tests/cpp/utils.h>
+#include <tests/cpp/validator.h>
+
+namespace nvfuser {
+
+using AsyncCompileTest = NVFuserTest;
+
+namespace {
+
+std::unique_ptr<Fusion> makeFusion() {
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+  TensorView* x = makeContigTensor(2);
+  TensorView* y = makeContigTensor(2);
+  fusion->addInput(x);
+  fusion->addInput(y);
+  TensorView* z = mul(add(x, y), IrBuilder::create<Val>(2.0));
+  fusion->addOutput(z);
+  fusion->addOutput(sum(z, {1}));
+  return fusion;
+}
+
+} // namespace
+
+// The fallback evaluates an unscheduled fusion op by op with ATen.
+TEST_F(AsyncCompileTest, EagerFallback) {
+  std::unique_ptr<Fusion> fusion = makeFusion();
+
+  ExprEvalExecutor ee;
+  ee.compileEager(fusion.get());
+
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  at::Tensor x = at::randn({4, 8}, options);
+  at::Tensor y = at::randn({4, 8}, options);
+  KernelArgumentHolder outputs = ee.run({x, y});
+  ASSERT_EQ(outputs.size(), 2);
+  const at::Tensor z = (x + y) * 2.0;
+  EXPECT_TRUE(at::allclose(outputs[0].as<at::Tensor>(), z));
+  EXPECT_TRUE(at::allclose(outputs[1].as<at::Tensor>(), z.sum({1})));
+}
+
+// CPU scalar tensors are evaluated on the host and broadcast to the device
+// inputs, as kernels do.
+TEST_F(AsyncCompileTest, EagerFallbackWithCpuScalar) {
+  auto fusion = std::make_unique<Fusion>();
+  {
+    FusionGuard fg(fusion.get());
+    TensorView* x = makeContigTensor(2);
+    TensorView* s = makeContigTensor(0);
+    s->setCpuScalar(true);
+    fusion->addInput(x);
+    fusion->addInput(s);
+    fusion->addOutput(mul(x, s));
+  }
+
+  FusionExecutorCache executor_cache(std::move(fusion));
+  executor_cache.setCompilationPolicy(CompilationPolicy::Background);
+
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  at::Tensor x = at::randn({4, 8}, options);
+  at::Tensor s = at::scalar_tensor(3.0, at::TensorOptions().dtype(at::kFloat));
+  ASSERT_TRUE(s.is_cpu());
+  auto outputs = executor_cache.runFusionWithInputs({x, s});
+  EXPECT_EQ(executor_cache.backgroundCompilationStats().eager_fallbacks, 1);
+  EXPECT_TRUE(at::allclose(outputs[0].as<at::Tensor>(), x * 3.0));
+
+  executor_cache.waitForBackgroundCompilation();
+  outputs = executor_cache.runFusionWithInputs({x, s});
+  EXPECT_EQ(executor_cache.backgroundCompilationStats().eager_fallbacks, 1);
+  EXPECT_TRUE(at::allclose(outputs[0].as<at::Tensor>(), x * 3.0));
+}
+
+TEST_F(AsyncCompileTest, EagerFallbackUpdatesAliasedInput) {
+  auto fusion = std::make_unique<Fusion>();
+  {
+    FusionGuard fg(fusion.get());
+    TensorView* x = makeContigTensor(1);
+    fusion->addInput(x);
+    TensorView* y = add(x, IrBuilder::create<Val>(1.0));
+    fusion->addOutput(y);
+    fusion->aliasOutputToInput(y, x, AllocationType::ReuseBuffer);
+  }
+
+  FusionExecutorCache executor_cache(std::move(fusion));
+  executor_cache.setCompilationPolicy(CompilationPolicy::Background);
+
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  at::Tensor x = at::zeros({128}, options);
+  executor_cache.runFusionWithInputs({x});
+  executor_cache.waitForBackgroundCompilation();
+  executor_cache.runFusionWithInputs({x});
+
+  // Both the eager and the compiled run update x in place.
+  EXPECT_TRUE(at::allclose(x, at::full_like(x, 2.0)));
+}
+
+TEST_F(AsyncCompileTest, SwitchToCompiledKernel) {
+  FusionExecutorCache executor_cache(makeFusion());
+  executor_cache.setCompilationPolicy(CompilationPolicy::Background);
+
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  at::Tensor x = at::randn({1024, 256}, options);
+  at::Tensor y = at::randn({1024, 256}, options);
+
+  // The first call can't wait for the compilation and evaluates with ATen.
+  auto outputs = executor_cache.runFusionWithInputs({x, y});
+  testValidate(executor_cache.fusion(), outputs, {x, y}, __LINE__, __FILE__);
+  const BackgroundCompilationStats& stats =
+      executor_cache.backgroundCompilationStats();
+  EXPECT_EQ(stats.background_compilations, 1);
+  EXPECT_EQ(stats.eager_fallbacks, 1);
+
+  executor_cache.waitForBackgroundCompilation();
+  EXPECT_TRUE(executor_cache.isCompiled({x, y}));
+
+  outputs = executor_cache.runFusionWithInputs({x, y});
+  testValidate(executor_cache.fusion(), outputs, {x, y}, __LINE__, __FILE__);
+  EXPECT_EQ(stats.eager_fallbacks, 1);
+  EXPECT_EQ(stats.background_compilations, 1);
+  EXPECT_TRUE(executor_cache.getMostRecentKernelRuntime()->isCompiled());
+}
+
+// Compiling kernels for new inputs doesn't stop the compiled kernels of
+// earlier inputs from being used.
+TEST_F(AsyncCompileTest, CompiledInputsDontFallBack) {
+  // So the second inputs get a runtime of their own
+  DisableOptionsGuard opt_guard;
+  DisableOptionsGuard::getCurOptions().set(DisableOption::KernelReuse);
+
+  FusionExecutorCache executor_cache(makeFusion());
+  executor_cache.setCompilationPolicy(CompilationPolicy::Background);
+
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  at::Tensor x = at::randn({1024, 256}, options);
+  at::Tensor y = at::randn({1024, 256}, options);
+  executor_cache.runFusionWithInputs({x, y});
+  executor_cache.waitForBackgroundCompilation();
+
+  // Starts compiling a second runtime in the background.
+  at::Tensor x2 = at::randn({16, 32}, options);
+  at::Tensor y2 = at::randn({16, 32}, options);
+  executor_cache.runFusionWithInputs({x2, y2});
+  const BackgroundCompilationStats& stats =
+      executor_cache.backgroundCompilationStats();
+  EXPECT_EQ(stats.background_compilations, 2);
+  const int64_t eager_fallbacks = stats.eager_fallbacks;
+
+  // Whether or not the second compilation is done, the first inputs run the
+  // kernels compiled for them.
+  auto outputs = executor_cache.runFusionWithInputs({x, y});
+  EXPECT_EQ(stats.eager_fallbacks, eager_fallbacks);
+  EXPECT_TRUE(executor_cache.getMostRecentKernelRuntime()->isCompiled());
+  testValidate(executor_cache.fusion(), outputs, {x, y}, __LINE__, __FILE__);
+
+  executor_cache.waitForBackgroundCompilation();
+}
+
+TEST_F(AsyncCompileTest, BlockingByDefault) {
+  FusionExecutorCache executor_cache(makeFusion());
+  EXPECT_EQ(executor_cache.compilationPolicy(), CompilationPolicy::Blocking);
+
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  at::Tensor x = at::randn({16, 32}, options);
+  at::Tensor y = at::randn({16, 32}, options);
+  auto outputs = executor_cache.runFusionWithInputs({x, y});
+  testValidate(executor_cache.fusion(), outputs, {x, y}, __LINE__, __FILE__);
+  EXPECT_EQ(executor_cache.backgroundCompilationStats().eager_fallbacks, 0);
+  EXPECT_TRUE(executor_cache.getMostRecentKernelRuntime()->isCompiled());
+}
+
+} // namespace nvfuser
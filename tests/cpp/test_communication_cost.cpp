@@ -0,0 +1,247 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <expr_evaluator.h>
+#include <fusion.h>
+#include <ir/all_nodes.h>
+#include <multidevice/communication_cost.h>
+#include <multidevice/device_mesh.h>
+#include <multidevice/utils.h>
+#include <ops/all_ops.h>
+#include <preseg_passes/insert_reshardings.h>
+#include <tests/cpp/utils.h>
+
+namespace nvfuser {
+
+using testing::ElementsAre;
+using testing::Field;
+using testing::Optional;
+using testing::SizeIs;
+
+using CommunicationCostTest = NVFuserTest;
+
+TEST_F(CommunicationCostTest, RingFormulas) {
+  CommunicationCostModel model;
+  model.link_bandwidth = 1e9;
+  model.link_latency = 0.0;
+
+  constexpr int64_t kBytes = 1024;
+  EXPECT_EQ(model.bytesPerDevice(CommunicationType::Allgather, 4, kBytes), 768);
+  EXPECT_EQ(
+      model.bytesPerDevice(CommunicationType::ReduceScatter, 4, kBytes), 768);
+  EXPECT_EQ(
+      model.bytesPerDevice(CommunicationType::Allreduce, 4, kBytes), 1536);
+  EXPECT_EQ(model.bytesPerDevice(CommunicationType::Broadcast, 4, kBytes), 1024);
+  EXPECT_EQ(model.bytesPerDevice(CommunicationType::SendRecv, 4, kBytes), 256);
+  // A single device doesn't communicate.
+  EXPECT_EQ(model.bytesPerDevice(CommunicationType::Allreduce, 1, kBytes), 0);
+
+  EXPECT_EQ(model.numSteps(CommunicationType::Allgather, 4), 3);
+  EXPECT_EQ(model.numSteps(CommunicationType::Allreduce, 4), 6);
+  EXPECT_DOUBLE_EQ(
+      model.time(CommunicationType::Allgather, 4, kBytes), 768 / 1e9);
+
+  model.link_latency = 1e-6;
+  EXPECT_DOUBLE_EQ(
+      model.time(CommunicationType::Allgather, 4, kBytes), 3e-6 + 768 / 1e9);
+}
+
+// An allreduce is twice as expensive as a reduce-scatter of the same buffer.
+// This is why reduce-scattering and allgathering later can pay off.
+TEST_F(CommunicationCostTest, AllreduceVsReduceScatter) {
+  const CommunicationCostModel model;
+  for (int64_t team_size : {2, 4, 8}) {
+    EXPECT_EQ(
+        model.bytesPerDevice(CommunicationType::Allreduce, team_size, 1 << 20),
+        2 *
+            model.bytesPerDevice(
+                CommunicationType::ReduceScatter, team_size, 1 << 20));
+  }
+}
+
+TEST_F(CommunicationCostTest, UnshardedSize) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  constexpr int64_t kNumDevices = 4;
+  TensorView* in = makeContigConcreteTensor({kNumDevices * 2, 3});
+  fusion.addInput(in);
+  TensorView* out = sum(in, {1});
+  fusion.addOutput(out);
+
+  in->setDeviceMesh(DeviceMesh::createForNumDevices(kNumDevices));
+  in->outer_split(0, kNumDevices);
+  in->axis(0)->parallelize(ParallelType::DIDx);
+
+  // Sharded dimensions count with their global extents and reduction
+  // dimensions are ignored.
+  EXPECT_THAT(unshardedSizeInBytes(in), Optional(kNumDevices * 2 * 3 * 4));
+  EXPECT_THAT(unshardedSizeInBytes(out), Optional(kNumDevices * 2 * 4));
+
+  TensorView* symbolic = makeContigTensor(2);
+  EXPECT_EQ(unshardedSizeInBytes(symbolic), std::nullopt);
+}
+
+TEST_F(CommunicationCostTest, DryRun) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  constexpr int64_t kNumDevices = 2;
+  const auto mesh = DeviceMesh::createForNumDevices(kNumDevices);
+
+  TensorView* in = makeContigConcreteTensor({kNumDevices, 2, 3});
+  fusion.addInput(in);
+  TensorView* allreduce = sum(in, {0});
+  TensorView* out = add(allreduce, allreduce);
+  fusion.addOutput(out);
+
+  for (auto* tv : {in, allreduce, out}) {
+    tv->setDeviceMesh(mesh);
+  }
+  in->axis(0)->parallelize(ParallelType::DIDx);
+
+  CommunicationCostModel model;
+  model.link_bandwidth = 1e9;
+  model.link_latency = 0.0;
+  std::vector<CommunicationCost> costs =
+      predictCommunicationCosts(&fusion, model);
+  ASSERT_THAT(costs, SizeIs(1));
+  const CommunicationCost& cost = costs.front();
+  EXPECT_EQ(cost.expr, allreduce->definition());
+  EXPECT_EQ(cost.type, CommunicationType::Allreduce);
+  EXPECT_EQ(cost.team_size, kNumDevices);
+  // The allreduced buffer is [2, 3] floats.
+  EXPECT_THAT(cost.bytes_per_device, Optional(2 * (2 * 3 * 4 / 2)));
+  EXPECT_THAT(cost.time, Optional(24 / 1e9));
+}
+
+// Expanding a sharded tensor and then unsharding it allgathers much less data
+// when the allgather is inserted before the expand.
+TEST_F(CommunicationCostTest, ReshardBeforeExpand) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  constexpr int64_t kNumDevices = 2;
+  const auto mesh = DeviceMesh::createForNumDevices(kNumDevices);
+
+  TensorView* in = makeContigConcreteTensor({kNumDevices * 4});
+  fusion.addInput(in);
+  TensorView* broadcasted = broadcast(in, {false, true});
+  TensorView* out = expand(
+      broadcasted,
+      {IrBuilder::create<Val>(kNumDevices * 4),
+       IrBuilder::create<Val>(1024)});
+  fusion.addOutput(out);
+
+  for (auto* tv : {in, broadcasted, out}) {
+    tv->setDeviceMesh(mesh);
+  }
+  for (auto* tv : {in, broadcasted}) {
+    tv->outer_split(0, kNumDevices);
+    tv->axis(0)->parallelize(ParallelType::DIDx);
+  }
+
+  preseg_passes::OptimizationPass<
+      preseg_passes::InsertReshardingsPass>::runPass(&fusion);
+
+  out = fusion.outputs().at(0)->as<TensorView>();
+  Expr* expand_op = out->definition();
+  ASSERT_TRUE(expand_op->isA<ExpandOp>()) << expand_op;
+  EXPECT_FALSE(isResharding(expand_op));
+
+  Expr* resharding = expand_op->input(0)->definition();
+  ASSERT_NE(resharding, nullptr);
+  EXPECT_TRUE(resharding->isA<LoadStoreOp>()) << resharding;
+  EXPECT_THAT(
+      predictCommunicationCosts(&fusion, CommunicationCostModel()),
+      ElementsAre(Field(
+          &CommunicationCost::type, CommunicationType::Allgather)));
+}
+
+// Computed with the sharding of its input, a reduction over the sharded
+// dimension leaves partial results, which need an allreduce, not an allgather.
+TEST_F(CommunicationCostTest, ReshardAfterReduction) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  constexpr int64_t kNumDevices = 2;
+  const auto mesh = DeviceMesh::createForNumDevices(kNumDevices);
+
+  TensorView* in = makeContigConcreteTensor({kNumDevices * 4, 3});
+  fusion.addInput(in);
+  TensorView* out = sum(in, {0});
+  fusion.addOutput(out);
+
+  for (auto* tv : {in, out}) {
+    tv->setDeviceMesh(mesh);
+  }
+  in->outer_split(0, kNumDevices);
+  in->axis(0)->parallelize(ParallelType::DIDx);
+
+  const CommunicationCostModel model;
+  std::optional<CommunicationCost> before =
+      predictReshardingCost(in, in, out, model);
+  ASSERT_TRUE(before.has_value());
+  EXPECT_EQ(before->type, CommunicationType::Allgather);
+
+  std::optional<CommunicationCost> after =
+      predictReshardingCost(out, in, out, model);
+  ASSERT_TRUE(after.has_value());
+  EXPECT_EQ(after->type, CommunicationType::Allreduce);
+  EXPECT_EQ(after->team_size, kNumDevices);
+  EXPECT_THAT(
+      after->bytes_per_device,
+      Optional(model.bytesPerDevice(
+          CommunicationType::Allreduce, kNumDevices, 3 * 4)));
+}
+
+// Like ReshardBeforeExpand, but with symbolic extents, which the pass can only
+// compare when given an ExpressionEvaluator.
+TEST_F(CommunicationCostTest, ReshardBeforeSymbolicExpand) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  constexpr int64_t kNumDevices = 2;
+  const auto mesh = DeviceMesh::createForNumDevices(kNumDevices);
+
+  TensorView* in = makeContigTensor(1);
+  Val* expanded_extent = IrBuilder::create<Val>(DataType::Int);
+  fusion.addInput(in);
+  fusion.addInput(expanded_extent);
+  Val* extent = in->getLogicalDomain().at(0)->extent();
+  TensorView* broadcasted = broadcast(in, {false, true});
+  TensorView* out = expand(broadcasted, {extent, expanded_extent});
+  fusion.addOutput(out);
+
+  for (auto* tv : {in, broadcasted, out}) {
+    tv->setDeviceMesh(mesh);
+  }
+  for (auto* tv : {in, broadcasted}) {
+    tv->outer_split(0, kNumDevices);
+    tv->axis(0)->parallelize(ParallelType::DIDx);
+  }
+
+  ExpressionEvaluator expr_eval;
+  expr_eval.bind(extent, kNumDevices * 4);
+  expr_eval.bind(expanded_extent, 1024);
+  {
+    preseg_passes::InsertReshardingsPass::ExpressionEvaluatorGuard
+        expr_eval_guard(&expr_eval);
+    preseg_passes::OptimizationPass<
+        preseg_passes::InsertReshardingsPass>::runPass(&fusion);
+  }
+
+  out = fusion.outputs().at(0)->as<TensorView>();
+  Expr* expand_op = out->definition();
+  ASSERT_TRUE(expand_op->isA<ExpandOp>()) << expand_op;
+  EXPECT_FALSE(isResharding(expand_op));
+}
+
+} // namespace nvfuser
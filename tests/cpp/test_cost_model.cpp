@@ -0,0 +1,173 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <fusion.h>
+#include <ops/all_ops.h>
+#include <options.h>
+#include <runtime/fusion_executor_cache.h>
+#include <scheduler/cost_model.h>
+#include <scheduler/heuristic_plugin.h>
+#include <tests/cpp/utils.h>
+#include <tests/cpp/validator.h>
+
+namespace nvfuser {
+
+using testing::HasSubstr;
+using testing::ThrowsMessage;
+
+using CostModelTest = NVFuserTest;
+
+namespace {
+
+// A pointwise segment reading and writing 2^24 floats.
+cost_model::SegmentDescription makePointwiseSegment() {
+  cost_model::SegmentDescription segment;
+  NvfHeuristicProblem& problem = segment.problem;
+  problem.struct_size = sizeof(NvfHeuristicProblem);
+  problem.scheduler_type = NVFUSER_HEURISTIC_PLUGIN_POINTWISE;
+  problem.num_dims = 1;
+  problem.extents[0] = 1 << 24;
+  problem.num_inputs = 1;
+  problem.num_outputs = 1;
+  problem.max_vectorization_factor = 4;
+  problem.max_dtype_size = 4;
+  problem.device_major = 9;
+  problem.device_minor = 0;
+  segment.bytes_read = 4 << 24;
+  segment.bytes_written = 4 << 24;
+  return segment;
+}
+
+} // namespace
+
+TEST_F(CostModelTest, Vectorization) {
+  const cost_model::SegmentDescription segment = makePointwiseSegment();
+  const TargetDevice target;
+
+  PointwiseParams scalar;
+  PointwiseParams vectorized;
+  vectorized.vectorization_factor = 4;
+
+  const cost_model::KernelCostEstimate scalar_cost =
+      cost_model::estimateCost(scalar, segment, target);
+  const cost_model::KernelCostEstimate vectorized_cost =
+      cost_model::estimateCost(vectorized, segment, target);
+  EXPECT_EQ(scalar_cost.blocks, 4 * vectorized_cost.blocks);
+  EXPECT_EQ(scalar_cost.bytes_moved, vectorized_cost.bytes_moved);
+  EXPECT_DOUBLE_EQ(scalar_cost.vectorization_efficiency, 0.25);
+  EXPECT_DOUBLE_EQ(vectorized_cost.vectorization_efficiency, 1.0);
+  EXPECT_LT(vectorized_cost.time_us, scalar_cost.time_us);
+}
+
+// Unrolling too much exhausts registers, which limits occupancy and spills.
+TEST_F(CostModelTest, RegisterPressure) {
+  const cost_model::SegmentDescription segment = makePointwiseSegment();
+  const TargetDevice target;
+
+  PointwiseParams params;
+  params.vectorization_factor = 4;
+  const cost_model::KernelCostEstimate cost =
+      cost_model::estimateCost(params, segment, target);
+  EXPECT_FALSE(cost.spills);
+  EXPECT_DOUBLE_EQ(cost.occupancy, 1.0);
+
+  params.unroll_factor_inner = 8;
+  params.unroll_factor_outer = 8;
+  const cost_model::KernelCostEstimate unrolled_cost =
+      cost_model::estimateCost(params, segment, target);
+  EXPECT_TRUE(unrolled_cost.spills);
+  EXPECT_EQ(unrolled_cost.registers_per_thread, 255);
+  EXPECT_LT(unrolled_cost.occupancy, cost.occupancy);
+  EXPECT_GT(unrolled_cost.time_us, cost.time_us);
+}
+
+TEST_F(CostModelTest, RankCandidates) {
+  const cost_model::SegmentDescription segment = makePointwiseSegment();
+  const TargetDevice target;
+
+  PointwiseParams baseline;
+  const std::vector<cost_model::Candidate> candidates =
+      cost_model::rankCandidates(baseline, segment, target, 3);
+  ASSERT_EQ(std::ssize(candidates), 3);
+  for (const cost_model::Candidate& candidate : candidates) {
+    const auto* params = candidate.params->as<PointwiseParams>();
+    EXPECT_LE(params->vectorization_factor, 4);
+    // A 1D schedule can't be unrolled outside the break point.
+    EXPECT_EQ(params->unroll_factor_outer, 1);
+  }
+  for (size_t i = 1; i < candidates.size(); i++) {
+    EXPECT_LE(candidates[i - 1].cost.time_us, candidates[i].cost.time_us);
+  }
+  EXPECT_LT(
+      candidates.front().cost.time_us,
+      cost_model::estimateCost(baseline, segment, target).time_us);
+  const auto* best = candidates.front().params->as<PointwiseParams>();
+  EXPECT_EQ(best->vectorization_factor, 4);
+
+  // The winner can be deployed through a table.
+  std::istringstream is(heuristic_plugin::TableHeuristicPlugin::formatEntry(
+      segment.problem, candidates.front().overrides));
+  const auto table = heuristic_plugin::TableHeuristicPlugin::parse(is);
+  NvfHeuristicOverrides overrides = {};
+  EXPECT_TRUE(table.query(segment.problem, overrides));
+  EXPECT_EQ(overrides.fields, candidates.front().overrides.fields);
+  EXPECT_EQ(overrides.vectorization_factor, 4);
+}
+
+TEST_F(CostModelTest, DumpCandidates) {
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+  TensorView* in = makeContigTensor(2);
+  fusion->addInput(in);
+  TensorView* out = softmax(in, 1);
+  fusion->addOutput(out);
+
+  DebugDumpOptionsGuard options_guard;
+  DebugDumpOptionsGuard::getCurOptions().set(
+      DebugDumpOption::HeuristicCandidates, {"2"});
+  std::stringstream ss;
+  DebugStreamGuard stream_guard(ss);
+
+  FusionExecutorCache executor_cache(std::move(fusion));
+  at::Tensor t0 =
+      at::randn({256, 2048}, at::dtype(at::kFloat).device(at::kCUDA));
+  auto outputs = executor_cache.runFusionWithInputs({t0});
+  testValidate(executor_cache.fusion(), outputs, {t0}, __LINE__, __FILE__);
+
+  EXPECT_THAT(ss.str(), HasSubstr("Heuristic candidates (inner_persistent)"));
+  EXPECT_THAT(ss.str(), HasSubstr("#2 inner_persistent "));
+  EXPECT_THAT(ss.str(), testing::Not(HasSubstr("#3")));
+}
+
+TEST_F(CostModelTest, DumpCandidatesInvalidArgument) {
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+  TensorView* in = makeContigTensor(2);
+  fusion->addInput(in);
+  fusion->addOutput(sum(in, {1}));
+
+  DebugDumpOptionsGuard options_guard;
+  DebugDumpOptionsGuard::getCurOptions().set(
+      DebugDumpOption::HeuristicCandidates, {"two"});
+  std::stringstream ss;
+  DebugStreamGuard stream_guard(ss);
+
+  FusionExecutorCache executor_cache(std::move(fusion));
+  at::Tensor t0 =
+      at::randn({256, 2048}, at::dtype(at::kFloat).device(at::kCUDA));
+  EXPECT_THAT(
+      [&]() { executor_cache.runFusionWithInputs({t0}); },
+      ThrowsMessage<nvfError>(
+          HasSubstr("positive number of heuristic candidates")));
+}
+
+} // namespace nvfuser
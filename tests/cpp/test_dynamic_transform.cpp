@@ -15,6 +15,7 @@
 #include <expr_evaluator.h>
 #include <multidevice/utils.h>
 #include <ops/all_ops.h>
+#include <runtime/executor_utils.h>
 #include <scheduler/tools/inlining.h>
 #include <scheduler/utils.h>
 #include <tests/cpp/utils.h>
@@ -1410,4 +1411,64 @@ TEST_F(DynamicTransformTest, LoopSplit) {
   EXPECT_EQ(getShardedLogicalAxis(concrete_out, ParallelType::DIDx), 2);
 }
 
+// Infos equal to earlier ones are interned, and inputs with the same root
+// dynamic values hit the memo regardless of their strides.
+TEST_F(DynamicTransformTest, ConcretizationCache) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  TensorView* tv0 = makeSymbolicTensor(2);
+  fusion.addInput(tv0);
+  Val* s0 = IrBuilder::create<Val>(DataType::Int);
+  Val* s1 = IrBuilder::create<Val>(DataType::Int);
+  fusion.addInput(s0);
+  fusion.addInput(s1);
+  fusion.addOutput(reshape(tv0, {s0, s1}));
+
+  const DynamicTransformInitialInfo initial_info =
+      DynamicTransform::getInitialInfo(&fusion);
+  ASSERT_TRUE(initial_info.isDynamic());
+
+  const auto options = at::TensorOptions().device(at::kCUDA, 0);
+  const KernelArgumentHolder args(at::randn({3, 4}, options), 2L, 6L);
+  const KernelArgumentHolder transposed_args(
+      at::randn({4, 3}, options).t(), 2L, 6L);
+  const KernelArgumentHolder flattened_args(
+      at::randn({3, 4}, options), 12L, 1L);
+  const KernelArgumentHolder squeezed_args(
+      at::randn({3, 4}, options), 1L, 12L);
+
+  DynamicTransformConcretizationCache cache(
+      &initial_info, /*exact_map=*/nullptr, /*max_memo_size=*/2);
+  EXPECT_TRUE(cache.canMemoize());
+
+  DynamicTransformConcretizationInfo* info = cache.get(args);
+  EXPECT_EQ(cache.get(args), info);
+  EXPECT_EQ(cache.get(transposed_args), info);
+  EXPECT_EQ(cache.memoHits(), 2);
+  EXPECT_EQ(cache.numInterned(), 1);
+
+  // An equal info computed elsewhere is dropped in favor of the interned one.
+  ExpressionEvaluator expr_eval = executor_utils::bindInputs(args, &fusion);
+  EXPECT_EQ(
+      cache.intern(std::make_unique<DynamicTransformConcretizationInfo>(
+          &initial_info, &expr_eval)),
+      info);
+  EXPECT_EQ(cache.numInterned(), 1);
+
+  DynamicTransformConcretizationInfo* flattened_info =
+      cache.get(flattened_args);
+  EXPECT_NE(flattened_info, info);
+  EXPECT_EQ(cache.numInterned(), 2);
+  EXPECT_EQ(cache.memoSize(), 2);
+
+  // The memo is full, so it's cleared before memoizing another signature.
+  // Interned infos survive it.
+  EXPECT_NE(cache.get(squeezed_args), flattened_info);
+  EXPECT_EQ(cache.memoSize(), 1);
+  EXPECT_EQ(cache.get(args), info);
+  EXPECT_EQ(cache.memoHits(), 2);
+  EXPECT_EQ(cache.numInterned(), 3);
+}
+
 } // namespace nvfuser
@@ -15,6 +15,7 @@
 #include <expr_evaluator.h>
 #include <fusion.h>
 #include <ops/all_ops.h>
+#include <runtime/expr_eval_plan.h>
 
 namespace nvfuser {
 
@@ -825,4 +826,132 @@ TEST_F(ExprEvalTest, NamedScalar) {
   EXPECT_EQ(cache_id_pvalue.as<int64_t>(), kCacheIdValue);
 }
 
+// A chain of ops only keeps the value being computed and its operand alive.
+TEST_F(ExprEvalTest, PlanReleasesIntermediates) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  TensorView* in = makeContigTensor(2);
+  fusion.addInput(in);
+  TensorView* out = in;
+  for (int i = 0; i < 8; i++) {
+    out = neg(out);
+  }
+  fusion.addOutput(out);
+  fusion.addOutput(sum(out, {1}));
+
+  ExprEvalPlan plan(&fusion);
+  EXPECT_EQ(plan.numSteps(), 9);
+  EXPECT_EQ(plan.peakLiveValues(), 2);
+
+  at::Tensor t0 = at::randn({4, 8});
+  KernelArgumentHolder args(t0);
+  // The plan reads fusion inputs from `args` and looks nothing else up, so
+  // the CPU tensors don't have to be bound.
+  ExpressionEvaluator evaluator;
+  KernelArgumentHolder outputs = plan.run(args, evaluator);
+  ASSERT_EQ(outputs.size(), 2);
+  EXPECT_TRUE(at::equal(outputs[0].as<at::Tensor>(), t0));
+  EXPECT_TRUE(at::allclose(outputs[1].as<at::Tensor>(), t0.sum({1})));
+  // Intermediates are not memoized in the evaluator.
+  EXPECT_FALSE(evaluator.isKnown(out->definition()->input(0)));
+}
+
+TEST_F(ExprEvalTest, PlanCatOp) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  TensorView* tv0 = makeContigTensor(2);
+  TensorView* tv1 = makeContigTensor(2);
+  fusion.addInput(tv0);
+  fusion.addInput(tv1);
+  TensorView* tv2 = cat({tv0, tv1}, 0);
+  // An output may also be a fusion input.
+  fusion.addOutput(tv2);
+  fusion.addOutput(tv0);
+
+  // The PadOps preceding the CatOp are not evaluated.
+  ExprEvalPlan plan(&fusion);
+  EXPECT_EQ(plan.numSteps(), 1);
+
+  at::Tensor t0 = at::randn({3, 2});
+  at::Tensor t1 = at::randn({5, 2});
+  KernelArgumentHolder args(t0, t1);
+  // The plan reads fusion inputs from `args` and looks nothing else up, so
+  // the CPU tensors don't have to be bound.
+  ExpressionEvaluator evaluator;
+  KernelArgumentHolder outputs = plan.run(args, evaluator);
+  ASSERT_EQ(outputs.size(), 2);
+  EXPECT_TRUE(at::equal(outputs[0].as<at::Tensor>(), at::cat({t0, t1}, 0)));
+  EXPECT_TRUE(outputs[1].as<at::Tensor>().is_same(t0));
+}
+
+TEST_F(ExprEvalTest, DenseMode) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  auto* a = IrBuilder::create<Val>(DataType::Int);
+  auto* b = IrBuilder::create<Val>(DataType::Int);
+  auto* c = add(a, b);
+  auto* cache_id = IrBuilder::create<NamedScalar>("cacheId", DataType::Int);
+  auto* d = mul(c, cache_id);
+
+  ExpressionEvaluator evaluator(&fusion);
+  evaluator.bind(a, 2L);
+  evaluator.bind(b, 3L);
+  evaluator.bind("cacheId", 4L);
+  checkIntValue(evaluator, d, 20);
+  EXPECT_TRUE(evaluator.isKnown(c));
+
+  // A new generation forgets bound, evaluated and named values.
+  evaluator.reset();
+  EXPECT_FALSE(evaluator.isKnown(a));
+  EXPECT_FALSE(evaluator.isKnown(c));
+  EXPECT_FALSE(evaluator.evaluate(cache_id).hasValue());
+  EXPECT_FALSE(evaluator.evaluate(d).hasValue());
+
+  evaluator.bind(a, 5L);
+  evaluator.bind(b, 1L);
+  evaluator.bind("cacheId", 2L);
+  checkIntValue(evaluator, d, 12);
+
+  // Vals created after the evaluator and Vals of other containers work too.
+  auto* e = sub(d, a);
+  checkIntValue(evaluator, e, 7);
+  evaluator.invalidate(e);
+  EXPECT_FALSE(evaluator.isKnown(e));
+
+  Fusion other;
+  FusionGuard other_fg(&other);
+  auto* f = IrBuilder::create<Val>(DataType::Int);
+  evaluator.bind(f, 6L);
+  checkIntValue(evaluator, add(f, f), 12);
+}
+
+// Values of Vals with slots far beyond what a fresh evaluator has stored are
+// kept in the hash map instead of growing the dense arrays to their slot.
+TEST_F(ExprEvalTest, DenseModeHighSlots) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  auto* a = IrBuilder::create<Val>(DataType::Int);
+  for ([[maybe_unused]] auto i : arange(1000)) {
+    IrBuilder::create<Val>(DataType::Int);
+  }
+  auto* b = IrBuilder::create<Val>(DataType::Int);
+  auto* c = add(a, b);
+
+  ExpressionEvaluator evaluator(&fusion);
+  for (auto generation : arange(2)) {
+    evaluator.bind(a, 2L);
+    evaluator.bind(b, 3L + generation);
+    checkIntValue(evaluator, c, 5 + generation);
+    EXPECT_TRUE(evaluator.isKnown(b));
+    evaluator.invalidate(b);
+    EXPECT_FALSE(evaluator.isKnown(b));
+    evaluator.reset();
+    EXPECT_FALSE(evaluator.isKnown(c));
+  }
+}
+
 } // namespace nvfuser
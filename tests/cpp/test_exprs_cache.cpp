@@ -0,0 +1,80 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <fusion.h>
+#include <ops/alias.h>
+#include <ops/arith.h>
+#include <statement_guard.h>
+#include <tests/cpp/utils.h>
+
+namespace nvfuser {
+
+using testing::ElementsAre;
+
+using ExprsCacheTest = NVFuserTest;
+
+TEST_F(ExprsCacheTest, Hits) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  TensorView* in = makeContigTensor(2);
+  fusion.addInput(in);
+  TensorView* out = neg(in);
+  fusion.addOutput(out);
+
+  const int64_t version = fusion.exprsVersion();
+  const Fusion::ExprsCacheStats before = fusion.exprsCacheStats();
+  EXPECT_THAT(fusion.exprs(), ElementsAre(out->definition()));
+  EXPECT_THAT(fusion.exprs(), ElementsAre(out->definition()));
+  // Uses are recomputed from the cached order.
+  EXPECT_THAT(in->uses(), ElementsAre(out->definition()));
+
+  EXPECT_EQ(fusion.exprsCacheStats().traversals, before.traversals + 1);
+  EXPECT_EQ(fusion.exprsCacheStats().hits, before.hits + 2);
+  EXPECT_EQ(fusion.exprsVersion(), version);
+}
+
+TEST_F(ExprsCacheTest, Invalidation) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  TensorView* in = makeContigTensor(2);
+  fusion.addInput(in);
+  TensorView* x = neg(in);
+  fusion.addOutput(x);
+  EXPECT_THAT(fusion.exprs(), ElementsAre(x->definition()));
+
+  // Registering an expr and changing the outputs both change the order.
+  int64_t version = fusion.exprsVersion();
+  TensorView* y = sin(x);
+  EXPECT_GT(fusion.exprsVersion(), version);
+  fusion.addOutput(y);
+  EXPECT_THAT(fusion.exprs(), ElementsAre(x->definition(), y->definition()));
+
+  version = fusion.exprsVersion();
+  fusion.removeOutput(x);
+  fusion.removeOutput(y);
+  EXPECT_GT(fusion.exprsVersion(), version);
+  EXPECT_THAT(fusion.exprs(), ElementsAre());
+
+  // Statements created under a StatementGuard are gone once it's destroyed,
+  // so a cached order computed under the guard must not outlive it.
+  fusion.addOutput(x);
+  {
+    StatementGuard sg(&fusion);
+    TensorView* z = add(x, x);
+    fusion.addOutput(z);
+    EXPECT_THAT(fusion.exprs(), ElementsAre(x->definition(), z->definition()));
+    fusion.removeOutput(z);
+  }
+  EXPECT_THAT(fusion.exprs(), ElementsAre(x->definition()));
+}
+
+} // namespace nvfuser
@@ -0,0 +1,329 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <fusion.h>
+#include <ops/all_ops.h>
+#include <options.h>
+#include <runtime/fusion_executor_cache.h>
+#include <scheduler/foreach_heuristic.h>
+#include <scheduler/foreach_utils.h>
+#include <scheduler/registry.h>
+#include <tests/cpp/utils.h>
+#include <tests/cpp/validator.h>
+
+#include <cstring>
+
+namespace nvfuser {
+
+using testing::ElementsAre;
+
+using ForEachTest = NVFuserTest;
+
+using foreach_utils::ChunkTableLayout;
+using foreach_utils::ForEachChunk;
+
+namespace {
+
+// param -= lr * grad for parameters of the given ranks. lr is shared by all
+// the parameters.
+void defineSgdStep(Fusion* fusion, const std::vector<int64_t>& ranks) {
+  FusionGuard fg(fusion);
+  Val* lr = IrBuilder::create<Val>(DataType::Double);
+  fusion->addInput(lr);
+  for (int64_t rank : ranks) {
+    TensorView* param = makeContigTensor(rank);
+    TensorView* grad = makeContigTensor(rank);
+    fusion->addInput(param);
+    fusion->addInput(grad);
+    fusion->addOutput(sub(param, mul(grad, lr)));
+  }
+}
+
+template <typename T>
+T readTableEntry(const std::vector<std::byte>& table, int64_t offset) {
+  T value;
+  std::memcpy(&value, table.data() + offset, sizeof(T));
+  return value;
+}
+
+} // namespace
+
+TEST_F(ForEachTest, ChunkTable) {
+  const std::vector<int64_t> numels = {1000, 10, 300};
+  EXPECT_THAT(
+      foreach_utils::makeChunkTable(
+          numels, /*unit_size=*/128, /*num_blocks=*/4),
+      ElementsAre(
+          ForEachChunk{0, 0, 0, 256},
+          ForEachChunk{1, 0, 0, 10},
+          ForEachChunk{2, 0, 0, 128},
+          ForEachChunk{0, 1, 256, 256},
+          ForEachChunk{2, 1, 128, 128},
+          ForEachChunk{0, 2, 512, 256},
+          ForEachChunk{2, 2, 256, 44},
+          ForEachChunk{0, 3, 768, 232}));
+
+  // A single block processes everything
+  EXPECT_THAT(
+      foreach_utils::makeChunkTable(
+          numels, /*unit_size=*/128, /*num_blocks=*/1),
+      ElementsAre(
+          ForEachChunk{0, 0, 0, 1000},
+          ForEachChunk{1, 0, 0, 10},
+          ForEachChunk{2, 0, 0, 300}));
+}
+
+TEST_F(ForEachTest, ChunkTableLayout) {
+  // 3 chunks of 3 groups with 2 tensors each. The pointers are aligned to 8
+  // bytes.
+  EXPECT_EQ(
+      foreach_utils::getChunkTableLayout(3, 3, 2, PrimDataType::Int32),
+      (ChunkTableLayout{0, 12, 24, 40, 88}));
+  EXPECT_EQ(
+      foreach_utils::getChunkTableLayout(3, 3, 2, PrimDataType::Int),
+      (ChunkTableLayout{0, 24, 48, 72, 120}));
+  EXPECT_EQ(
+      foreach_utils::getChunkTableLayout(0, 0, 0, PrimDataType::Int),
+      ChunkTableLayout{});
+}
+
+TEST_F(ForEachTest, PackChunkTable) {
+  const std::vector<ForEachChunk> chunks =
+      foreach_utils::makeChunkTable({300, 10}, /*unit_size=*/128, 2);
+  ASSERT_EQ(chunks.size(), 3);
+  // Fake data pointers, which are only copied
+  int64_t buffers[4];
+  const std::vector<std::vector<void*>> data = {
+      {&buffers[0], &buffers[1]}, {&buffers[2], &buffers[3]}};
+
+  for (PrimDataType index_type : {PrimDataType::Int32, PrimDataType::Int}) {
+    SCOPED_TRACE(DataType(index_type));
+    const ChunkTableLayout layout =
+        foreach_utils::getChunkTableLayout(3, 2, 2, index_type);
+    const std::vector<std::byte> table =
+        foreach_utils::packChunkTable(chunks, data, index_type);
+    ASSERT_EQ(std::ssize(table), layout.size);
+
+    auto read_index = [&](int64_t array, int64_t i) -> int64_t {
+      const int64_t offset = array + i * dataTypeSize(index_type);
+      return index_type == PrimDataType::Int32
+          ? readTableEntry<int32_t>(table, offset)
+          : readTableEntry<int64_t>(table, offset);
+    };
+    for (auto&& [i, chunk] : enumerate(chunks)) {
+      EXPECT_EQ(read_index(layout.chunk_groups, (int64_t)i), chunk.group);
+      EXPECT_EQ(read_index(layout.chunk_offsets, (int64_t)i), chunk.offset);
+      EXPECT_EQ(read_index(layout.chunk_numels, (int64_t)i), chunk.numel);
+    }
+    for (auto i : arange(4)) {
+      EXPECT_EQ(
+          readTableEntry<void*>(table, layout.data + i * sizeof(void*)),
+          (void*)&buffers[i]);
+    }
+  }
+}
+
+TEST_F(ForEachTest, NumBlocks) {
+  const std::vector<int64_t> numels = {1000, 10, 300};
+  // 8 + 1 + 3 units
+  EXPECT_EQ(
+      foreach_utils::getNumBlocks(
+          numels, /*unit_size=*/128, /*units_per_block=*/4, /*max_blocks=*/100),
+      3);
+  // No more blocks than the units of the largest group
+  EXPECT_EQ(
+      foreach_utils::getNumBlocks(
+          numels, /*unit_size=*/128, /*units_per_block=*/1, /*max_blocks=*/100),
+      8);
+  EXPECT_EQ(
+      foreach_utils::getNumBlocks(
+          numels, /*unit_size=*/128, /*units_per_block=*/1, /*max_blocks=*/2),
+      2);
+  EXPECT_EQ(
+      foreach_utils::getNumBlocks(
+          {0}, /*unit_size=*/128, /*units_per_block=*/4, /*max_blocks=*/100),
+      1);
+}
+
+TEST_F(ForEachTest, DetectGroups) {
+  Fusion fusion;
+  defineSgdStep(&fusion, {2, 1, 3});
+
+  const std::vector<foreach_utils::ForEachGroup> groups =
+      foreach_utils::getForEachGroups(&fusion);
+  ASSERT_EQ(groups.size(), 3);
+  for (auto&& [i, group] : enumerate(groups)) {
+    EXPECT_EQ(group.reference, fusion.outputs().at(i));
+    EXPECT_EQ(group.exprs.size(), 2);
+    // param, grad, grad * lr and the output
+    EXPECT_EQ(group.tvs.size(), 4);
+    EXPECT_TRUE(foreach_utils::haveSameStructure(groups.front(), group));
+  }
+}
+
+TEST_F(ForEachTest, DifferentStructure) {
+  Fusion fusion;
+  defineSgdStep(&fusion, {2, 1});
+  FusionGuard fg(&fusion);
+  TensorView* tv0 = makeContigTensor(1);
+  TensorView* tv1 = makeContigTensor(1);
+  fusion.addInput(tv0);
+  fusion.addInput(tv1);
+  Val* lr = fusion.inputs().front();
+  fusion.addOutput(add(tv0, mul(tv1, lr)));
+
+  const std::vector<foreach_utils::ForEachGroup> groups =
+      foreach_utils::getForEachGroups(&fusion);
+  ASSERT_EQ(groups.size(), 3);
+  EXPECT_TRUE(foreach_utils::haveSameStructure(groups.at(0), groups.at(1)));
+  EXPECT_FALSE(foreach_utils::haveSameStructure(groups.at(0), groups.at(2)));
+}
+
+// Every tensor is a kernel parameter, so a long list of tensors can't be
+// scheduled as one kernel.
+TEST_F(ForEachTest, ManyParameters) {
+  EnableOptionsGuard opt_guard;
+  EnableOptionsGuard::getCurOptions().set(EnableOption::ForEachScheduler);
+  std::unique_ptr<SchedulerEntry> scheduler =
+      SchedulerEntry::makeSchedulerInstance(SchedulerType::ForEach);
+
+  // 300 tensors of 24 bytes each don't fit in the kernel parameters, so
+  // their data pointers go into a chunk table.
+  Fusion large_fusion;
+  defineSgdStep(&large_fusion, std::vector<int64_t>(100, 1));
+  EXPECT_TRUE(scheduler->canScheduleCompileTime(&large_fusion));
+
+  {
+    // Host IR doesn't run ForEachKernelExecutor.
+    EnableOptionsGuard host_ir_guard;
+    EnableOptionsGuard::getCurOptions().set(EnableOption::HostIrLowering);
+    EXPECT_FALSE(scheduler->canScheduleCompileTime(&large_fusion));
+  }
+
+  // A chunk table views every tensor as contiguous.
+  Fusion noncontig_fusion;
+  {
+    FusionGuard fg(&noncontig_fusion);
+    Val* lr = IrBuilder::create<Val>(DataType::Double);
+    noncontig_fusion.addInput(lr);
+    for ([[maybe_unused]] int64_t i : arange(100)) {
+      TensorView* param = makeSymbolicTensor(1);
+      TensorView* grad = makeSymbolicTensor(1);
+      noncontig_fusion.addInput(param);
+      noncontig_fusion.addInput(grad);
+      noncontig_fusion.addOutput(sub(param, mul(grad, lr)));
+    }
+  }
+  EXPECT_FALSE(scheduler->canScheduleCompileTime(&noncontig_fusion));
+}
+
+TEST_F(ForEachTest, ChunkFusion) {
+  Fusion fusion;
+  defineSgdStep(&fusion, {2, 1});
+
+  const std::vector<foreach_utils::ForEachGroup> groups =
+      foreach_utils::getForEachGroups(&fusion);
+  ASSERT_EQ(groups.size(), 2);
+  const std::vector<TensorView*> table_tvs =
+      foreach_utils::getTableTensors(groups.front());
+  ASSERT_EQ(table_tvs.size(), 3);
+  EXPECT_TRUE(table_tvs[0]->isFusionInput());
+  EXPECT_TRUE(table_tvs[1]->isFusionInput());
+  EXPECT_EQ(table_tvs[2], fusion.outputs().front());
+
+  std::unique_ptr<Fusion> chunk_fusion =
+      foreach_utils::makeChunkFusion(&fusion);
+  // lr, param and grad
+  ASSERT_EQ(chunk_fusion->inputs().size(), 3);
+  EXPECT_FALSE(chunk_fusion->inputs()[0]->isA<TensorView>());
+  ASSERT_EQ(chunk_fusion->outputs().size(), 1);
+  Val* numel = nullptr;
+  for (Val* val : {
+           chunk_fusion->inputs()[1],
+           chunk_fusion->inputs()[2],
+           chunk_fusion->outputs()[0],
+       }) {
+    auto* tv = dynamic_cast<TensorView*>(val);
+    ASSERT_NE(tv, nullptr);
+    ASSERT_EQ(tv->getLogicalDomain().size(), 1);
+    Val* extent = tv->getLogicalDomain().front()->extent();
+    if (numel == nullptr) {
+      numel = extent;
+    }
+    EXPECT_EQ(extent, numel);
+    EXPECT_THAT(tv->getContiguity(), ElementsAre(true));
+  }
+  EXPECT_EQ(chunk_fusion->exprs().size(), 2);
+
+  // The original fusion is left untouched.
+  EXPECT_EQ(fusion.inputs().size(), 5);
+  EXPECT_EQ(fusion.outputs().size(), 2);
+}
+
+TEST_F(ForEachTest, SgdStep) {
+  EnableOptionsGuard opt_guard;
+  EnableOptionsGuard::getCurOptions().set(EnableOption::ForEachScheduler);
+
+  auto fusion = std::make_unique<Fusion>();
+  defineSgdStep(fusion.get(), {2, 1, 3});
+
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  KernelArgumentHolder args;
+  args.push(0.1);
+  for (const std::vector<int64_t>& shape :
+       std::vector<std::vector<int64_t>>{{1024, 33}, {77}, {8, 8, 8}}) {
+    args.push(at::randn(shape, options));
+    args.push(at::randn(shape, options));
+  }
+
+  FusionExecutorCache executor_cache(std::move(fusion));
+  auto outputs = executor_cache.runFusionWithInputs(args);
+
+  FusionKernelRuntime* runtime = executor_cache.getMostRecentKernelRuntime();
+  EXPECT_FALSE(runtime->isSegmented());
+  const auto& heuristic_list = runtime->schedulerHeuristics()->heuristicsList();
+  ASSERT_EQ(heuristic_list.size(), 1);
+  EXPECT_EQ(heuristic_list.front()->scheduler_type, SchedulerType::ForEach);
+
+  testValidate(executor_cache.fusion(), outputs, args, __LINE__, __FILE__);
+}
+
+TEST_F(ForEachTest, SgdStepChunkTable) {
+  EnableOptionsGuard opt_guard;
+  EnableOptionsGuard::getCurOptions().set(EnableOption::ForEachScheduler);
+
+  // Too many tensors for the kernel parameters
+  constexpr int64_t kNumGroups = 200;
+  auto fusion = std::make_unique<Fusion>();
+  defineSgdStep(fusion.get(), std::vector<int64_t>(kNumGroups, 1));
+
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  KernelArgumentHolder args;
+  args.push(0.1);
+  for (int64_t i : arange(kNumGroups)) {
+    const int64_t numel = (i * 997) % 5000 + 1;
+    args.push(at::randn({numel}, options));
+    args.push(at::randn({numel}, options));
+  }
+
+  FusionExecutorCache executor_cache(std::move(fusion));
+  auto outputs = executor_cache.runFusionWithInputs(args);
+
+  FusionKernelRuntime* runtime = executor_cache.getMostRecentKernelRuntime();
+  EXPECT_FALSE(runtime->isSegmented());
+  const auto& heuristic_list = runtime->schedulerHeuristics()->heuristicsList();
+  ASSERT_EQ(heuristic_list.size(), 1);
+  EXPECT_EQ(heuristic_list.front()->scheduler_type, SchedulerType::ForEach);
+  EXPECT_TRUE(heuristic_list.front()->as<ForEachParams>()->use_chunk_table);
+
+  testValidate(executor_cache.fusion(), outputs, args, __LINE__, __FILE__);
+}
+
+} // namespace nvfuser
@@ -0,0 +1,207 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <fusion.h>
+#include <ops/all_ops.h>
+#include <runtime/fusion_executor_cache.h>
+#include <scheduler/heuristic_plugin.h>
+#include <tests/cpp/utils.h>
+#include <tests/cpp/validator.h>
+
+namespace nvfuser {
+
+using testing::HasSubstr;
+using testing::ThrowsMessage;
+
+using HeuristicPluginTest = NVFuserTest;
+using Problem = NvfHeuristicProblem;
+using Overrides = NvfHeuristicOverrides;
+
+namespace {
+
+heuristic_plugin::TableHeuristicPlugin parseTable(const std::string& table) {
+  std::istringstream is(table);
+  return heuristic_plugin::TableHeuristicPlugin::parse(is);
+}
+
+NvfHeuristicProblem makeProblem(
+    int32_t scheduler_type,
+    const std::vector<int64_t>& extents) {
+  NvfHeuristicProblem problem = {};
+  problem.struct_size = sizeof(NvfHeuristicProblem);
+  problem.scheduler_type = scheduler_type;
+  for (int64_t extent : extents) {
+    problem.extents[problem.num_dims++] = extent;
+  }
+  problem.device_major = 9;
+  problem.device_minor = 0;
+  return problem;
+}
+
+template <typename Params>
+const Params* getParams(const FusionExecutorCache& executor_cache) {
+  FusionKernelRuntime* runtime = executor_cache.getMostRecentKernelRuntime();
+  NVF_CHECK(!runtime->isSegmented());
+  return runtime->schedulerHeuristics()
+      ->heuristicsList()
+      .at(0)
+      ->as<Params>();
+}
+
+} // namespace
+
+TEST_F(HeuristicPluginTest, Table) {
+  const auto table = parseTable(R"(
+# Tuned on H100.
+inner_persistent *,4096 sm=90 unroll_factor_iter_dom=2
+pointwise 1024,* vectorization_factor=2
+pointwise * vectorization_factor=4 unroll_factor_inner=2
+)");
+  EXPECT_EQ(table.size(), 3);
+
+  NvfHeuristicOverrides out = {};
+  EXPECT_TRUE(table.query(
+      makeProblem(NVFUSER_HEURISTIC_PLUGIN_POINTWISE, {1024, 8}), out));
+  EXPECT_EQ(out.fields, NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR);
+  EXPECT_EQ(out.vectorization_factor, 2);
+
+  // Falls through to the catch-all entry.
+  EXPECT_TRUE(table.query(
+      makeProblem(NVFUSER_HEURISTIC_PLUGIN_POINTWISE, {8, 1024, 8}), out));
+  EXPECT_EQ(out.vectorization_factor, 4);
+  EXPECT_EQ(out.unroll_factor_inner, 2);
+
+  EXPECT_TRUE(table.query(
+      makeProblem(NVFUSER_HEURISTIC_PLUGIN_INNER_PERSISTENT, {32, 4096}),
+      out));
+  EXPECT_EQ(out.unroll_factor_iter_dom, 2);
+
+  // Wrong device.
+  NvfHeuristicProblem sm80 =
+      makeProblem(NVFUSER_HEURISTIC_PLUGIN_INNER_PERSISTENT, {32, 4096});
+  sm80.device_major = 8;
+  EXPECT_FALSE(table.query(sm80, out));
+
+  EXPECT_FALSE(table.query(
+      makeProblem(NVFUSER_HEURISTIC_PLUGIN_REDUCTION, {32, 4096}), out));
+}
+
+TEST_F(HeuristicPluginTest, TableErrors) {
+  EXPECT_THAT(
+      [] { parseTable("transpose * vectorization_factor=4"); },
+      ThrowsMessage<nvfError>(HasSubstr("Unknown scheduler")));
+  EXPECT_THAT(
+      [] { parseTable("pointwise * tile_size=4"); },
+      ThrowsMessage<nvfError>(HasSubstr("Unknown field")));
+  EXPECT_THAT(
+      [] { parseTable("pointwise"); },
+      ThrowsMessage<nvfError>(HasSubstr("Expected")));
+}
+
+// Overrides a plugin returns are validated as a whole.
+TEST_F(HeuristicPluginTest, RejectInvalidOverrides) {
+  NvfHeuristicProblem problem =
+      makeProblem(NVFUSER_HEURISTIC_PLUGIN_POINTWISE, {1024});
+  problem.max_vectorization_factor = 4;
+
+  heuristic_plugin::HeuristicPluginGuard guard(
+      [](const Problem& p, Overrides& overrides) {
+        EXPECT_EQ(p.default_vectorization_factor, 2);
+        overrides.fields = NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR |
+            NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_INNER;
+        overrides.vectorization_factor = 8;
+        overrides.unroll_factor_inner = 2;
+        return true;
+      });
+  PointwiseParams params;
+  params.vectorization_factor = 2;
+  EXPECT_FALSE(heuristic_plugin::updatePointwiseParams(&params, problem));
+  EXPECT_EQ(params.vectorization_factor, 2);
+  EXPECT_EQ(params.unroll_factor_inner, 1);
+
+  problem.max_vectorization_factor = 8;
+  EXPECT_TRUE(heuristic_plugin::updatePointwiseParams(&params, problem));
+  EXPECT_EQ(params.vectorization_factor, 8);
+  EXPECT_EQ(params.unroll_factor_inner, 2);
+}
+
+TEST_F(HeuristicPluginTest, Pointwise) {
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+  TensorView* in = makeContigTensor(2);
+  fusion->addInput(in);
+  TensorView* out = relu(in);
+  fusion->addOutput(out);
+
+  int64_t queries = 0;
+  heuristic_plugin::HeuristicPluginGuard guard(
+      [&queries](const Problem& problem, Overrides& overrides) {
+        queries++;
+        EXPECT_EQ(problem.scheduler_type, NVFUSER_HEURISTIC_PLUGIN_POINTWISE);
+        EXPECT_EQ(problem.num_dims, 2);
+        EXPECT_EQ(problem.extents[1], 1024);
+        EXPECT_EQ(problem.num_inputs, 1);
+        EXPECT_EQ(problem.input_dtypes[0], 'S');
+        EXPECT_EQ(problem.max_vectorization_factor, 4);
+        overrides.fields = NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR |
+            NVFUSER_HEURISTIC_PLUGIN_UNROLL_FACTOR_INNER;
+        overrides.vectorization_factor = 2;
+        overrides.unroll_factor_inner = 4;
+        return true;
+      });
+
+  FusionExecutorCache executor_cache(std::move(fusion));
+  at::Tensor t0 =
+      at::randn({128, 1024}, at::dtype(at::kFloat).device(at::kCUDA));
+  auto outputs = executor_cache.runFusionWithInputs({t0});
+  testValidate(executor_cache.fusion(), outputs, {t0}, __LINE__, __FILE__);
+
+  EXPECT_EQ(queries, 1);
+  const auto* params = getParams<PointwiseParams>(executor_cache);
+  EXPECT_EQ(params->vectorization_factor, 2);
+  EXPECT_EQ(params->unroll_factor_inner, 4);
+}
+
+// A persistent kernel must not repartition its persistent buffers, so only
+// the iteration domain can be unrolled differently.
+TEST_F(HeuristicPluginTest, InnerPersistent) {
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+  TensorView* in = makeContigTensor(2);
+  fusion->addInput(in);
+  TensorView* out = softmax(in, 1);
+  fusion->addOutput(out);
+
+  heuristic_plugin::HeuristicPluginGuard guard(
+      [](const Problem& problem, Overrides& overrides) {
+        EXPECT_EQ(
+            problem.scheduler_type, NVFUSER_HEURISTIC_PLUGIN_INNER_PERSISTENT);
+        EXPECT_EQ(problem.total_reduction_numel, 2048);
+        EXPECT_GT(problem.persistent_buffer_bytes, 0);
+        overrides.fields = NVFUSER_HEURISTIC_PLUGIN_VECTORIZATION_FACTOR;
+        overrides.vectorization_factor = 1;
+        return true;
+      });
+
+  FusionExecutorCache executor_cache(std::move(fusion));
+  at::Tensor t0 =
+      at::randn({256, 2048}, at::dtype(at::kFloat).device(at::kCUDA));
+  auto outputs = executor_cache.runFusionWithInputs({t0});
+  testValidate(executor_cache.fusion(), outputs, {t0}, __LINE__, __FILE__);
+
+  const auto* params = getParams<ReductionParams>(executor_cache);
+  EXPECT_EQ(params->scheduler_type, SchedulerType::InnerPersistent);
+  EXPECT_GT(params->unroll_factor_inner_reduction, 1);
+  EXPECT_THAT(params->tag, testing::Not(HasSubstr("heuristic plugin")));
+}
+
+} // namespace nvfuser
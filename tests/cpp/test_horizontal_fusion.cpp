@@ -0,0 +1,132 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <codegen.h>
+#include <device_lower/lower2device.h>
+#include <fusion.h>
+#include <ops/all_ops.h>
+#include <options.h>
+#include <runtime/fusion_executor_cache.h>
+#include <runtime/horizontal_executor.h>
+#include <tests/cpp/utils.h>
+#include <tests/cpp/validator.h>
+
+namespace nvfuser {
+
+using testing::HasSubstr;
+
+using HorizontalFusionTest = NVFuserTest;
+
+namespace {
+
+void defineScheduledPointwise(Fusion* fusion, int64_t ndims) {
+  FusionGuard fg(fusion);
+  TensorView* tv0 = makeSymbolicTensor(ndims);
+  fusion->addInput(tv0);
+  TensorView* tv1 = sin(tv0);
+  fusion->addOutput(tv1);
+
+  tv1->flatten();
+  tv1->split(0, 128);
+  tv1->axis(0)->parallelize(ParallelType::BIDx);
+  tv1->axis(1)->parallelize(ParallelType::TIDx);
+}
+
+} // namespace
+
+TEST_F(HorizontalFusionTest, DispatchOnBlockIndex) {
+  Fusion fusion0;
+  defineScheduledPointwise(&fusion0, 1);
+  Fusion fusion1;
+  defineScheduledPointwise(&fusion1, 2);
+
+  GpuLower gpulw0(&fusion0);
+  GpuLower gpulw1(&fusion1);
+  const std::string code = codegen::generateHorizontalCudaKernel(
+      {gpulw0.run(), gpulw1.run()}, "horizontal_kernel");
+
+  EXPECT_THAT(code, HasSubstr("__global__ void horizontal_kernel("));
+  EXPECT_THAT(code, HasSubstr("__device__ void horizontal_kernel_segment0("));
+  EXPECT_THAT(code, HasSubstr("__device__ void horizontal_kernel_segment1("));
+  EXPECT_THAT(code, HasSubstr("const dim3 s1_grid_dim"));
+  EXPECT_THAT(code, HasSubstr("index_utils::unlinearize(block_offset"));
+}
+
+TEST_F(HorizontalFusionTest, IndependentSegments) {
+  EnableOptionsGuard opt_guard;
+  EnableOptionsGuard::getCurOptions().set(EnableOption::HorizontalFusion);
+
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+
+  TensorView* tv0 = makeSymbolicTensor(2);
+  TensorView* tv1 = makeSymbolicTensor(1);
+  fusion->addInput(tv0);
+  fusion->addInput(tv1);
+  TensorView* tv2 = add(tv0, IrBuilder::create<Val>(1.0));
+  TensorView* tv3 = mul(tv1, IrBuilder::create<Val>(2.0));
+  fusion->addOutput(tv2);
+  fusion->addOutput(tv3);
+
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  at::Tensor t0 = at::randn({10, 20}, options);
+  at::Tensor t1 = at::randn({15}, options);
+
+  FusionExecutorCache executor_cache(std::move(fusion));
+  auto outputs = executor_cache.runFusionWithInputs({t0, t1});
+
+  FusionKernelRuntime* runtime = executor_cache.getMostRecentKernelRuntime();
+  ASSERT_EQ(runtime->fusionSegments()->groups().size(), 2);
+  ASSERT_EQ(runtime->horizontalExecutors().size(), 2);
+  const HorizontalKernelExecutor* hke =
+      runtime->horizontalExecutors().front().get();
+  ASSERT_NE(hke, nullptr);
+  EXPECT_TRUE(hke->isCompiled());
+  EXPECT_EQ(hke->executors().size(), 2);
+
+  testValidate(
+      executor_cache.fusion(), outputs, {t0, t1}, __LINE__, __FILE__);
+
+  // Run again with the parameters cached for these inputs
+  outputs = executor_cache.runFusionWithInputs({t0, t1});
+  testValidate(
+      executor_cache.fusion(), outputs, {t0, t1}, __LINE__, __FILE__);
+}
+
+TEST_F(HorizontalFusionTest, DependentSegmentsNotFused) {
+  EnableOptionsGuard opt_guard;
+  EnableOptionsGuard::getCurOptions().set(EnableOption::HorizontalFusion);
+
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+
+  TensorView* tv0 = makeSymbolicTensor(2);
+  fusion->addInput(tv0);
+  TensorView* tv1 = sin(tv0);
+  TensorView* tv2 = segment_set(tv1);
+  TensorView* tv3 = cos(tv2);
+  fusion->addOutput(tv3);
+
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  at::Tensor t0 = at::randn({16, 32}, options);
+
+  FusionExecutorCache executor_cache(std::move(fusion));
+  auto outputs = executor_cache.runFusionWithInputs({t0});
+
+  FusionKernelRuntime* runtime = executor_cache.getMostRecentKernelRuntime();
+  ASSERT_EQ(runtime->fusionSegments()->groups().size(), 2);
+  for (const auto& hke : runtime->horizontalExecutors()) {
+    EXPECT_EQ(hke, nullptr);
+  }
+
+  testValidate(executor_cache.fusion(), outputs, {t0}, __LINE__, __FILE__);
+}
+
+} // namespace nvfuser
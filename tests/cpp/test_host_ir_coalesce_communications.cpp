@@ -0,0 +1,229 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <host_ir/container.h>
+#include <host_ir/host_ir.h>
+#include <host_ir/pass/coalesce_communications.h>
+#include <ir/all_nodes.h>
+#include <ir/builder.h>
+#include <kernel_ir.h>
+#include <multidevice/communication.h>
+#include <multidevice/device_mesh.h>
+#include <ops/all_ops.h>
+#include <tests/cpp/utils.h>
+
+namespace nvfuser {
+
+namespace hir {
+
+using testing::ElementsAre;
+using testing::Truly;
+
+class CoalesceCommunicationsTest : public NVFuserTest {
+ protected:
+  static constexpr int64_t kNumDevices = 2;
+
+  // Appends Allocate(out) -> Allgather -> Wait(Allgather) to `hic` the way
+  // ConvertOpToCommunication does, and returns the Allgather.
+  Communication* appendAllgather(
+      HostIrContainer& hic,
+      TensorView* in,
+      CommunicatorBackend backend = CommunicatorBackend::kNccl) {
+    auto* out = ops::newValLike(in, in->dtype())->as<TensorView>();
+    out->setMemoryType(MemoryType::Global);
+    hic.pushBackTopLevelExprs(
+        IrBuilder::create<kir::Allocate>(out, MemoryType::Global));
+    auto* communication = IrBuilder::create<Communication>(
+        CommunicationType::Allgather,
+        out,
+        in,
+        mesh_.vector(),
+        /*root=*/-1,
+        RedOpType::UNUSED,
+        backend);
+    hic.pushBackTopLevelExprs(communication);
+    hic.pushBackTopLevelExprs(IrBuilder::create<Wait>(communication));
+    return communication;
+  }
+
+  TensorView* makeInput(HostIrContainer& hic, int64_t size = 8) {
+    TensorView* in = makeContigConcreteTensor({kNumDevices, size});
+    in->setDeviceMesh(mesh_);
+    hic.addInput(in);
+    return in;
+  }
+
+  const DeviceMesh mesh_ = DeviceMesh::createForNumDevices(kNumDevices);
+};
+
+namespace {
+
+template <typename T>
+auto isA() {
+  return Truly([](Expr* e) { return e->isA<T>(); });
+}
+
+auto is(Expr* expected) {
+  return Truly([expected](Expr* e) { return e == expected; });
+}
+
+auto waits(Expr* expected) {
+  return Truly([expected](Expr* e) {
+    return e->isA<Wait>() && e->as<Wait>()->communication() == expected;
+  });
+}
+
+} // namespace
+
+TEST_F(CoalesceCommunicationsTest, IndependentAllgathers) {
+  HostIrContainer hic;
+  FusionGuard fg(&hic);
+
+  Communication* c0 = appendAllgather(hic, makeInput(hic));
+  Communication* c1 = appendAllgather(hic, makeInput(hic));
+
+  hir_pass::CoalesceCommunications(/*max_bucket_bytes=*/1 << 20)
+      .runPass(&hic);
+
+  const std::vector<Expr*>& exprs = hic.topLevelExprs();
+  EXPECT_THAT(
+      exprs,
+      ElementsAre(
+          isA<kir::Allocate>(),
+          isA<kir::Allocate>(),
+          isA<StartCoalescing>(),
+          is(c0),
+          is(c1),
+          isA<EndCoalescing>(),
+          waits(exprs.at(5)),
+          waits(c0),
+          waits(c1)));
+}
+
+TEST_F(CoalesceCommunicationsTest, DataDependence) {
+  HostIrContainer hic;
+  FusionGuard fg(&hic);
+
+  Communication* c0 = appendAllgather(hic, makeInput(hic));
+  // The second allgather reads the first one's output, so it must wait.
+  Communication* c1 = appendAllgather(hic, c0->out());
+
+  hir_pass::CoalesceCommunications(/*max_bucket_bytes=*/1 << 20)
+      .runPass(&hic);
+
+  EXPECT_THAT(
+      hic.topLevelExprs(),
+      ElementsAre(
+          isA<kir::Allocate>(),
+          is(c0),
+          waits(c0),
+          isA<kir::Allocate>(),
+          is(c1),
+          waits(c1)));
+}
+
+TEST_F(CoalesceCommunicationsTest, BucketSize) {
+  HostIrContainer hic;
+  FusionGuard fg(&hic);
+
+  // Each allgather outputs 2x8 floats, i.e., 64 bytes.
+  std::vector<Communication*> communications;
+  for ([[maybe_unused]] auto i : arange(3)) {
+    communications.push_back(appendAllgather(hic, makeInput(hic)));
+  }
+
+  hir_pass::CoalesceCommunications(/*max_bucket_bytes=*/128).runPass(&hic);
+
+  const std::vector<Expr*>& exprs = hic.topLevelExprs();
+  EXPECT_THAT(
+      exprs,
+      ElementsAre(
+          isA<kir::Allocate>(),
+          isA<kir::Allocate>(),
+          isA<StartCoalescing>(),
+          is(communications[0]),
+          is(communications[1]),
+          isA<EndCoalescing>(),
+          waits(exprs.at(5)),
+          waits(communications[0]),
+          waits(communications[1]),
+          isA<kir::Allocate>(),
+          is(communications[2]),
+          waits(communications[2])));
+}
+
+TEST_F(CoalesceCommunicationsTest, InterleavedUse) {
+  HostIrContainer hic;
+  FusionGuard fg(&hic);
+
+  Communication* c0 = appendAllgather(hic, makeInput(hic));
+  TensorView* in = makeInput(hic);
+  // Touches none of the allgathers' tensors, so it doesn't block coalescing
+  // and ends up before the bucket.
+  auto* unrelated = IrBuilder::create<Deallocate>(in);
+  hic.pushBackTopLevelExprs(unrelated);
+  Communication* c1 = appendAllgather(hic, makeInput(hic));
+  // Reads c0's output, so the bucket is flushed before it.
+  auto* dealloc = IrBuilder::create<Deallocate>(c0->out());
+  hic.pushBackTopLevelExprs(dealloc);
+
+  hir_pass::CoalesceCommunications(/*max_bucket_bytes=*/1 << 20)
+      .runPass(&hic);
+
+  const std::vector<Expr*>& exprs = hic.topLevelExprs();
+  EXPECT_THAT(
+      exprs,
+      ElementsAre(
+          is(unrelated),
+          isA<kir::Allocate>(),
+          isA<kir::Allocate>(),
+          isA<StartCoalescing>(),
+          is(c0),
+          is(c1),
+          isA<EndCoalescing>(),
+          waits(exprs.at(6)),
+          waits(c0),
+          waits(c1),
+          is(dealloc)));
+}
+
+TEST_F(CoalesceCommunicationsTest, NotCoalesced) {
+  HostIrContainer hic;
+  FusionGuard fg(&hic);
+
+  // UCC doesn't support coalescing and symbolic sizes can't be bounded.
+  Communication* c0 =
+      appendAllgather(hic, makeInput(hic), CommunicatorBackend::kUcc);
+  TensorView* symbolic = makeContigTensor(2);
+  symbolic->setDeviceMesh(mesh_);
+  hic.addInput(symbolic);
+  Communication* c1 = appendAllgather(hic, symbolic);
+  Communication* c2 = appendAllgather(hic, makeInput(hic));
+
+  hir_pass::CoalesceCommunications(/*max_bucket_bytes=*/1 << 20)
+      .runPass(&hic);
+
+  EXPECT_THAT(
+      hic.topLevelExprs(),
+      ElementsAre(
+          isA<kir::Allocate>(),
+          is(c0),
+          waits(c0),
+          isA<kir::Allocate>(),
+          is(c1),
+          waits(c1),
+          isA<kir::Allocate>(),
+          is(c2),
+          waits(c2)));
+}
+
+} // namespace hir
+
+} // namespace nvfuser
@@ -0,0 +1,108 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <gtest/gtest.h>
+
+#include <fusion.h>
+#include <id_graph_cache.h>
+#include <ops/all_ops.h>
+#include <scheduler/tools/inlining.h>
+#include <scheduler/utils.h>
+#include <tests/cpp/utils.h>
+
+namespace nvfuser {
+
+using IdGraphCacheTest = NVFuserTest;
+
+namespace {
+
+void definePointwise(Fusion* fusion) {
+  FusionGuard fg(fusion);
+  TensorView* tv0 = makeContigTensor(2);
+  TensorView* tv1 = makeContigTensor(1);
+  fusion->addInput(tv0);
+  fusion->addInput(tv1);
+  TensorView* tv2 = add(tv0, broadcast(tv1, {true, false}));
+  TensorView* tv3 = sin(tv2);
+  fusion->addOutput(tv3);
+}
+
+} // namespace
+
+TEST_F(IdGraphCacheTest, ReusedForUnchangedFusion) {
+  Fusion fusion;
+  definePointwise(&fusion);
+
+  std::shared_ptr<ComputeAtMap> ca_map = cachedComputeAtMap(&fusion);
+  EXPECT_EQ(cachedComputeAtMap(&fusion), ca_map);
+
+  std::shared_ptr<IdModel> id_model = cachedIdModel(&fusion);
+  id_model->maybeBuildGraph(IdMappingMode::EXACT);
+  EXPECT_EQ(cachedIdModel(&fusion), id_model);
+  EXPECT_TRUE(cachedIdModel(&fusion)->hasIdGraph(IdMappingMode::EXACT));
+}
+
+TEST_F(IdGraphCacheTest, RebuiltAfterScheduling) {
+  Fusion fusion;
+  definePointwise(&fusion);
+  FusionGuard fg(&fusion);
+  auto tv3 = fusion.outputs().at(0)->as<TensorView>();
+
+  std::shared_ptr<ComputeAtMap> ca_map = cachedComputeAtMap(&fusion);
+  std::shared_ptr<IdModel> id_model = cachedIdModel(&fusion);
+
+  tv3->merge(0);
+  tv3->split(0, 128);
+  std::shared_ptr<ComputeAtMap> scheduled_ca_map =
+      cachedComputeAtMap(&fusion);
+  EXPECT_NE(scheduled_ca_map, ca_map);
+  EXPECT_NE(cachedIdModel(&fusion), id_model);
+  // The new map knows the new IterDomains.
+  EXPECT_TRUE(scheduled_ca_map->idExistsInMap(tv3->axis(0)));
+
+  TransformPropagatorWithCheck propagator(tv3);
+  MaxLogicalDomainInfoSpanningTree(tv3).traverse(&propagator);
+  inlineMost();
+  EXPECT_NE(cachedComputeAtMap(&fusion), scheduled_ca_map);
+}
+
+TEST_F(IdGraphCacheTest, KeptAfterParallelization) {
+  Fusion fusion;
+  definePointwise(&fusion);
+  FusionGuard fg(&fusion);
+  auto tv3 = fusion.outputs().at(0)->as<TensorView>();
+
+  tv3->split(1, 128);
+  TransformPropagatorWithCheck propagator(tv3);
+  MaxLogicalDomainInfoSpanningTree(tv3).traverse(&propagator);
+  inlineMost();
+
+  std::shared_ptr<ComputeAtMap> ca_map = cachedComputeAtMap(&fusion);
+  tv3->axis(0)->parallelize(ParallelType::BIDx);
+  tv3->axis(2)->parallelize(ParallelType::TIDx);
+  scheduler_utils::parallelizeAllLike(tv3);
+  EXPECT_EQ(cachedComputeAtMap(&fusion), ca_map);
+
+  auto tv2 = tv3->definition()->input(0)->as<TensorView>();
+  EXPECT_EQ(tv2->axis(0)->getParallelType(), ParallelType::BIDx);
+  EXPECT_EQ(tv2->axis(2)->getParallelType(), ParallelType::TIDx);
+}
+
+TEST_F(IdGraphCacheTest, NotSharedWithCopies) {
+  Fusion fusion;
+  definePointwise(&fusion);
+  std::shared_ptr<ComputeAtMap> ca_map = cachedComputeAtMap(&fusion);
+
+  Fusion copy(fusion);
+  std::shared_ptr<ComputeAtMap> copy_ca_map = cachedComputeAtMap(&copy);
+  EXPECT_NE(copy_ca_map, ca_map);
+  auto copy_tv = copy.outputs().at(0)->as<TensorView>();
+  EXPECT_TRUE(copy_ca_map->idExistsInMap(copy_tv->axis(0)));
+  EXPECT_EQ(cachedComputeAtMap(&fusion), ca_map);
+}
+
+} // namespace nvfuser
@@ -6372,4 +6372,50 @@ TEST_F(PredicateIndexingTest, AdditionalNonDivisibleSplitAfterDivisibleSplit) {
   testValidate(&fusion, outputs, {t0}, __LINE__, __FILE__);
 }
 
+// Accesses of tensors in the same loop nest share their indexing
+// traversal paths, which TensorIndexer memoizes.
+TEST_F(IndexingTest, MemoizedIndexingPaths) {
+  auto fusion_ptr = std::make_unique<Fusion>();
+  Fusion& fusion = *fusion_ptr;
+  FusionGuard fg(fusion_ptr.get());
+
+  auto tv0 = makeContigTensor(2);
+  fusion.addInput(tv0);
+  auto tv1 = add(tv0, IrBuilder::create<Val>(1.0));
+  auto tv2 = mul(tv1, tv1);
+  auto tv3 = add(tv2, tv1);
+  fusion.addOutput(tv3);
+
+  tv3->flatten();
+  tv3->split(0, 128);
+  tv3->split(0, 4);
+  TransformPropagator propagator(tv3);
+  MaxLogicalDomainInfoSpanningTree(tv3).traverse(&propagator);
+  inlineMost();
+
+  tv3->axis(0)->parallelize(ParallelType::BIDx);
+  tv3->axis(1)->parallelize(ParallelType::Unroll);
+  tv3->axis(2)->parallelize(ParallelType::TIDx);
+  scheduler_utils::parallelizeAllLike(tv3, fusion.allTvs());
+
+  EnableOptionsGuard enable_options_guard;
+  EnableOptionsGuard::getCurOptions().set(EnableOption::IdModel, {"all"});
+
+  GpuLower lower(&fusion);
+  lower.run();
+
+  const IndexingCacheStats& stats = lower.tensorIndexer().cacheStats();
+  EXPECT_GT(stats.path_hits, 0) << stats.toString();
+  EXPECT_GT(stats.index_hits + stats.index_misses, 0) << stats.toString();
+
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  at::Tensor t0 = at::randn({99, 101}, options);
+
+  KernelExecutor ke;
+  ke.compile(&fusion, {t0});
+  auto outputs = ke.run({t0});
+
+  testValidate(&fusion, outputs, {t0}, __LINE__, __FILE__);
+}
+
 } // namespace nvfuser
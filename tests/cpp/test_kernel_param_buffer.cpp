@@ -0,0 +1,219 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cuda.h>
+
+#include <cstring>
+
+#include <fusion.h>
+#include <ir/all_nodes.h>
+#include <ir/builder.h>
+#include <runtime/executor_kernel_arg.h>
+#include <runtime/kernel_param_buffer.h>
+#include <tests/cpp/utils.h>
+
+namespace nvfuser {
+
+using testing::ElementsAre;
+
+// These only encode arguments on the host. No kernel is launched.
+using KernelParamBufferTest = NVFuserTest;
+
+namespace {
+
+std::vector<std::byte> paramBytes(
+    const KernelParamBuffer& buffer,
+    int64_t index) {
+  return std::vector<std::byte>(
+      buffer.param(index), buffer.param(index) + buffer.paramSize(index));
+}
+
+// The bytes of a Tensor<T, N, M> struct, including trailing padding.
+std::vector<std::byte> tensorBytes(
+    void* data,
+    const std::vector<int64_t>& sizes,
+    const std::vector<int64_t>& strides,
+    PrimDataType index_type) {
+  std::vector<std::byte> bytes(KernelParamBuffer::tensorParamSize(
+      std::ssize(sizes), std::ssize(strides), index_type));
+  std::byte* dst = bytes.data();
+  std::memcpy(dst, &data, sizeof(void*));
+  dst += sizeof(void*);
+  for (const std::vector<int64_t>* indices : {&sizes, &strides}) {
+    for (int64_t i : *indices) {
+      if (index_type == PrimDataType::Int) {
+        std::memcpy(dst, &i, sizeof(int64_t));
+        dst += sizeof(int64_t);
+      } else {
+        const auto i32 = (int32_t)i;
+        std::memcpy(dst, &i32, sizeof(int32_t));
+        dst += sizeof(int32_t);
+      }
+    }
+  }
+  return bytes;
+}
+
+} // namespace
+
+TEST_F(KernelParamBufferTest, Layout) {
+  KernelParamBuffer buffer;
+  EXPECT_FALSE(buffer.isLaidOut());
+
+  // A pointer, a bool, a Tensor<T, 1, 1> with 64-bit indices and a float.
+  buffer.layout({8, 1, 24, 4}, {8, 1, 8, 4});
+  EXPECT_TRUE(buffer.isLaidOut());
+  EXPECT_TRUE(buffer.hasAbiLayout());
+  EXPECT_EQ(buffer.numParams(), 4);
+  EXPECT_THAT(
+      std::vector<int64_t>(
+          {buffer.offset(0),
+           buffer.offset(1),
+           buffer.offset(2),
+           buffer.offset(3)}),
+      ElementsAre(0, 8, 16, 40));
+  EXPECT_EQ(buffer.size(), 44);
+
+  void** params = buffer.paramPointers();
+  for (auto i : arange(buffer.numParams())) {
+    EXPECT_EQ(params[i], buffer.param(i));
+  }
+
+  void** config = buffer.launchConfig();
+  EXPECT_EQ(config[0], CU_LAUNCH_PARAM_BUFFER_POINTER);
+  EXPECT_EQ(config[1], buffer.data());
+  EXPECT_EQ(config[2], CU_LAUNCH_PARAM_BUFFER_SIZE);
+  EXPECT_EQ(*static_cast<size_t*>(config[3]), size_t(44));
+  EXPECT_EQ(config[4], CU_LAUNCH_PARAM_END);
+}
+
+// A Tensor<T, 2, 1> with 32-bit indices is 20 bytes followed by 4 bytes of
+// padding, so a parameter after it starts at offset 24.
+TEST_F(KernelParamBufferTest, TrailingPadding) {
+  const int64_t tensor_size =
+      KernelParamBuffer::tensorParamSize(2, 1, PrimDataType::Int32);
+  EXPECT_EQ(tensor_size, 24);
+
+  const std::vector<std::byte> f =
+      polymorphicValueToBytes(1.5, DataType::Float, PrimDataType::Int32);
+  KernelParamBuffer buffer;
+  buffer.layout({tensor_size, std::ssize(f)}, {8, 4});
+  EXPECT_EQ(buffer.offset(1), 24);
+  EXPECT_EQ(buffer.size(), 28);
+
+  auto* data = reinterpret_cast<void*>(0x1000);
+  EXPECT_TRUE(
+      buffer.patchTensor(0, data, {4, 6}, {6}, PrimDataType::Int32));
+  EXPECT_TRUE(buffer.patch(1, f.data(), std::ssize(f)));
+  EXPECT_EQ(
+      paramBytes(buffer, 0),
+      tensorBytes(data, {4, 6}, {6}, PrimDataType::Int32));
+  EXPECT_EQ(paramBytes(buffer, 1), f);
+}
+
+TEST_F(KernelParamBufferTest, UnknownAlignment) {
+  KernelParamBuffer buffer;
+  buffer.layout({4, 8}, {4, 0});
+  EXPECT_FALSE(buffer.hasAbiLayout());
+  EXPECT_EQ(buffer.offset(1), 16);
+  EXPECT_ANY_THROW(buffer.launchConfig());
+}
+
+// Patching a tensor parameter must produce the bytes of a Tensor<T, N, M>
+// struct, and only report a change when a data pointer, extent or stride
+// changes.
+TEST_F(KernelParamBufferTest, PatchTensor) {
+  auto* data0 = reinterpret_cast<void*>(0x1000);
+  auto* data1 = reinterpret_cast<void*>(0x2000);
+
+  for (PrimDataType index_type : {PrimDataType::Int, PrimDataType::Int32}) {
+    const std::vector<int64_t> sizes = {4, 6};
+    const std::vector<int64_t> strides = {6, 1};
+
+    KernelParamBuffer buffer;
+    buffer.layout({KernelParamBuffer::tensorParamSize(2, 2, index_type)}, {8});
+
+    EXPECT_TRUE(buffer.patchTensor(0, data0, sizes, strides, index_type));
+    EXPECT_EQ(
+        paramBytes(buffer, 0), tensorBytes(data0, sizes, strides, index_type));
+    EXPECT_FALSE(buffer.patchTensor(0, data0, sizes, strides, index_type));
+
+    EXPECT_TRUE(buffer.patchTensor(0, data1, sizes, strides, index_type));
+    EXPECT_EQ(
+        paramBytes(buffer, 0), tensorBytes(data1, sizes, strides, index_type));
+
+    const std::vector<int64_t> transposed_sizes = {6, 4};
+    const std::vector<int64_t> transposed_strides = {1, 6};
+    EXPECT_TRUE(buffer.patchTensor(
+        0, data1, transposed_sizes, transposed_strides, index_type));
+    EXPECT_EQ(
+        paramBytes(buffer, 0),
+        tensorBytes(data1, transposed_sizes, transposed_strides, index_type));
+
+    // A different rank doesn't fit the layout.
+    EXPECT_ANY_THROW(buffer.patchTensor(0, data1, {24}, {1}, index_type));
+  }
+}
+
+TEST_F(KernelParamBufferTest, PatchScalars) {
+  const std::vector<std::byte> d =
+      polymorphicValueToBytes(2.5, DataType::Float, PrimDataType::Int);
+  const std::vector<std::byte> i =
+      polymorphicValueToBytes(7L, DataType::Index, PrimDataType::Int32);
+  const std::vector<std::byte> b =
+      polymorphicValueToBytes(true, DataType::Bool, PrimDataType::Int);
+
+  KernelParamBuffer buffer;
+  buffer.layout({std::ssize(b), std::ssize(d), std::ssize(i)}, {1, 4, 4});
+  EXPECT_EQ(buffer.offset(1), 4);
+  EXPECT_EQ(buffer.offset(2), 8);
+
+  EXPECT_TRUE(buffer.patch(0, b.data(), std::ssize(b)));
+  EXPECT_TRUE(buffer.patch(1, d.data(), std::ssize(d)));
+  EXPECT_TRUE(buffer.patch(2, i.data(), std::ssize(i)));
+  EXPECT_EQ(paramBytes(buffer, 0), b);
+  EXPECT_EQ(paramBytes(buffer, 1), d);
+  EXPECT_EQ(paramBytes(buffer, 2), i);
+  EXPECT_FALSE(buffer.patch(1, d.data(), std::ssize(d)));
+
+  EXPECT_ANY_THROW(buffer.patch(1, i.data(), 2));
+}
+
+TEST_F(KernelParamBufferTest, ParamAlignment) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  TensorView* tv = makeSymbolicTensor(2, DataType::Half);
+  TensorView* cpu_scalar = makeSymbolicTensor(0, DataType::Double);
+  cpu_scalar->setCpuScalar(true);
+  Val* b = IrBuilder::create<Val>(DataType::Bool);
+  Val* f = IrBuilder::create<Val>(DataType::Float);
+  Val* index = IrBuilder::create<Val>(DataType::Index);
+  Val* complex = IrBuilder::create<Val>(DataType::ComplexDouble);
+  Val* array = IrBuilder::create<Val>(
+      ArrayType{std::make_shared<DataType>(DataType::Int32), 3});
+  Val* opaque =
+      IrBuilder::create<Val>(OpaqueType::make<CUtensorMap>("TensorMap"));
+
+  const auto alignment = [](Val* param, PrimDataType index_type) {
+    return KernelParamBuffer::paramAlignment(param, index_type);
+  };
+  EXPECT_EQ(alignment(tv, PrimDataType::Int32), 8);
+  EXPECT_EQ(alignment(cpu_scalar, PrimDataType::Int), 8);
+  EXPECT_EQ(alignment(b, PrimDataType::Int), 1);
+  EXPECT_EQ(alignment(f, PrimDataType::Int), 4);
+  EXPECT_EQ(alignment(index, PrimDataType::Int), 8);
+  EXPECT_EQ(alignment(index, PrimDataType::Int32), 4);
+  EXPECT_EQ(alignment(complex, PrimDataType::Int), 16);
+  EXPECT_EQ(alignment(array, PrimDataType::Int), 4);
+  EXPECT_EQ(alignment(opaque, PrimDataType::Int), 64);
+}
+
+} // namespace nvfuser
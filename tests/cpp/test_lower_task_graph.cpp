@@ -0,0 +1,198 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <codegen.h>
+#include <device_lower/lower2device.h>
+#include <device_lower/task_graph.h>
+#include <fusion.h>
+#include <ir/builder.h>
+#include <ops/all_ops.h>
+#include <options.h>
+#include <scheduler/tools/inlining.h>
+#include <tests/cpp/utils.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+namespace nvfuser {
+
+using testing::ElementsAre;
+using testing::HasSubstr;
+using testing::IsEmpty;
+using testing::ThrowsMessage;
+
+using LowerTaskGraphTest = NVFuserTest;
+
+TEST_F(LowerTaskGraphTest, Dependencies) {
+  using R = LowerResource;
+  LowerTaskGraph graph;
+  graph.add("a", {R::FusionIr}, {R::SyncMap}, []() {});
+  graph.add("b", {R::FusionIr}, {R::VectorizeInfo}, []() {});
+  graph.add("c", {R::SyncMap}, {}, []() {});
+  graph.add("d", {}, {R::FusionIr}, []() {});
+
+  EXPECT_THAT(graph.dependencies(0), IsEmpty());
+  // Readers of the same resource don't wait for each other.
+  EXPECT_THAT(graph.dependencies(1), IsEmpty());
+  EXPECT_THAT(graph.dependencies(2), ElementsAre("a"));
+  // Writers wait for all earlier readers.
+  EXPECT_THAT(graph.dependencies(3), ElementsAre("a", "b"));
+}
+
+TEST_F(LowerTaskGraphTest, RunsInOrderOfDependencies) {
+  using R = LowerResource;
+  std::mutex mutex;
+  std::vector<std::string> log;
+  auto record = [&](const std::string& name) {
+    return [&, name]() {
+      std::lock_guard<std::mutex> lock(mutex);
+      log.push_back(name);
+    };
+  };
+
+  LowerTaskGraph graph;
+  graph.add("a", {}, {R::SyncMap}, record("a"));
+  graph.add("b", {R::SyncMap}, {R::VectorizeInfo}, record("b"));
+  graph.add("c", {R::VectorizeInfo}, {R::SyncMap}, record("c"));
+  graph.run(/*concurrent=*/true);
+
+  EXPECT_THAT(log, ElementsAre("a", "b", "c"));
+}
+
+TEST_F(LowerTaskGraphTest, IndependentTasksRunConcurrently) {
+  using R = LowerResource;
+  // Each task waits for the other to start, which only finishes if they run
+  // at the same time.
+  std::atomic<int64_t> num_started = 0;
+  auto wait_for_both = [&num_started]() {
+    num_started++;
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (num_started.load() < 2) {
+      NVF_CHECK(
+          std::chrono::steady_clock::now() < deadline,
+          "The other task didn't start");
+      std::this_thread::yield();
+    }
+  };
+
+  LowerTaskGraph graph;
+  graph.add("a", {R::FusionIr}, {R::SyncMap}, wait_for_both);
+  graph.add("b", {R::FusionIr}, {R::VectorizeInfo}, wait_for_both);
+  graph.run(/*concurrent=*/true);
+  EXPECT_EQ(num_started.load(), 2);
+}
+
+TEST_F(LowerTaskGraphTest, RethrowsEarliestError) {
+  using R = LowerResource;
+  bool ran_dependent = false;
+  LowerTaskGraph graph;
+  graph.add("a", {}, {R::SyncMap}, []() { NVF_THROW("error from a"); });
+  graph.add("b", {}, {R::VectorizeInfo}, []() { NVF_THROW("error from b"); });
+  graph.add(
+      "c", {R::SyncMap}, {}, [&ran_dependent]() { ran_dependent = true; });
+
+  EXPECT_THAT(
+      [&]() { graph.run(/*concurrent=*/true); },
+      ThrowsMessage<nvfError>(HasSubstr("error from a")));
+  EXPECT_FALSE(ran_dependent);
+}
+
+TEST_F(LowerTaskGraphTest, WorkersInheritContext) {
+  using R = LowerResource;
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+  DisableOptionsGuard options_guard;
+  DisableOptionsGuard::getCurOptions().set(DisableOption::Fma);
+
+  std::atomic<int64_t> num_checked = 0;
+  auto check = [&]() {
+    EXPECT_EQ(FusionGuard::getCurFusion(), &fusion);
+    EXPECT_TRUE(isOptionDisabled(DisableOption::Fma));
+    num_checked++;
+  };
+  LowerTaskGraph graph;
+  graph.add("a", {R::FusionIr}, {R::SyncMap}, check);
+  graph.add("b", {R::FusionIr}, {R::VectorizeInfo}, check);
+  graph.add("c", {R::FusionIr}, {R::TensorProducerAliases}, check);
+  graph.run(/*concurrent=*/true);
+  EXPECT_EQ(num_checked.load(), 3);
+}
+
+// A task that creates IR nodes without declaring it writes FusionIr fails
+// in debug builds. The shortcut Vals are created before any task runs.
+TEST_F(LowerTaskGraphTest, UndeclaredIrWrite) {
+#ifdef NDEBUG
+  GTEST_SKIP() << "IR writes are only checked in debug builds";
+#endif
+  using R = LowerResource;
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  for (bool concurrent : {false, true}) {
+    LowerTaskGraph graph;
+    graph.add("reads shortcuts", {R::FusionIr}, {R::SyncMap}, [&fusion]() {
+      fusion.zeroVal();
+      fusion.trueVal();
+    });
+    graph.add("writes", {}, {R::FusionIr}, []() {
+      IrBuilder::create<Val>(DataType::Index);
+    });
+    graph.add("undeclared write", {R::FusionIr}, {R::VectorizeInfo}, []() {
+      IrBuilder::create<Val>(DataType::Index);
+    });
+    EXPECT_THAT(
+        [&]() { graph.run(concurrent); },
+        ThrowsMessage<nvfError>(HasSubstr("must declare writing")));
+  }
+}
+
+// Running analyses concurrently must not change the generated code.
+TEST_F(LowerTaskGraphTest, SameKernelAsSequential) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  TensorView* tv0 = makeContigTensor(2);
+  TensorView* tv1 = makeContigTensor(1);
+  fusion.addInput(tv0);
+  fusion.addInput(tv1);
+  TensorView* tv2 = sum(tv0, {1});
+  TensorView* tv3 = add(tv0, broadcast(tv2, {false, true}));
+  TensorView* tv4 = mul(tv3, broadcast(tv1, {true, false}));
+  fusion.addOutput(tv4);
+
+  tv4->split(1, 128);
+  tv4->axis(0)->parallelize(ParallelType::BIDx);
+  tv4->axis(2)->parallelize(ParallelType::TIDx);
+  tv2->split(1, 128);
+  tv2->axis(0)->parallelize(ParallelType::BIDx);
+  tv2->axis(2)->parallelize(ParallelType::TIDx);
+  inlineMost();
+
+  auto lower = [&fusion](bool parallel) {
+    DisableOptionsGuard options_guard;
+    if (!parallel) {
+      DisableOptionsGuard::getCurOptions().set(
+          DisableOption::ParallelLowering);
+    }
+    GpuLower gpu_lower(&fusion);
+    gpu_lower.run();
+    return codegen::generateCudaKernel(gpu_lower.kernel());
+  };
+
+  const std::string sequential = lower(/*parallel=*/false);
+  for ([[maybe_unused]] auto i : arange(4)) {
+    EXPECT_EQ(lower(/*parallel=*/true), sequential);
+  }
+}
+
+} // namespace nvfuser
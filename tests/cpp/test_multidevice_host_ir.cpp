@@ -9,8 +9,10 @@
 #include <fusion.h>
 #include <host_ir/container.h>
 #include <host_ir/executor.h>
+#include <host_ir/pass/coalesce_communications.h>
 #include <host_ir/pass/stream_parallel_type.h>
 #include <ir/all_nodes.h>
+#include <multidevice/communication.h>
 #include <ops/all_ops.h>
 #include <preseg_passes/reorder_sharded_axis.h>
 #include <tests/cpp/multidevice.h>
@@ -361,6 +363,68 @@ TEST_F(P2PCommHostIrTest, CoalescedRingPairwiseExchange) {
   EXPECT_TRUE(torch::allclose(ref_output, outputs.back().as<at::Tensor>()));
 }
 
+TEST_F(MultiDeviceTest, CoalescedAllgathersOnSubTeam) {
+  constexpr int64_t kTensorSize = 8;
+  if (communicator_->size() < 2) {
+    GTEST_SKIP() << "This test needs a team smaller than the world.";
+  }
+
+  // All devices but the last one, so the coalescing region must apply to
+  // the process group of the team, not the world.
+  const int64_t team_size = communicator_->size() - 1;
+  const DeviceMesh mesh = DeviceMesh::createForNumDevices(team_size);
+
+  auto hic = std::make_unique<HostIrContainer>();
+  FusionGuard fg(hic.get());
+
+  std::vector<TensorView*> ins;
+  for ([[maybe_unused]] auto i : arange(2)) {
+    TensorView* in = makeContigConcreteTensor({1, kTensorSize});
+    in->setDeviceMesh(mesh);
+    TensorView* out = makeContigConcreteTensor({team_size, kTensorSize});
+    out->setDeviceMesh(mesh);
+    out->setMemoryType(MemoryType::Global);
+    auto* allgather = IrBuilder::create<Communication>(
+        CommunicationType::Allgather, out, in, mesh.vector());
+    hic->addInput(in);
+    hic->addOutput(out);
+    hic->pushBackTopLevelExprs(
+        IrBuilder::create<kir::Allocate>(out, MemoryType::Global));
+    hic->pushBackTopLevelExprs(allgather);
+    hic->pushBackTopLevelExprs(IrBuilder::create<Wait>(allgather));
+    ins.push_back(in);
+  }
+
+  hir_pass::CoalesceCommunications(/*max_bucket_bytes=*/1 << 20)
+      .runPass(hic.get());
+  ASSERT_EQ(
+      std::count_if(
+          hic->topLevelExprs().begin(),
+          hic->topLevelExprs().end(),
+          [](Expr* e) { return e->isA<StartCoalescing>(); }),
+      1);
+
+  HostIrEvaluator hie(std::move(hic), communicator_);
+
+  auto options = at::TensorOptions().device(communicator_->device());
+  const int64_t my_device_index = communicator_->deviceId();
+  std::unordered_map<Val*, PolymorphicValue> inputs;
+  for (auto&& [i, in] : enumerate(ins)) {
+    inputs[in] = at::arange(kTensorSize, options).unsqueeze(0) +
+        my_device_index * 10 + (int64_t)i;
+  }
+  KernelArgumentHolder outputs = hie.runWithInput(inputs);
+
+  if (my_device_index >= team_size) {
+    return;
+  }
+  for (auto&& [i, output] : enumerate(outputs)) {
+    at::Tensor expected = at::arange(kTensorSize, options).unsqueeze(0) +
+        at::arange(team_size, options).unsqueeze(1) * 10 + (int64_t)i;
+    EXPECT_TRUE(at::equal(output.as<at::Tensor>(), expected));
+  }
+}
+
 TEST_F(MultiDeviceTest, ShareIpcMemHandles) {
   static constexpr int kTensorSize = 4;
   static constexpr int kNumRepetitions = 10;
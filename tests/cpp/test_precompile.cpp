@@ -0,0 +1,93 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <gtest/gtest.h>
+
+#include <fusion.h>
+#include <ops/all_ops.h>
+#include <runtime/fusion_executor_cache.h>
+#include <runtime/fusion_kernel_runtime.h>
+#include <serde/fusion_cache_generated.h>
+#include <tests/cpp/utils.h>
+
+namespace nvfuser {
+
+using PrecompileTest = NVFuserTest;
+
+namespace {
+
+std::unique_ptr<Fusion> makeFusion() {
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+  TensorView* in = makeContigTensor(2);
+  fusion->addInput(in);
+  TensorView* out = sum(relu(in), {1});
+  fusion->addOutput(out);
+  return fusion;
+}
+
+KernelArgumentHolder makeSignature(int64_t rows, int64_t cols) {
+  KernelArgumentHolder signature;
+  signature.pushTensorProxy({rows, cols}, {cols, 1}, at::kFloat);
+  return signature;
+}
+
+} // namespace
+
+TEST_F(PrecompileTest, WarmsCache) {
+  FusionExecutorCache executor_cache(makeFusion());
+
+  std::vector<KernelArgumentHolder> signatures;
+  for (int64_t cols : {64, 1024, 16384}) {
+    signatures.push_back(makeSignature(128, cols));
+  }
+  executor_cache.precompile(signatures);
+
+  const size_t num_runtimes = executor_cache.countRuntimes();
+  EXPECT_GE(num_runtimes, 1);
+  for (const KernelArgumentHolder& signature : signatures) {
+    EXPECT_TRUE(executor_cache.isCompiled(signature));
+  }
+  for (const auto& [key, runtimes] : executor_cache.getKernelRuntimes()) {
+    for (const auto& runtime : runtimes) {
+      EXPECT_TRUE(runtime->isCompiled());
+    }
+  }
+
+  // Real tensors of a precompiled signature don't create a new runtime.
+  // Kernel launches are disabled because only the lookup is tested.
+  executor_cache.disableKernelLaunch();
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  executor_cache.runFusionWithInputs({at::empty({128, 1024}, options)});
+  EXPECT_EQ(executor_cache.countRuntimes(), num_runtimes);
+
+  // Precompiling again is a no-op.
+  executor_cache.precompile(signatures);
+  EXPECT_EQ(executor_cache.countRuntimes(), num_runtimes);
+}
+
+TEST_F(PrecompileTest, Serialize) {
+  FusionExecutorCache executor_cache(makeFusion());
+  executor_cache.precompile({makeSignature(32, 64), makeSignature(32, 8192)});
+  const size_t num_runtimes = executor_cache.countRuntimes();
+
+  flatbuffers::FlatBufferBuilder builder;
+  builder.Finish(executor_cache.serialize(builder));
+  const auto* buffer = flatbuffers::GetRoot<serde::FusionExecutorCache>(
+      builder.GetBufferPointer());
+
+  FusionExecutorCache restored(makeFusion());
+  restored.deserialize(buffer, /*fusion_id=*/0);
+  EXPECT_EQ(restored.countRuntimes(), num_runtimes);
+  for (const auto& [key, runtimes] : restored.getKernelRuntimes()) {
+    for (const auto& runtime : runtimes) {
+      EXPECT_TRUE(runtime->isCompiled());
+    }
+  }
+}
+
+} // namespace nvfuser
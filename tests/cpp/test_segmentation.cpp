@@ -9,15 +9,23 @@
 #include <gtest/gtest.h>
 
 #include <fusion.h>
+#include <fusion_segmenter.h>
+#include <fusion_view.h>
+#include <ir/utils.h>
 #include <ops/all_ops.h>
 #include <preseg_passes/mark_aliases_prepare.h>
 #include <preseg_passes/optimization_pass.h>
+#include <runtime/fusion_cache_utils.h>
+#include <scheduler/registry.h>
 #include <tests/cpp/utils.h>
 #include <tests/cpp/validator.h>
 
 namespace nvfuser {
 
+using testing::ElementsAre;
+using testing::IsEmpty;
 using testing::SizeIs;
+using testing::UnorderedElementsAre;
 
 using SegmentationTest = NVFuserTest;
 
@@ -609,6 +617,100 @@ TEST_F(SegmentationTest, EraseReductionsInSegmentationEdges) {
   }
 }
 
+// Each segment's Fusion should only contain that segment's subgraph, not a
+// copy of the complete fusion.
+TEST_F(SegmentationTest, MakeFusionClonesOnlySegment) {
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+
+  TensorView* in = makeContigTensor(2);
+  fusion->addInput(in);
+  TensorView* x = in;
+  constexpr int64_t kNumSegments = 4;
+  for ([[maybe_unused]] auto i : arange(kNumSegments)) {
+    x = segment_set(exp(sum(x, {1}, /*keep_dim=*/true)));
+    x = add(x, in);
+  }
+  fusion->addOutput(x);
+
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  at::Tensor in_tensor = at::randn({8, 16}, options);
+  std::unique_ptr<SegmentedFusion> segmented_fusion =
+      SegmentCandidateFinder::segment(std::move(fusion), {in_tensor});
+  ASSERT_GT(segmented_fusion->groups().size(), 1);
+
+  const int64_t num_complete_tvs = std::ssize(
+      ir_utils::filterByType<TensorView>(
+          segmented_fusion->completeFusion()->vals())
+          .vector());
+  for (SegmentedGroup* group : segmented_fusion->groups()) {
+    std::unique_ptr<Fusion> segment_fusion =
+        segmented_fusion->makeFusion(group).second;
+
+    // Every TensorView is either a segment input or produced in the segment.
+    std::vector<TensorView*> tvs =
+        ir_utils::filterByType<TensorView>(segment_fusion->vals()).vector();
+    for (TensorView* tv : tvs) {
+      EXPECT_TRUE(tv->isFusionInput() || tv->definition() != nullptr)
+          << tv->toString() << " is not part of the segment";
+    }
+    EXPECT_LT(std::ssize(tvs), num_complete_tvs);
+  }
+}
+
+TEST_F(SegmentationTest, FusionView) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  TensorView* in = makeContigTensor(2);
+  fusion.addInput(in);
+  TensorView* a = relu(in);
+  TensorView* b = neg(a);
+  TensorView* c = add(b, a);
+  TensorView* out = exp(c);
+  fusion.addOutput(out);
+
+  // View the part computing c from a.
+  FusionView view(&fusion, {a}, {c});
+  EXPECT_THAT(view.exprs(), ElementsAre(b->definition(), c->definition()));
+  EXPECT_THAT(view.allTvs(), ElementsAre(a, b, c));
+  EXPECT_THAT(
+      view.uses(a),
+      UnorderedElementsAre(b->definition(), c->definition()));
+  // Uses outside the view don't count.
+  EXPECT_THAT(view.uses(c), IsEmpty());
+  EXPECT_TRUE(view.isOutput(c));
+  EXPECT_FALSE(view.contains(out->definition()));
+
+  // The fusion itself is untouched.
+  EXPECT_THAT(fusion.inputs(), ElementsAre(in));
+  EXPECT_THAT(fusion.outputs(), ElementsAre(out));
+}
+
+TEST_F(SegmentationTest, CanScheduleCompileTimeOnView) {
+  Fusion fusion;
+  FusionGuard fg(&fusion);
+
+  TensorView* in = makeContigTensor(2);
+  TensorView* idx = makeContigTensor(2, DataType::Int);
+  TensorView* src = makeContigTensor(2);
+  fusion.addInput(in);
+  fusion.addInput(idx);
+  fusion.addInput(src);
+  TensorView* scattered = scatter(in, 0, idx, src);
+  TensorView* out = relu(scattered);
+  fusion.addOutput(out);
+
+  // ExprEval takes the scatter alone.
+  EXPECT_TRUE(Schedule::canScheduleCompileTime(
+      FusionView(&fusion, {in, idx, src}, {scattered})));
+  EXPECT_TRUE(Schedule::canScheduleCompileTime(
+      FusionView(&fusion, {scattered}, {out})));
+  // No scheduler takes the scatter together with the relu.
+  EXPECT_FALSE(Schedule::canScheduleCompileTime(
+      FusionView(&fusion, {in, idx, src}, {out})));
+}
+
 TEST_F(SegmentationTest, AliasedOutputOnSegmentation) {
   auto fusion = std::make_unique<Fusion>();
   FusionGuard fg(fusion.get());
@@ -862,4 +964,63 @@ TEST_F(SegmentationTest, ForwardFull) {
   }
 }
 
+// Values passed between segments are released after the last segment that
+// uses them. Fusion inputs and outputs are never released.
+TEST_F(SegmentationTest, SegmentDataflowPlan) {
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+  TensorView* in = makeContigTensor(2);
+  fusion->addInput(in);
+  TensorView* out = segment_set(relu(in));
+  out = segment_set(neg(out));
+  out = segment_set(exp(out));
+  out = sin(out);
+  fusion->addOutput(out);
+  fusion->addOutput(out);
+
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  at::Tensor in_tensor = at::randn({4, 8}, options);
+  FusionExecutorCache executor_cache(std::move(fusion));
+  auto out_tensors = executor_cache.runFusionWithInputs({in_tensor});
+  testValidate(
+      executor_cache.fusion(), out_tensors, {in_tensor}, __LINE__, __FILE__);
+
+  SegmentedFusion* segmented_fusion =
+      executor_cache.getMostRecentKernelRuntime()->fusionSegments();
+  RuntimeWorkSpace workspace;
+  prepareRuntimeOrder(segmented_fusion, workspace);
+  const std::vector<SegmentedGroup*>& order = workspace.group_run_order;
+  ASSERT_THAT(order, SizeIs(4));
+  const SegmentDataflowPlan plan(
+      workspace, segmented_fusion->inputs(), segmented_fusion->outputs());
+
+  EXPECT_THAT(plan.releasedSlots(0), IsEmpty());
+  for (int64_t run_order_id : {1, 2, 3}) {
+    Val* intermediate = order.at(run_order_id)->inputs().at(0);
+    EXPECT_THAT(
+        plan.releasedSlots(run_order_id),
+        ElementsAre(plan.slot(intermediate)));
+  }
+
+  // Pass the input through every segment instead of running them.
+  KernelArgumentHolder args(in_tensor);
+  std::vector<PolymorphicValue> slots = plan.bindInputs(args);
+  Val* extent = workspace.group_extent_binding_order.at(1);
+  EXPECT_EQ(slots.at(plan.slot(extent)).as<int64_t>(), 8);
+  for (int64_t run_order_id : arange(std::ssize(order))) {
+    KernelArgumentHolder inputs = plan.segmentInputs(slots, run_order_id);
+    ASSERT_EQ(inputs.size(), 1);
+    EXPECT_TRUE(inputs[0].as<at::Tensor>().is_same(in_tensor));
+    plan.storeSegmentOutputs(slots, std::move(inputs), run_order_id);
+    if (run_order_id > 0) {
+      EXPECT_FALSE(slots.at(plan.slot(order.at(run_order_id)->inputs().at(0)))
+                       .hasValue());
+    }
+  }
+  KernelArgumentHolder outputs = plan.takeFusionOutputs(slots);
+  ASSERT_EQ(outputs.size(), 2);
+  EXPECT_TRUE(outputs[0].as<at::Tensor>().is_same(in_tensor));
+  EXPECT_TRUE(outputs[1].as<at::Tensor>().is_same(in_tensor));
+}
+
 } // namespace nvfuser
@@ -0,0 +1,121 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <gtest/gtest.h>
+
+#include <fusion.h>
+#include <ops/all_ops.h>
+#include <runtime/fusion_executor_cache.h>
+#include <runtime/shape_bucketing.h>
+#include <tests/cpp/utils.h>
+#include <tests/cpp/validator.h>
+
+namespace nvfuser {
+
+using ShapeBucketingTest = NVFuserTest;
+
+namespace {
+
+std::unique_ptr<Fusion> makeSumFusion() {
+  auto fusion = std::make_unique<Fusion>();
+  FusionGuard fg(fusion.get());
+  TensorView* in = makeContigTensor(2);
+  fusion->addInput(in);
+  TensorView* out = sum(in, {1});
+  fusion->addOutput(out);
+  return fusion;
+}
+
+} // namespace
+
+TEST_F(ShapeBucketingTest, Representative) {
+  const ShapeBucketing power_of_two;
+  EXPECT_EQ(power_of_two.bucket(1), 1);
+  EXPECT_EQ(power_of_two.bucket(1000), 1024);
+  EXPECT_EQ(power_of_two.bucket(1024), 1024);
+  EXPECT_EQ(power_of_two.bucket(1025), 2048);
+
+  for (int64_t extent : {0, 1, 2, 7, 17, 100, 1000, 1023, 1024, 1025}) {
+    const int64_t representative = power_of_two.representative(extent);
+    EXPECT_GE(representative, extent);
+    EXPECT_LE(representative, power_of_two.bucket(extent));
+    // Keeps the divisibility vectorization depends on.
+    EXPECT_EQ(
+        (representative - extent) % ShapeBucketing::kMaxVectorizationElements,
+        0);
+  }
+  EXPECT_EQ(power_of_two.representative(1000), 1016);
+  EXPECT_EQ(power_of_two.representative(1008), 1024);
+
+  const ShapeBucketing custom({128, 512});
+  EXPECT_EQ(custom.bucket(100), 128);
+  EXPECT_EQ(custom.bucket(300), 512);
+  // Larger than the last boundary, so not bucketed.
+  EXPECT_EQ(custom.bucket(600), 600);
+  EXPECT_EQ(custom.representative(600), 600);
+
+  EXPECT_ANY_THROW(ShapeBucketing({512, 128}));
+}
+
+TEST_F(ShapeBucketingTest, BucketArgs) {
+  const ShapeBucketing bucketing;
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+
+  at::Tensor t = at::randn({1000, 20}, options);
+  std::optional<KernelArgumentHolder> bucketed =
+      bucketing.bucketArgs({t, 2.0});
+  ASSERT_TRUE(bucketed.has_value());
+  ASSERT_EQ(bucketed->size(), 2);
+  const auto& proxy = (*bucketed)[0].as<at::Tensor>();
+  EXPECT_TRUE(proxy.is_meta());
+  EXPECT_EQ(proxy.sizes(), at::IntArrayRef({1016, 20}));
+  EXPECT_TRUE(proxy.is_contiguous());
+  EXPECT_EQ((*bucketed)[1].as<double>(), 2.0);
+
+  // Non-contiguous and misaligned tensors are not bucketed.
+  EXPECT_FALSE(bucketing.bucketArgs({t.t()}).has_value());
+  EXPECT_FALSE(bucketing.bucketArgs({t.view({-1}).slice(0, 1)}).has_value());
+}
+
+// Sweeps the outer extent and checks bucketing creates fewer runtimes. Only
+// heuristics are computed; nothing is compiled.
+TEST_F(ShapeBucketingTest, SequenceLengthSweep) {
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+
+  auto count_runtimes = [&](std::optional<ShapeBucketing> bucketing) {
+    FusionExecutorCache executor_cache(makeSumFusion());
+    executor_cache.setShapeBucketing(bucketing);
+    for (int64_t seq = 1; seq <= 4096; seq += 3) {
+      executor_cache.isCompiled({at::empty({seq, 1024}, options)});
+    }
+    return executor_cache.countRuntimes();
+  };
+
+  const size_t without_bucketing = count_runtimes(std::nullopt);
+  const size_t with_bucketing = count_runtimes(ShapeBucketing());
+  EXPECT_LT(with_bucketing, without_bucketing);
+}
+
+TEST_F(ShapeBucketingTest, Correctness) {
+  FusionExecutorCache executor_cache(makeSumFusion());
+  executor_cache.setShapeBucketing(ShapeBucketing());
+
+  auto options = at::TensorOptions().dtype(at::kFloat).device(at::kCUDA, 0);
+  for (int64_t seq : {1000, 1016, 700, 513}) {
+    at::Tensor in = at::randn({seq, 1024}, options);
+    auto outputs = executor_cache.runFusionWithInputs({in});
+    testValidate(executor_cache.fusion(), outputs, {in}, __LINE__, __FILE__);
+  }
+  // 1000 and 1016 share a representative, so the second lookup reuses the
+  // first runtime.
+  const ShapeBucketingStats& stats = executor_cache.shapeBucketingStats();
+  EXPECT_EQ(stats.bucketed_lookups, 4);
+  EXPECT_GE(stats.reused_runtimes, 1);
+  EXPECT_EQ(stats.reused_runtimes + stats.new_runtimes, 4);
+}
+
+} // namespace nvfuser
@@ -0,0 +1,115 @@
+// clang-format off
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-present NVIDIA CORPORATION & AFFILIATES.
+ * All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// clang-format on
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+#include <options.h>
+#include <target_device.h>
+#include <tests/cpp/utils.h>
+#include <type.h>
+#include <utils.h>
+
+namespace nvfuser {
+
+using testing::HasSubstr;
+using testing::ThrowsMessage;
+
+using TargetDeviceTest = NVFuserTest;
+
+namespace {
+
+TargetDevice parseDescriptor(const std::string& descriptor) {
+  std::istringstream is(descriptor);
+  return TargetDevice::parse(is);
+}
+
+} // namespace
+
+TEST_F(TargetDeviceTest, Parse) {
+  const TargetDevice target = parseDescriptor(R"(
+# A made-up device.
+name = T4
+compute_capability = 7.5
+multi_processor_count = 40   # SMs
+shared_mem_per_block_optin = 65536
+memory_bandwidth = 3.2e11
+clock_rate_khz = 1590000
+)");
+  EXPECT_EQ(target.name, "T4");
+  EXPECT_EQ(target.major, 7);
+  EXPECT_EQ(target.minor, 5);
+  EXPECT_EQ(target.multi_processor_count, 40);
+  EXPECT_EQ(target.shared_mem_per_block_optin, 65536);
+  EXPECT_DOUBLE_EQ(target.memory_bandwidth, 3.2e11);
+  EXPECT_EQ(target.clock_rate_khz, 1590000);
+  // Keys left out keep their defaults.
+  EXPECT_EQ(target.warp_size, TargetDevice().warp_size);
+}
+
+TEST_F(TargetDeviceTest, ParseErrors) {
+  EXPECT_THAT(
+      [] { parseDescriptor("num_sms = 132"); },
+      ThrowsMessage<nvfError>(HasSubstr("Unknown target device key")));
+  EXPECT_THAT(
+      [] { parseDescriptor("compute_capability = 90"); },
+      ThrowsMessage<nvfError>(HasSubstr("major.minor")));
+  EXPECT_THAT(
+      [] { parseDescriptor("multi_processor_count"); },
+      ThrowsMessage<nvfError>(HasSubstr("key = value")));
+}
+
+TEST_F(TargetDeviceTest, Guard) {
+  TargetDevice sm75;
+  sm75.major = 7;
+  sm75.minor = 5;
+  sm75.multi_processor_count = 40;
+  sm75.shared_mem_per_block_optin = 65536;
+
+  TargetDevice sm90;
+  sm90.major = 9;
+  sm90.minor = 0;
+  sm90.multi_processor_count = 132;
+
+  {
+    TargetDeviceGuard outer(sm90);
+    EXPECT_EQ(getTargetDeviceProperties()->multiProcessorCount, 132);
+    EXPECT_TRUE(isSupportedTypeByDevice(DataType::BFloat16));
+    {
+      TargetDeviceGuard inner(sm75);
+      EXPECT_EQ(currentTargetDevice(), sm75);
+      EXPECT_EQ(getTargetDeviceProperties()->multiProcessorCount, 40);
+      EXPECT_FALSE(isSupportedTypeByDevice(DataType::BFloat16));
+      EXPECT_EQ(deviceAvailableSharedMemoryBytes(), 65536u);
+    }
+    EXPECT_EQ(currentTargetDevice(), sm90);
+  }
+}
+
+// A guard only affects its own thread and the threads it hands work to with
+// InheritedOptions.
+TEST_F(TargetDeviceTest, GuardIsPerThread) {
+  TargetDevice sm90;
+  sm90.major = 9;
+  sm90.minor = 0;
+  sm90.multi_processor_count = 132;
+
+  TargetDeviceGuard guard(sm90);
+  const InheritedOptions options = InheritedOptions::capture();
+
+  std::thread([]() { EXPECT_EQ(guardedTargetDevice(), nullptr); }).join();
+  std::thread([&]() {
+    InheritedOptionsGuard options_guard(options);
+    EXPECT_EQ(currentTargetDevice(), sm90);
+    EXPECT_EQ(getTargetDeviceProperties()->multiProcessorCount, 132);
+  }).join();
+}
+
+} // namespace nvfuser
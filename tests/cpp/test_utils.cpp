@@ -28,6 +28,7 @@
 #include <random>
 #include <ranges>
 #include <system_error>
+#include <thread>
 #include <vector>
 
 namespace nvfuser {
@@ -2170,4 +2171,127 @@ TEST_F(NVFuserTest, Generator5) {
       ::testing::ThrowsMessage<std::runtime_error>("Hello, world!"));
 }
 
+using KernelArgumentHolderTest = NVFuserTest;
+
+// More arguments than are stored inline spill to the heap without
+// disturbing the ones already pushed.
+TEST_F(KernelArgumentHolderTest, SpillsInlineStorage) {
+  KernelArgumentHolder args;
+  const int64_t num_args = KernelArgumentHolder::kNumInlineArguments + 4;
+  for (auto i : arange(num_args)) {
+    args.push(PolymorphicValue(i));
+  }
+  ASSERT_EQ(args.size(), num_args);
+  for (auto i : arange(num_args)) {
+    EXPECT_EQ(args[i].as<int64_t>(), i);
+  }
+  EXPECT_ANY_THROW(args[num_args]);
+
+  KernelArgumentHolder copy = args;
+  KernelArgumentHolder moved = std::move(args);
+  EXPECT_EQ(copy.size(), num_args);
+  EXPECT_EQ(moved.size(), num_args);
+  EXPECT_EQ(moved.back().as<int64_t>(), num_args - 1);
+}
+
+TEST_F(KernelArgumentHolderTest, MovePushDoesNotCopyTensors) {
+  at::Tensor t = at::zeros({2, 3});
+  KernelArgumentHolder src;
+  src.push(t);
+  ASSERT_EQ(t.use_count(), 2);
+
+  KernelArgumentHolder dst;
+  dst.push(std::move(src));
+  EXPECT_EQ(t.use_count(), 2);
+  EXPECT_TRUE(src.empty());
+  ASSERT_EQ(dst.size(), 1);
+  EXPECT_TRUE(dst[0].as<at::Tensor>().is_same(t));
+}
+
+TEST_F(KernelArgumentHolderTest, Span) {
+  at::Tensor t = at::zeros({4});
+  KernelArgumentHolder args;
+  args.push(t);
+  args.push(PolymorphicValue(3L));
+  args.push(PolymorphicValue(2.5));
+  args.setCacheId(7);
+
+  KernelArgumentSpan span = args;
+  EXPECT_EQ(t.use_count(), 2);
+  ASSERT_EQ(span.size(), 3);
+  EXPECT_TRUE(span[0].as<at::Tensor>().is_same(t));
+  EXPECT_EQ(span[1].as<int64_t>(), 3);
+  EXPECT_EQ(span.getCacheId(), std::optional<size_t>(7));
+  EXPECT_ANY_THROW(span[3]);
+
+  KernelArgumentSpan scalars = span.subspan(1, 2);
+  ASSERT_EQ(scalars.size(), 2);
+  EXPECT_EQ(scalars[0].as<int64_t>(), 3);
+  EXPECT_EQ(scalars[1].as<double>(), 2.5);
+  EXPECT_ANY_THROW(span.subspan(2, 2));
+
+  KernelArgumentHolder copy = scalars.toHolder();
+  ASSERT_EQ(copy.size(), 2);
+  EXPECT_EQ(copy[1].as<double>(), 2.5);
+  EXPECT_EQ(copy.getCacheId(), std::optional<size_t>(7));
+}
+
+using OptionsTest = NVFuserTest;
+
+TEST_F(OptionsTest, GuardRestoresSnapshot) {
+  Options<EnableOption>& options = EnableOptionsGuard::getCurOptions();
+  const OptionsSnapshot<EnableOption>* before = options.snapshot();
+  {
+    EnableOptionsGuard guard;
+    options.set(EnableOption::KernelDb, {"a", "b"});
+    EXPECT_TRUE(isOptionEnabled(EnableOption::KernelDb));
+    EXPECT_TRUE(hasEnableOptionArgument(EnableOption::KernelDb, "b"));
+    options.unset(EnableOption::KernelDb);
+    EXPECT_FALSE(isOptionEnabled(EnableOption::KernelDb));
+  }
+  EXPECT_EQ(options.snapshot(), before);
+}
+
+// Equal snapshots are interned, so toggling an option doesn't accumulate
+// snapshots.
+TEST_F(OptionsTest, SnapshotsAreInterned) {
+  Options<DisableOption>& options = DisableOptionsGuard::getCurOptions();
+  DisableOptionsGuard guard;
+  options.set(DisableOption::MagicZero);
+  const OptionsSnapshot<DisableOption>* with_option = options.snapshot();
+  options.unset(DisableOption::MagicZero);
+  const OptionsSnapshot<DisableOption>* without_option = options.snapshot();
+  EXPECT_NE(with_option, without_option);
+  options.set(DisableOption::MagicZero);
+  EXPECT_EQ(options.snapshot(), with_option);
+  options.unset(DisableOption::MagicZero);
+  EXPECT_EQ(options.snapshot(), without_option);
+}
+
+TEST_F(OptionsTest, InheritedOptions) {
+  Options<EnableOption>& options = EnableOptionsGuard::getCurOptions();
+  EnableOptionsGuard guard;
+  options.set(EnableOption::KernelDb);
+  const InheritedOptions inherited = InheritedOptions::capture();
+  options.unset(EnableOption::KernelDb);
+
+  std::thread worker([&]() {
+    // Without inheriting, a thread reads the process-wide options.
+    EXPECT_FALSE(isOptionEnabled(EnableOption::KernelDb));
+    InheritedOptionsGuard inherited_guard(inherited);
+    EXPECT_TRUE(isOptionEnabled(EnableOption::KernelDb));
+    {
+      // Changes while inheriting are only seen by this thread.
+      EnableOptionsGuard worker_guard;
+      options.set(EnableOption::StaticFusionCount);
+      EXPECT_TRUE(isOptionEnabled(EnableOption::StaticFusionCount));
+    }
+    EXPECT_FALSE(isOptionEnabled(EnableOption::StaticFusionCount));
+  });
+  worker.join();
+
+  EXPECT_FALSE(isOptionEnabled(EnableOption::KernelDb));
+  EXPECT_FALSE(isOptionEnabled(EnableOption::StaticFusionCount));
+}
+
 } // namespace nvfuser
@@ -52,13 +52,16 @@ def check_out(branch_or_commit: str) -> None:
     subprocess.check_call("git submodule update --init --recursive", shell=True)
 
 
-# Runs nvfuser_bench with `benchmark_args` on the given branch or commit. Dumps
+# Runs `benchmark_binary` with `benchmark_args` on the given branch or commit. Dumps
 # outputs to `out_dir`. Returns `out_dir`/`branch_or_commit`.json that captures
 # the benchmark result. If the output already exists, skips benchmarking and
 # uses that output. This is useful, for example, when comparing multiple
 # contenders to the same base.
 def run_benchmark(
-    branch_or_commit: str, benchmark_args: list[str], out_dir: str
+    branch_or_commit: str,
+    benchmark_binary: str,
+    benchmark_args: list[str],
+    out_dir: str,
 ) -> str:
     benchmark_out = os.path.join(out_dir, branch_or_commit + ".json")
     if os.path.exists(benchmark_out):
@@ -70,7 +73,7 @@ def run_benchmark(
     subprocess.check_call("pip install -e .", shell=True)
 
     benchmark_command = " ".join(
-        ["bin/nvfuser_bench"]
+        [benchmark_binary]
         + benchmark_args
         + [f"--benchmark_out={benchmark_out}", "--benchmark_format=json"]
     )
@@ -194,6 +197,12 @@ if __name__ == "__main__":
         type=str,
         help="The output folder that will contain benchmark results and comparison",
     )
+    parser.add_argument(
+        "--benchmark_binary",
+        type=str,
+        default="bin/nvfuser_bench",
+        help="The benchmark binary to run, e.g., bin/nvfuser_compile_bench",
+    )
     parser.add_argument(
         "benchmark_args",
         type=str,
@@ -209,8 +218,12 @@ if __name__ == "__main__":
 
     original_branch_or_commit = get_head_branch_or_commit()
     try:
-        baseline_out = run_benchmark(args.baseline, benchmark_args, args.out_dir)
-        contender_out = run_benchmark(args.contender, benchmark_args, args.out_dir)
+        baseline_out = run_benchmark(
+            args.baseline, args.benchmark_binary, benchmark_args, args.out_dir
+        )
+        contender_out = run_benchmark(
+            args.contender, args.benchmark_binary, benchmark_args, args.out_dir
+        )
     finally:
         # Check out the original branch even when benchmarking failed.
         check_out(original_branch_or_commit)